@@ -0,0 +1,147 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace loadgen {
+
+namespace {
+
+/**
+ * @brief 3 significant digits need single unit resolution up to 2 * 10^3, that is 2^11 sub buckets.
+ */
+constexpr int kSubBucketCountMagnitude = 11;
+
+int
+LeadingZeros(uint64_t value) {
+    return __builtin_clzll(value);
+}
+
+}  // namespace
+
+Histogram::Histogram(uint64_t highest_value) : highest_value_(std::max<uint64_t>(highest_value, 2)) {
+    sub_bucket_half_count_magnitude_ = kSubBucketCountMagnitude - 1;
+    sub_bucket_count_ = 1ULL << kSubBucketCountMagnitude;
+    sub_bucket_half_count_ = sub_bucket_count_ / 2;
+    sub_bucket_mask_ = sub_bucket_count_ - 1;
+
+    // each bucket covers twice the range of the previous one
+    uint64_t trackable = sub_bucket_count_;
+    size_t bucket_count = 1;
+    while (trackable <= highest_value_ && trackable <= (UINT64_MAX >> 1)) {
+        trackable <<= 1;
+        ++bucket_count;
+    }
+    counts_.resize((bucket_count + 1) * sub_bucket_half_count_, 0);
+}
+
+void
+Histogram::Record(uint64_t value) {
+    value = std::min(value, highest_value_);
+    ++counts_[CountsIndex(value)];
+    ++total_count_;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    sum_ += static_cast<double>(value);
+}
+
+void
+Histogram::Merge(const Histogram& other) {
+    if (other.counts_.size() != counts_.size()) {
+        // different ranges, replay the values bucket by bucket
+        for (size_t i = 0; i < other.counts_.size(); ++i) {
+            for (uint64_t n = 0; n < other.counts_[i]; ++n) {
+                Record(other.ValueFromIndex(i));
+            }
+        }
+        return;
+    }
+    for (size_t i = 0; i < counts_.size(); ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    total_count_ += other.total_count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    sum_ += other.sum_;
+}
+
+uint64_t
+Histogram::Min() const {
+    return total_count_ == 0 ? 0 : min_;
+}
+
+double
+Histogram::Mean() const {
+    return total_count_ == 0 ? 0 : sum_ / static_cast<double>(total_count_);
+}
+
+uint64_t
+Histogram::ValueAtPercentile(double percentile) const {
+    if (total_count_ == 0) {
+        return 0;
+    }
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    auto count_at_percentile = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(total_count_)));
+    count_at_percentile = std::max<uint64_t>(count_at_percentile, 1);
+
+    uint64_t running_count = 0;
+    for (size_t i = 0; i < counts_.size(); ++i) {
+        running_count += counts_[i];
+        if (running_count >= count_at_percentile) {
+            return std::min(HighestEquivalentValue(ValueFromIndex(i)), max_);
+        }
+    }
+    return max_;
+}
+
+int
+Histogram::BucketIndex(uint64_t value) const {
+    const int pow2_ceiling = 64 - LeadingZeros(value | sub_bucket_mask_);
+    return pow2_ceiling - (sub_bucket_half_count_magnitude_ + 1);
+}
+
+size_t
+Histogram::CountsIndex(uint64_t value) const {
+    const int bucket_index = BucketIndex(value);
+    const uint64_t sub_bucket_index = value >> bucket_index;
+    return (static_cast<size_t>(bucket_index + 1) << sub_bucket_half_count_magnitude_) +
+           (sub_bucket_index - sub_bucket_half_count_);
+}
+
+uint64_t
+Histogram::ValueFromIndex(size_t index) const {
+    int bucket_index = static_cast<int>(index >> sub_bucket_half_count_magnitude_) - 1;
+    uint64_t sub_bucket_index = (index & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_;
+    if (bucket_index < 0) {
+        sub_bucket_index -= sub_bucket_half_count_;
+        bucket_index = 0;
+    }
+    return sub_bucket_index << bucket_index;
+}
+
+uint64_t
+Histogram::HighestEquivalentValue(uint64_t value) const {
+    const int bucket_index = BucketIndex(value);
+    const uint64_t sub_bucket_index = value >> bucket_index;
+    const int adjusted_bucket = sub_bucket_index >= sub_bucket_count_ ? bucket_index + 1 : bucket_index;
+    const uint64_t lowest_equivalent = sub_bucket_index << bucket_index;
+    return lowest_equivalent + (1ULL << adjusted_bucket) - 1;
+}
+
+}  // namespace loadgen
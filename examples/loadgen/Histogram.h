@@ -0,0 +1,93 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace loadgen {
+
+/**
+ * @brief High dynamic range histogram of latencies in microseconds.
+ *
+ * Values are counted in log-linear buckets: each power of two range is split into equal sub buckets, so every
+ * recorded value is kept with 3 significant decimal digits at a fixed memory cost. Not thread safe, each worker
+ * records into its own histogram and they are merged for the report.
+ */
+class Histogram {
+ public:
+    /**
+     * @param [in] highest_value highest trackable value, larger values are clamped to it
+     */
+    explicit Histogram(uint64_t highest_value = 3600ULL * 1000 * 1000);
+
+    void
+    Record(uint64_t value);
+
+    void
+    Merge(const Histogram& other);
+
+    uint64_t
+    Count() const {
+        return total_count_;
+    }
+
+    uint64_t
+    Min() const;
+
+    uint64_t
+    Max() const {
+        return max_;
+    }
+
+    double
+    Mean() const;
+
+    /**
+     * @brief Value that percentile percent of the recorded values are less than or equal to, percentile in [0, 100].
+     */
+    uint64_t
+    ValueAtPercentile(double percentile) const;
+
+ private:
+    int
+    BucketIndex(uint64_t value) const;
+
+    size_t
+    CountsIndex(uint64_t value) const;
+
+    uint64_t
+    ValueFromIndex(size_t index) const;
+
+    uint64_t
+    HighestEquivalentValue(uint64_t value) const;
+
+ private:
+    uint64_t highest_value_;
+    int sub_bucket_half_count_magnitude_ = 0;
+    uint64_t sub_bucket_count_ = 0;
+    uint64_t sub_bucket_half_count_ = 0;
+    uint64_t sub_bucket_mask_ = 0;
+    std::vector<uint64_t> counts_;
+    uint64_t total_count_ = 0;
+    uint64_t min_ = UINT64_MAX;
+    uint64_t max_ = 0;
+    double sum_ = 0;
+};
+
+}  // namespace loadgen
@@ -0,0 +1,389 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "LoadGenerator.h"
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace loadgen {
+
+namespace {
+
+const char* const kIdField = "id";
+const char* const kVectorField = "vector";
+
+std::string
+JsonString(const std::string& text) {
+    std::ostringstream out;
+    out << '"';
+    for (char c : text) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+    return out.str();
+}
+
+void
+WriteHistogram(std::ostringstream& out, const Histogram& histogram) {
+    out << "{\"min\": " << histogram.Min() << ", \"mean\": " << std::fixed << std::setprecision(1)
+        << histogram.Mean() << ", \"p50\": " << histogram.ValueAtPercentile(50)
+        << ", \"p90\": " << histogram.ValueAtPercentile(90) << ", \"p99\": " << histogram.ValueAtPercentile(99)
+        << ", \"p999\": " << histogram.ValueAtPercentile(99.9)
+        << ", \"p9999\": " << histogram.ValueAtPercentile(99.99) << ", \"max\": " << histogram.Max() << "}";
+}
+
+uint64_t
+Microseconds(LoadGenerator::Clock::duration duration) {
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    return us < 0 ? 0 : static_cast<uint64_t>(us);
+}
+
+}  // namespace
+
+const char*
+OperationName(Operation operation) {
+    switch (operation) {
+        case Operation::INSERT:
+            return "insert";
+        case Operation::SEARCH:
+            return "search";
+        case Operation::QUERY:
+            return "query";
+        case Operation::DELETE:
+            return "delete";
+    }
+    return "unknown";
+}
+
+LoadGenerator::LoadGenerator(const Options& options) : options_(options) {
+}
+
+milvus::Status
+LoadGenerator::Setup() {
+    for (uint32_t i = 0; i < std::max<uint32_t>(1, options_.connections); ++i) {
+        auto client = milvus::MilvusClient::Create();
+        milvus::ConnectParam connect_param{options_.host, options_.port};
+        // separate channels, otherwise the connections share one
+        connect_param.SetShareChannel(false);
+        auto status = client->Connect(connect_param);
+        if (!status.IsOk()) {
+            return status;
+        }
+        clients_.push_back(client);
+    }
+
+    auto& client = *clients_.front();
+    if (options_.create_collection) {
+        milvus::CollectionSchema schema(options_.collection);
+        milvus::FieldSchema id_field(kIdField, milvus::DataType::INT64, "primary key", true, false);
+        schema.AddField(id_field);
+        milvus::FieldSchema vector_field(kVectorField, milvus::DataType::FLOAT_VECTOR, "synthetic vectors");
+        vector_field.SetDimension(options_.dimension);
+        schema.AddField(vector_field);
+        auto status = client.CreateCollection(schema);
+        if (!status.IsOk()) {
+            return status;
+        }
+    }
+    // wait until the collection is loaded, searches and queries fail before that
+    milvus::TimeoutSetting load_timeout;
+    auto status = client.LoadCollection(options_.collection, &load_timeout);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    std::mt19937_64 random(options_.seed);
+    const uint32_t batch = std::max<uint32_t>(1, options_.insert_batch);
+    for (uint64_t inserted = 0; inserted < options_.preload_rows; inserted += batch) {
+        auto row_count = static_cast<uint32_t>(std::min<uint64_t>(batch, options_.preload_rows - inserted));
+        status = Insert(client, random, row_count);
+        if (!status.IsOk()) {
+            return status;
+        }
+    }
+    return milvus::Status::OK();
+}
+
+void
+LoadGenerator::Run() {
+    const auto start = Clock::now();
+    const auto end = start + std::chrono::duration_cast<Clock::duration>(
+                                 std::chrono::duration<double>(options_.duration_seconds));
+
+    std::vector<std::thread> workers;
+    for (uint32_t i = 0; i < std::max<uint32_t>(1, options_.threads); ++i) {
+        workers.emplace_back(&LoadGenerator::Work, this, i);
+    }
+
+    std::vector<std::thread> dispatchers;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        for (int i = 0; i < kOperationCount; ++i) {
+            if (options_.rates[i] > 0) {
+                ++running_dispatchers_;
+            }
+        }
+    }
+    for (int i = 0; i < kOperationCount; ++i) {
+        if (options_.rates[i] > 0) {
+            dispatchers.emplace_back(&LoadGenerator::Dispatch, this, static_cast<Operation>(i), start, end);
+        }
+    }
+
+    for (auto& dispatcher : dispatchers) {
+        dispatcher.join();
+    }
+    {
+        // wake the idle workers in case no dispatcher was started
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        queue_cond_.notify_all();
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    elapsed_seconds_ = std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void
+LoadGenerator::Dispatch(Operation operation, Clock::time_point start, Clock::time_point end) {
+    const auto interval = std::chrono::duration<double>(1.0 / options_.rates[static_cast<int>(operation)]);
+    auto& stats = stats_[static_cast<int>(operation)];
+    for (uint64_t k = 0;; ++k) {
+        // the schedule doesn't depend on when earlier requests complete
+        auto scheduled = start + std::chrono::duration_cast<Clock::duration>(interval * static_cast<double>(k));
+        if (scheduled >= end) {
+            break;
+        }
+        std::this_thread::sleep_until(scheduled);
+        {
+            std::lock_guard<std::mutex> lock(stats.mutex_);
+            ++stats.scheduled_;
+        }
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        queue_.push_back(Task{operation, scheduled});
+        max_backlog_ = std::max(max_backlog_, queue_.size());
+        queue_cond_.notify_one();
+    }
+
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    if (--running_dispatchers_ == 0) {
+        queue_cond_.notify_all();
+    }
+}
+
+void
+LoadGenerator::Work(uint32_t worker) {
+    std::mt19937_64 random(options_.seed + 1 + worker);
+    auto& client = *clients_[worker % clients_.size()];
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            queue_cond_.wait(lock, [this] { return !queue_.empty() || running_dispatchers_ == 0; });
+            if (queue_.empty()) {
+                return;
+            }
+            task = queue_.front();
+            queue_.pop_front();
+        }
+
+        const auto begin = Clock::now();
+        uint64_t rows = 0;
+        auto status = Execute(task.operation_, client, random, rows);
+        const auto finish = Clock::now();
+
+        auto& stats = stats_[static_cast<int>(task.operation_)];
+        std::lock_guard<std::mutex> lock(stats.mutex_);
+        stats.latency_.Record(Microseconds(finish - task.scheduled_));
+        stats.service_time_.Record(Microseconds(finish - begin));
+        ++stats.completed_;
+        if (status.IsOk()) {
+            stats.rows_ += rows;
+        } else {
+            ++stats.errors_;
+            stats.last_error_ = status.Message();
+        }
+    }
+}
+
+milvus::Status
+LoadGenerator::Execute(Operation operation, milvus::MilvusClient& client, std::mt19937_64& random, uint64_t& rows) {
+    switch (operation) {
+        case Operation::INSERT: {
+            rows = options_.insert_batch;
+            return Insert(client, random, options_.insert_batch);
+        }
+        case Operation::SEARCH: {
+            milvus::SearchArguments arguments;
+            arguments.SetCollectionName(options_.collection);
+            arguments.SetAnnsField(kVectorField);
+            arguments.SetTopK(options_.topk);
+            arguments.SetMetricType(options_.metric_type);
+            arguments.AddExtraParam("nprobe", options_.nprobe);
+            for (uint32_t i = 0; i < options_.search_nq; ++i) {
+                arguments.AddTargetVector(RandomVector(random));
+            }
+            milvus::SearchResults results;
+            auto status = client.Search(arguments, results);
+            rows = results.Results().size();
+            return status;
+        }
+        case Operation::QUERY: {
+            milvus::QueryArguments arguments;
+            arguments.SetCollectionName(options_.collection);
+            arguments.AddOutputField(kIdField);
+            std::string expression = std::string(kIdField) + " in [";
+            auto ids = RandomIds(random, options_.query_ids);
+            for (size_t i = 0; i < ids.size(); ++i) {
+                expression += (i == 0 ? "" : ",") + std::to_string(ids[i]);
+            }
+            arguments.SetExpression(expression + "]");
+            milvus::QueryResults results;
+            auto status = client.Query(arguments, results);
+            rows = ids.size();
+            return status;
+        }
+        case Operation::DELETE: {
+            milvus::DmlResults results;
+            rows = options_.delete_batch;
+            return client.DeleteByIds(options_.collection, "", RandomIds(random, options_.delete_batch), results);
+        }
+    }
+    return milvus::Status(milvus::StatusCode::InvalidAgument, "Unknown operation");
+}
+
+milvus::Status
+LoadGenerator::Insert(milvus::MilvusClient& client, std::mt19937_64& random, uint32_t row_count) {
+    const int64_t first_id = next_id_.fetch_add(row_count);
+    std::vector<int64_t> ids(row_count);
+    std::vector<float> vectors;
+    vectors.reserve(static_cast<size_t>(row_count) * options_.dimension);
+    for (uint32_t i = 0; i < row_count; ++i) {
+        ids[i] = first_id + i;
+        auto vector = RandomVector(random);
+        vectors.insert(vectors.end(), vector.begin(), vector.end());
+    }
+
+    std::vector<milvus::FieldDataPtr> fields;
+    fields.emplace_back(std::make_shared<milvus::Int64FieldData>(kIdField, std::move(ids)));
+    fields.emplace_back(
+        std::make_shared<milvus::FloatVecFieldData>(kVectorField, options_.dimension, std::move(vectors)));
+    milvus::DmlResults results;
+    return client.Insert(options_.collection, "", fields, results);
+}
+
+std::vector<float>
+LoadGenerator::RandomVector(std::mt19937_64& random) const {
+    std::vector<float> vector(options_.dimension);
+    if (options_.distribution == "normal") {
+        std::normal_distribution<float> distribution(0.0f, 1.0f);
+        for (auto& value : vector) {
+            value = distribution(random);
+        }
+    } else {
+        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+        for (auto& value : vector) {
+            value = distribution(random);
+        }
+    }
+
+    if (options_.normalize) {
+        double norm = 0;
+        for (auto value : vector) {
+            norm += static_cast<double>(value) * value;
+        }
+        norm = std::sqrt(norm);
+        if (norm > 0) {
+            for (auto& value : vector) {
+                value = static_cast<float>(value / norm);
+            }
+        }
+    }
+    return vector;
+}
+
+std::vector<int64_t>
+LoadGenerator::RandomIds(std::mt19937_64& random, uint32_t count) const {
+    // ids inserted so far, or a small range before anything is inserted
+    const int64_t id_count = std::max<int64_t>(next_id_.load(), 1000);
+    std::uniform_int_distribution<int64_t> distribution(0, id_count - 1);
+    std::vector<int64_t> ids(count);
+    for (auto& id : ids) {
+        id = distribution(random);
+    }
+    return ids;
+}
+
+std::string
+LoadGenerator::ReportJson() const {
+    std::ostringstream out;
+    out << "{\n";
+    out << "  \"config\": {\"host\": " << JsonString(options_.host) << ", \"port\": " << options_.port
+        << ", \"collection\": " << JsonString(options_.collection) << ", \"dimension\": " << options_.dimension
+        << ", \"distribution\": " << JsonString(options_.distribution) << ", \"threads\": " << options_.threads
+        << ", \"connections\": " << options_.connections << ", \"duration_s\": " << options_.duration_seconds
+        << "},\n";
+    out << "  \"elapsed_s\": " << std::fixed << std::setprecision(3) << elapsed_seconds_ << ",\n";
+    out << "  \"max_backlog\": " << max_backlog_ << ",\n";
+    out << "  \"operations\": {";
+
+    bool first = true;
+    for (int i = 0; i < kOperationCount; ++i) {
+        if (options_.rates[i] <= 0) {
+            continue;
+        }
+        const auto& stats = stats_[i];
+        std::lock_guard<std::mutex> lock(stats.mutex_);
+        const double elapsed = elapsed_seconds_ > 0 ? elapsed_seconds_ : 1;
+        out << (first ? "\n" : ",\n");
+        first = false;
+        out << "    " << JsonString(OperationName(static_cast<Operation>(i))) << ": {\n";
+        out << "      \"target_rate\": " << std::setprecision(1) << options_.rates[i] << ",\n";
+        out << "      \"scheduled\": " << stats.scheduled_ << ", \"completed\": " << stats.completed_
+            << ", \"errors\": " << stats.errors_ << ",\n";
+        out << "      \"throughput\": " << std::setprecision(1)
+            << static_cast<double>(stats.completed_ - stats.errors_) / elapsed
+            << ", \"rows_per_s\": " << static_cast<double>(stats.rows_) / elapsed << ",\n";
+        out << "      \"latency_us\": ";
+        WriteHistogram(out, stats.latency_);
+        out << ",\n      \"service_time_us\": ";
+        WriteHistogram(out, stats.service_time_);
+        out << ",\n      \"last_error\": " << JsonString(stats.last_error_) << "\n    }";
+    }
+    out << "\n  }\n}\n";
+    return out.str();
+}
+
+}  // namespace loadgen
@@ -0,0 +1,157 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Histogram.h"
+#include "MilvusClient.h"
+
+namespace loadgen {
+
+enum class Operation {
+    INSERT = 0,
+    SEARCH,
+    QUERY,
+    DELETE,
+};
+
+constexpr int kOperationCount = 4;
+
+const char*
+OperationName(Operation operation);
+
+struct Options {
+    std::string host = "localhost";
+    uint16_t port = 19530;
+    uint32_t connections = 1;
+    std::string collection = "loadgen";
+    bool create_collection = false;
+    uint64_t preload_rows = 0;
+
+    uint32_t dimension = 128;
+    // "uniform" in [0, 1) or "normal" with mean 0 and deviation 1
+    std::string distribution = "uniform";
+    bool normalize = false;
+    uint64_t seed = 42;
+
+    double duration_seconds = 60;
+    // open-loop arrival rate of each operation, requests per second
+    double rates[kOperationCount] = {0, 0, 0, 0};
+    uint32_t threads = 16;
+
+    uint32_t insert_batch = 100;
+    uint32_t search_nq = 1;
+    int64_t topk = 10;
+    int64_t nprobe = 16;
+    std::string metric_type = "L2";
+    uint32_t query_ids = 10;
+    uint32_t delete_batch = 10;
+
+    // JSON report file, empty for stdout
+    std::string output;
+};
+
+/**
+ * @brief Open-loop load generator.
+ *
+ * A dispatcher thread for each operation schedules requests at fixed intervals regardless of how fast the server
+ * responds, the workers execute them. Latency is measured from the scheduled time, so time spent queued behind
+ * slow requests is counted instead of being hidden by coordinated omission. Service time is measured from the
+ * moment a worker starts the request.
+ */
+class LoadGenerator {
+ public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit LoadGenerator(const Options& options);
+
+    /**
+     * @brief Connect, create and load the collection if requested, and insert the preload rows.
+     */
+    milvus::Status
+    Setup();
+
+    /**
+     * @brief Generate load for the configured duration, return when the scheduled requests have completed.
+     */
+    void
+    Run();
+
+    std::string
+    ReportJson() const;
+
+ private:
+    struct Task {
+        Operation operation_;
+        Clock::time_point scheduled_;
+    };
+
+    struct OperationStats {
+        mutable std::mutex mutex_;
+        Histogram latency_;
+        Histogram service_time_;
+        uint64_t scheduled_ = 0;
+        uint64_t completed_ = 0;
+        uint64_t errors_ = 0;
+        uint64_t rows_ = 0;
+        std::string last_error_;
+    };
+
+    void
+    Dispatch(Operation operation, Clock::time_point start, Clock::time_point end);
+
+    void
+    Work(uint32_t worker);
+
+    milvus::Status
+    Execute(Operation operation, milvus::MilvusClient& client, std::mt19937_64& random, uint64_t& rows);
+
+    milvus::Status
+    Insert(milvus::MilvusClient& client, std::mt19937_64& random, uint32_t row_count);
+
+    std::vector<float>
+    RandomVector(std::mt19937_64& random) const;
+
+    std::vector<int64_t>
+    RandomIds(std::mt19937_64& random, uint32_t count) const;
+
+ private:
+    const Options options_;
+    std::vector<std::shared_ptr<milvus::MilvusClient>> clients_;
+    std::atomic<int64_t> next_id_{0};
+
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cond_;
+    std::deque<Task> queue_;
+    size_t max_backlog_ = 0;
+    int running_dispatchers_ = 0;
+
+    OperationStats stats_[kOperationCount];
+    double elapsed_seconds_ = 0;
+};
+
+}  // namespace loadgen
@@ -0,0 +1,172 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "LoadGenerator.h"
+
+namespace {
+
+void
+PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "Open-loop load generator, reports latency percentiles and throughput per operation as JSON.\n\n"
+              << "  --host=HOST             server host, default localhost\n"
+              << "  --port=PORT             server port, default 19530\n"
+              << "  --connections=N         client connections, default 1\n"
+              << "  --collection=NAME       collection with an int64 \"id\" and a float vector \"vector\" field\n"
+              << "  --create                create the collection before the run\n"
+              << "  --preload=ROWS          rows inserted before the run\n"
+              << "  --dim=N                 vector dimension, default 128\n"
+              << "  --distribution=NAME     uniform or normal, default uniform\n"
+              << "  --normalize             normalize the vectors to unit length\n"
+              << "  --seed=N                random seed, default 42\n"
+              << "  --duration=SECONDS      duration of the run, default 60\n"
+              << "  --threads=N             worker threads, default 16\n"
+              << "  --insert-rate=RPS       insert requests per second\n"
+              << "  --search-rate=RPS       search requests per second\n"
+              << "  --query-rate=RPS        query requests per second\n"
+              << "  --delete-rate=RPS       delete requests per second\n"
+              << "  --insert-batch=ROWS     rows of each insert, default 100\n"
+              << "  --nq=N                  target vectors of each search, default 1\n"
+              << "  --topk=N                default 10\n"
+              << "  --nprobe=N              default 16\n"
+              << "  --metric=TYPE           default L2\n"
+              << "  --query-ids=N           ids of each query, default 10\n"
+              << "  --delete-batch=N        ids of each delete, default 10\n"
+              << "  --output=FILE           write the report to FILE instead of stdout\n";
+}
+
+bool
+ParseOptions(int argc, char* argv[], loadgen::Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        std::string value;
+        auto equal = arg.find('=');
+        if (equal != std::string::npos) {
+            value = arg.substr(equal + 1);
+            arg = arg.substr(0, equal);
+        }
+
+        if (arg == "--create") {
+            options.create_collection = true;
+        } else if (arg == "--normalize") {
+            options.normalize = true;
+        } else if (equal == std::string::npos) {
+            std::cerr << "Unknown option or missing value: " << arg << std::endl;
+            return false;
+        } else if (arg == "--host") {
+            options.host = value;
+        } else if (arg == "--port") {
+            options.port = static_cast<uint16_t>(std::stoul(value));
+        } else if (arg == "--connections") {
+            options.connections = static_cast<uint32_t>(std::stoul(value));
+        } else if (arg == "--collection") {
+            options.collection = value;
+        } else if (arg == "--preload") {
+            options.preload_rows = std::stoull(value);
+        } else if (arg == "--dim") {
+            options.dimension = static_cast<uint32_t>(std::stoul(value));
+        } else if (arg == "--distribution") {
+            if (value != "uniform" && value != "normal") {
+                std::cerr << "Unknown distribution: " << value << std::endl;
+                return false;
+            }
+            options.distribution = value;
+        } else if (arg == "--seed") {
+            options.seed = std::stoull(value);
+        } else if (arg == "--duration") {
+            options.duration_seconds = std::stod(value);
+        } else if (arg == "--threads") {
+            options.threads = static_cast<uint32_t>(std::stoul(value));
+        } else if (arg == "--insert-rate") {
+            options.rates[static_cast<int>(loadgen::Operation::INSERT)] = std::stod(value);
+        } else if (arg == "--search-rate") {
+            options.rates[static_cast<int>(loadgen::Operation::SEARCH)] = std::stod(value);
+        } else if (arg == "--query-rate") {
+            options.rates[static_cast<int>(loadgen::Operation::QUERY)] = std::stod(value);
+        } else if (arg == "--delete-rate") {
+            options.rates[static_cast<int>(loadgen::Operation::DELETE)] = std::stod(value);
+        } else if (arg == "--insert-batch") {
+            options.insert_batch = static_cast<uint32_t>(std::stoul(value));
+        } else if (arg == "--nq") {
+            options.search_nq = static_cast<uint32_t>(std::stoul(value));
+        } else if (arg == "--topk") {
+            options.topk = std::stoll(value);
+        } else if (arg == "--nprobe") {
+            options.nprobe = std::stoll(value);
+        } else if (arg == "--metric") {
+            options.metric_type = value;
+        } else if (arg == "--query-ids") {
+            options.query_ids = static_cast<uint32_t>(std::stoul(value));
+        } else if (arg == "--delete-batch") {
+            options.delete_batch = static_cast<uint32_t>(std::stoul(value));
+        } else if (arg == "--output") {
+            options.output = value;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+int
+main(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--help" || std::string(argv[i]) == "-h") {
+            PrintUsage(argv[0]);
+            return 0;
+        }
+    }
+
+    loadgen::Options options;
+    try {
+        if (!ParseOptions(argc, argv, options)) {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid option value: " << e.what() << std::endl;
+        return 1;
+    }
+
+    loadgen::LoadGenerator generator(options);
+    auto status = generator.Setup();
+    if (!status.IsOk()) {
+        std::cerr << "Failed to set up: " << status.Message() << std::endl;
+        return 1;
+    }
+
+    generator.Run();
+    auto report = generator.ReportJson();
+    if (options.output.empty()) {
+        std::cout << report;
+    } else {
+        std::ofstream file(options.output);
+        file << report;
+        if (!file) {
+            std::cerr << "Failed to write " << options.output << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "MilvusClient.h"
+
+namespace {
+
+void
+PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " --log=FILE [options]\n"
+              << "Re-issue the requests of a capture log, see milvus::CaptureConfig.\n\n"
+              << "  --log=FILE          capture log\n"
+              << "  --host=HOST         target host, default localhost\n"
+              << "  --port=PORT         target port, default 19530\n"
+              << "  --speed=X           replay speed relative to the original timing, 0 for as fast as possible,\n"
+              << "                      default 1\n"
+              << "  --threads=N         requests in flight at most, default 16\n"
+              << "  --dump              print the requests per method instead of replaying\n";
+}
+
+int
+Dump(const std::string& path) {
+    milvus::CaptureReader reader;
+    auto status = reader.Open(path);
+    if (!status.IsOk()) {
+        std::cerr << status.Message() << std::endl;
+        return 1;
+    }
+
+    std::map<std::string, std::pair<uint64_t, uint64_t>> methods;
+    milvus::CaptureRecord record;
+    uint64_t duration_us = 0;
+    while (true) {
+        bool end = false;
+        status = reader.Next(record, end);
+        if (!status.IsOk() || end) {
+            break;
+        }
+        auto& counts = methods[record.Method()];
+        ++counts.first;
+        counts.second += record.Payload().size();
+        duration_us = record.OffsetUs();
+    }
+
+    for (const auto& method : methods) {
+        std::cout << method.first << ": " << method.second.first << " requests, " << method.second.second
+                  << " bytes" << std::endl;
+    }
+    std::cout << "duration: " << duration_us / 1000 << " ms" << std::endl;
+    if (!status.IsOk()) {
+        std::cerr << status.Message() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace
+
+int
+main(int argc, char* argv[]) {
+    std::string path;
+    std::string host = "localhost";
+    uint16_t port = 19530;
+    bool dump = false;
+    milvus::ReplayOptions options;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto equal = arg.find('=');
+            std::string value = equal == std::string::npos ? "" : arg.substr(equal + 1);
+            arg = arg.substr(0, equal);
+            if (arg == "--log") {
+                path = value;
+            } else if (arg == "--host") {
+                host = value;
+            } else if (arg == "--port") {
+                port = static_cast<uint16_t>(std::stoul(value));
+            } else if (arg == "--speed") {
+                options.SetSpeed(std::stod(value));
+            } else if (arg == "--threads") {
+                options.SetThreads(static_cast<uint32_t>(std::stoul(value)));
+            } else if (arg == "--dump") {
+                dump = true;
+            } else {
+                PrintUsage(argv[0]);
+                return arg == "--help" || arg == "-h" ? 0 : 1;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid option value: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if (path.empty()) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+    if (dump) {
+        return Dump(path);
+    }
+
+    milvus::ReplayStats stats;
+    auto status = milvus::ReplayCapture(path, host, port, options, stats);
+    std::cout << "requests: " << stats.Requests() << ", failures: " << stats.Failures()
+              << ", elapsed: " << stats.ElapsedMs() << " ms, max lag: " << stats.MaxLagMs() << " ms" << std::endl;
+    if (!status.IsOk()) {
+        std::cerr << status.Message() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,158 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AdmissionController.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace milvus {
+
+AdmissionController::AdmissionController(const AdmissionConfig& config) : config_(config) {
+    limit_ = config_.MaxConcurrency();
+    auto now = Clock::now();
+    for (int i = 0; i < AdmissionConfig::CLASS_COUNT; ++i) {
+        classes_[i].tokens_ = std::max(1.0, config_.Limit(static_cast<RequestClass>(i)).Burst());
+        classes_[i].refill_time_ = now;
+    }
+}
+
+Status
+AdmissionController::Acquire(RequestClass request_class, bool wait) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto& state = classes_[static_cast<int>(request_class)];
+    Waiter waiter;
+    state.queue_.push_back(&waiter);
+
+    auto now = Clock::now();
+    auto deadline = wait ? now + std::chrono::milliseconds(config_.QueueTimeoutMs()) : now;
+    auto retry_time = Dispatch(now);
+    while (!waiter.admitted_) {
+        if (Clock::now() >= deadline) {
+            state.queue_.erase(std::find(state.queue_.begin(), state.queue_.end(), &waiter));
+            Dispatch(Clock::now());
+            return Status(StatusCode::Throttled, "Request is throttled by client admission control!");
+        }
+        waiter.cond_.wait_until(lock, std::min(deadline, retry_time));
+        if (!waiter.admitted_) {
+            retry_time = Dispatch(Clock::now());
+        }
+    }
+    return Status::OK();
+}
+
+void
+AdmissionController::Release(RequestClass request_class, Clock::duration latency, bool succeeded) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --classes_[static_cast<int>(request_class)].in_flight_;
+    --in_flight_;
+
+    auto now = Clock::now();
+    if (config_.AdaptiveConcurrency() && config_.MaxConcurrency() > 0) {
+        const double max_limit = config_.MaxConcurrency();
+        const double min_limit = std::min(max_limit, std::max(1.0, static_cast<double>(config_.MinConcurrency())));
+        const auto threshold = std::chrono::milliseconds(config_.LatencyThresholdMs());
+        if (!succeeded || latency > threshold) {
+            // back off at most once per threshold interval, the requests in flight at that moment report together
+            if (now - last_backoff_ >= threshold) {
+                limit_ = std::max(min_limit, limit_ * config_.BackoffRatio());
+                last_backoff_ = now;
+            }
+        } else {
+            limit_ = std::min(max_limit, limit_ + 1.0 / limit_);
+        }
+    }
+    Dispatch(now);
+}
+
+double
+AdmissionController::ConcurrencyLimit() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return limit_;
+}
+
+size_t
+AdmissionController::InFlight() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return in_flight_;
+}
+
+AdmissionController::Clock::time_point
+AdmissionController::Dispatch(Clock::time_point now) {
+    auto retry_time = Clock::time_point::max();
+    for (int i = 0; i < AdmissionConfig::CLASS_COUNT; ++i) {
+        auto& state = classes_[i];
+        const auto& limit = config_.Limit(static_cast<RequestClass>(i));
+        while (!state.queue_.empty()) {
+            if (!OverallAvailable()) {
+                return retry_time;
+            }
+            if (limit.MaxConcurrency() > 0 && state.in_flight_ >= limit.MaxConcurrency()) {
+                break;
+            }
+            if (limit.Rate() > 0) {
+                Refill(state, limit, now);
+                if (state.tokens_ < 1.0) {
+                    auto wait = std::chrono::duration<double>((1.0 - state.tokens_) / limit.Rate());
+                    retry_time = std::min(retry_time, now + std::chrono::duration_cast<Clock::duration>(wait));
+                    // the head may be sleeping without a refill deadline, wake it to compute one
+                    state.queue_.front()->cond_.notify_one();
+                    break;
+                }
+                state.tokens_ -= 1.0;
+            }
+
+            auto waiter = state.queue_.front();
+            state.queue_.pop_front();
+            waiter->admitted_ = true;
+            ++state.in_flight_;
+            ++in_flight_;
+            waiter->cond_.notify_one();
+        }
+    }
+    return retry_time;
+}
+
+bool
+AdmissionController::OverallAvailable() const {
+    if (config_.MaxConcurrency() == 0) {
+        return true;
+    }
+    return static_cast<double>(in_flight_) < std::max(1.0, std::floor(limit_));
+}
+
+void
+AdmissionController::Refill(ClassState& state, const ClassLimit& limit, Clock::time_point now) {
+    std::chrono::duration<double> elapsed = now - state.refill_time_;
+    state.tokens_ = std::min(std::max(1.0, limit.Burst()), state.tokens_ + elapsed.count() * limit.Rate());
+    state.refill_time_ = now;
+}
+
+AdmissionGuard::AdmissionGuard(AdmissionController* controller, RequestClass request_class, bool wait)
+    : controller_(controller), request_class_(request_class) {
+    if (controller_ != nullptr) {
+        status_ = controller_->Acquire(request_class_, wait);
+        start_ = AdmissionController::Clock::now();
+    }
+}
+
+AdmissionGuard::~AdmissionGuard() {
+    if (controller_ != nullptr && status_.IsOk()) {
+        controller_->Release(request_class_, AdmissionController::Clock::now() - start_, succeeded_);
+    }
+}
+
+}  // namespace milvus
@@ -0,0 +1,124 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include "Status.h"
+#include "types/AdmissionConfig.h"
+
+namespace milvus {
+
+/**
+ * @brief Scheduler in front of the connection, admits requests by class limits, token buckets and an overall
+ * concurrency limit. Queued requests are dispatched in priority order, FIFO inside a class.
+ */
+class AdmissionController {
+ public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit AdmissionController(const AdmissionConfig& config);
+
+    /**
+     * @brief Block until the request is admitted, every successful Acquire() must be paired with a Release().
+     * Without wait, fail at once if the request can't be admitted immediately, used by async calls.
+     */
+    Status
+    Acquire(RequestClass request_class, bool wait = true);
+
+    /**
+     * @brief Finish an admitted request, latency and result drive the adaptive concurrency limit.
+     */
+    void
+    Release(RequestClass request_class, Clock::duration latency, bool succeeded);
+
+    double
+    ConcurrencyLimit() const;
+
+    size_t
+    InFlight() const;
+
+ private:
+    struct Waiter {
+        bool admitted_ = false;
+        std::condition_variable cond_;
+    };
+
+    struct ClassState {
+        std::deque<Waiter*> queue_;
+        uint32_t in_flight_ = 0;
+        double tokens_ = 0;
+        Clock::time_point refill_time_;
+    };
+
+    /**
+     * @brief Admit queued requests while limits allow, must be called with mutex_ held. Returns the earliest time
+     * a token bucket refills enough for a blocked class, or time_point::max().
+     */
+    Clock::time_point
+    Dispatch(Clock::time_point now);
+
+    bool
+    OverallAvailable() const;
+
+    void
+    Refill(ClassState& state, const ClassLimit& limit, Clock::time_point now);
+
+ private:
+    const AdmissionConfig config_;
+    mutable std::mutex mutex_;
+    ClassState classes_[AdmissionConfig::CLASS_COUNT];
+    size_t in_flight_ = 0;
+    double limit_ = 0;
+    Clock::time_point last_backoff_;
+};
+
+/**
+ * @brief Acquire admission on construction and release it on destruction, does nothing if controller is null.
+ */
+class AdmissionGuard {
+ public:
+    AdmissionGuard(AdmissionController* controller, RequestClass request_class, bool wait = true);
+
+    ~AdmissionGuard();
+
+    AdmissionGuard(const AdmissionGuard&) = delete;
+    AdmissionGuard&
+    operator=(const AdmissionGuard&) = delete;
+
+    const Status&
+    Result() const {
+        return status_;
+    }
+
+    void
+    SetSucceeded(bool succeeded) {
+        succeeded_ = succeeded;
+    }
+
+ private:
+    AdmissionController* controller_ = nullptr;
+    RequestClass request_class_;
+    Status status_;
+    bool succeeded_ = true;
+    AdmissionController::Clock::time_point start_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,324 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ArrowExport.h"
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace milvus {
+
+namespace {
+
+/**
+ * @brief Data buffer of an empty column, consumers may reject null data buffers.
+ */
+const int64_t kEmptyBuffer[2] = {0, 0};
+
+struct SchemaData {
+    std::string format;
+    std::string name;
+    std::vector<ArrowSchema*> children;
+};
+
+struct ArrayData {
+    // the exported buffers point into this column, it lives until the array is released
+    FieldDataPtr column;
+    // converted buffers of bool and string columns
+    std::vector<uint8_t> bitmap;
+    std::vector<int32_t> offsets;
+    std::vector<int64_t> large_offsets;
+    std::string chars;
+    std::vector<const void*> buffers;
+    std::vector<ArrowArray*> children;
+};
+
+void
+ReleaseSchema(ArrowSchema* schema) {
+    auto data = static_cast<SchemaData*>(schema->private_data);
+    for (auto child : data->children) {
+        // a consumer may have moved the child out and released it already
+        if (child->release != nullptr) {
+            child->release(child);
+        }
+        delete child;
+    }
+    delete data;
+    schema->release = nullptr;
+}
+
+void
+ReleaseArray(ArrowArray* array) {
+    auto data = static_cast<ArrayData*>(array->private_data);
+    for (auto child : data->children) {
+        if (child->release != nullptr) {
+            child->release(child);
+        }
+        delete child;
+    }
+    delete data;
+    array->release = nullptr;
+}
+
+void
+FillSchema(ArrowSchema* schema, SchemaData* data) {
+    schema->format = data->format.c_str();
+    schema->name = data->name.c_str();
+    schema->metadata = nullptr;
+    schema->flags = 0;
+    schema->n_children = static_cast<int64_t>(data->children.size());
+    schema->children = data->children.empty() ? nullptr : data->children.data();
+    schema->dictionary = nullptr;
+    schema->release = &ReleaseSchema;
+    schema->private_data = data;
+}
+
+void
+FillArray(ArrowArray* array, int64_t length, ArrayData* data) {
+    for (auto& buffer : data->buffers) {
+        // only the validity bitmap (always the first buffer) may be null
+        if (buffer == nullptr && &buffer != &data->buffers.front()) {
+            buffer = kEmptyBuffer;
+        }
+    }
+    array->length = length;
+    array->null_count = 0;
+    array->offset = 0;
+    array->n_buffers = static_cast<int64_t>(data->buffers.size());
+    array->n_children = static_cast<int64_t>(data->children.size());
+    array->buffers = data->buffers.data();
+    array->children = data->children.empty() ? nullptr : data->children.data();
+    array->dictionary = nullptr;
+    array->release = &ReleaseArray;
+    array->private_data = data;
+}
+
+template <typename Column>
+const void*
+ColumnBuffer(const FieldDataPtr& column) {
+    return static_cast<const Column&>(*column).Data().data();
+}
+
+bool
+Exportable(DataType type) {
+    switch (type) {
+        case DataType::BOOL:
+        case DataType::INT8:
+        case DataType::INT16:
+        case DataType::INT32:
+        case DataType::INT64:
+        case DataType::FLOAT:
+        case DataType::DOUBLE:
+        case DataType::STRING:
+        case DataType::FLOAT_VECTOR:
+        case DataType::BINARY_VECTOR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+const char*
+PrimitiveFormat(DataType type) {
+    switch (type) {
+        case DataType::INT8:
+            return "c";
+        case DataType::INT16:
+            return "s";
+        case DataType::INT32:
+            return "i";
+        case DataType::INT64:
+            return "l";
+        case DataType::FLOAT:
+            return "f";
+        default:
+            return "g";
+    }
+}
+
+const void*
+PrimitiveBuffer(const FieldDataPtr& column) {
+    switch (column->Type()) {
+        case DataType::INT8:
+            return ColumnBuffer<Int8FieldData>(column);
+        case DataType::INT16:
+            return ColumnBuffer<Int16FieldData>(column);
+        case DataType::INT32:
+            return ColumnBuffer<Int32FieldData>(column);
+        case DataType::INT64:
+            return ColumnBuffer<Int64FieldData>(column);
+        case DataType::FLOAT:
+            return ColumnBuffer<FloatFieldData>(column);
+        default:
+            return ColumnBuffer<DoubleFieldData>(column);
+    }
+}
+
+void
+ExportStrings(const StringFieldData& column, SchemaData* schema_data, ArrayData* array_data) {
+    const auto& values = column.Data();
+    size_t total = 0;
+    for (const auto& value : values) {
+        total += value.size();
+    }
+    array_data->chars.reserve(total);
+    for (const auto& value : values) {
+        array_data->chars.append(value);
+    }
+
+    if (total <= static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+        schema_data->format = "u";
+        auto& offsets = array_data->offsets;
+        offsets.reserve(values.size() + 1);
+        offsets.push_back(0);
+        for (const auto& value : values) {
+            offsets.push_back(offsets.back() + static_cast<int32_t>(value.size()));
+        }
+        array_data->buffers = {nullptr, offsets.data(), array_data->chars.data()};
+    } else {
+        // more than 2GB of characters needs 64-bit offsets
+        schema_data->format = "U";
+        auto& offsets = array_data->large_offsets;
+        offsets.reserve(values.size() + 1);
+        offsets.push_back(0);
+        for (const auto& value : values) {
+            offsets.push_back(offsets.back() + static_cast<int64_t>(value.size()));
+        }
+        array_data->buffers = {nullptr, offsets.data(), array_data->chars.data()};
+    }
+}
+
+/**
+ * @brief Export one column, the type is checked by Exportable() before.
+ */
+void
+ExportColumn(const FieldDataPtr& column, ArrowSchema* schema, ArrowArray* array) {
+    std::unique_ptr<SchemaData> schema_data(new SchemaData());
+    std::unique_ptr<ArrayData> array_data(new ArrayData());
+    schema_data->name = column->Name();
+    array_data->column = column;
+    const auto length = static_cast<int64_t>(column->Count());
+
+    switch (column->Type()) {
+        case DataType::BOOL: {
+            // std::vector<bool> has no defined layout, pack it into an Arrow bitmap, least significant bit first
+            const auto& values = static_cast<const BoolFieldData&>(*column).Data();
+            schema_data->format = "b";
+            array_data->bitmap.assign((values.size() + 7) / 8, 0);
+            for (size_t i = 0; i < values.size(); ++i) {
+                if (values[i]) {
+                    array_data->bitmap[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+                }
+            }
+            array_data->buffers = {nullptr, array_data->bitmap.data()};
+            break;
+        }
+        case DataType::STRING:
+            ExportStrings(static_cast<const StringFieldData&>(*column), schema_data.get(), array_data.get());
+            break;
+        case DataType::FLOAT_VECTOR: {
+            // fixed_size_list<float>, the child holds all elements of all rows
+            const auto& vectors = static_cast<const FloatVecFieldData&>(*column);
+            schema_data->format = "+w:" + std::to_string(vectors.Dimension());
+            array_data->buffers = {nullptr};
+
+            std::unique_ptr<SchemaData> item_schema(new SchemaData());
+            item_schema->format = "f";
+            item_schema->name = "item";
+            std::unique_ptr<ArrayData> item_array(new ArrayData());
+            // a consumer may move the child out and release the parent, the child keeps the column alive by itself
+            item_array->column = column;
+            item_array->buffers = {nullptr, vectors.Data().data()};
+
+            auto child_schema = new ArrowSchema();
+            FillSchema(child_schema, item_schema.release());
+            schema_data->children.push_back(child_schema);
+            auto child_array = new ArrowArray();
+            FillArray(child_array, length * static_cast<int64_t>(vectors.RowWidth()), item_array.release());
+            array_data->children.push_back(child_array);
+            break;
+        }
+        case DataType::BINARY_VECTOR: {
+            const auto& vectors = static_cast<const BinaryVecFieldData&>(*column);
+            schema_data->format = "w:" + std::to_string(vectors.RowWidth());
+            array_data->buffers = {nullptr, vectors.Data().data()};
+            break;
+        }
+        default:
+            schema_data->format = PrimitiveFormat(column->Type());
+            array_data->buffers = {nullptr, PrimitiveBuffer(column)};
+            break;
+    }
+
+    FillSchema(schema, schema_data.release());
+    FillArray(array, length, array_data.release());
+}
+
+Status
+ExportColumns(const std::vector<FieldDataPtr>& columns, ArrowSchema* schema, ArrowArray* array) {
+    if (schema == nullptr || array == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Arrow schema and array cannot be null!");
+    }
+    const size_t row_count = columns.empty() ? 0 : columns.front()->Count();
+    for (const auto& column : columns) {
+        if (!Exportable(column->Type())) {
+            return Status(StatusCode::NotSupported, "Field '" + column->Name() + "' cannot be exported to Arrow!");
+        }
+        if (column->Count() != row_count) {
+            return Status(StatusCode::InvalidAgument, "Row count of field '" + column->Name() + "' is mismatched!");
+        }
+    }
+
+    std::unique_ptr<SchemaData> schema_data(new SchemaData());
+    std::unique_ptr<ArrayData> array_data(new ArrayData());
+    schema_data->format = "+s";
+    array_data->buffers = {nullptr};
+    for (const auto& column : columns) {
+        auto child_schema = new ArrowSchema();
+        auto child_array = new ArrowArray();
+        ExportColumn(column, child_schema, child_array);
+        schema_data->children.push_back(child_schema);
+        array_data->children.push_back(child_array);
+    }
+    FillSchema(schema, schema_data.release());
+    FillArray(array, static_cast<int64_t>(row_count), array_data.release());
+    return Status::OK();
+}
+
+}  // namespace
+
+Status
+ExportArrow(const QueryResults& results, ArrowSchema* schema, ArrowArray* array) {
+    return ExportColumns(results.OutputFields(), schema, array);
+}
+
+Status
+ExportArrow(const SingleResult& result, ArrowSchema* schema, ArrowArray* array) {
+    std::vector<FieldDataPtr> columns;
+    const auto& ids = result.Ids();
+    if (ids.IsIntegerID()) {
+        columns.push_back(std::make_shared<Int64FieldData>("id", ids.IntIDArray()));
+    } else {
+        columns.push_back(std::make_shared<StringFieldData>("id", ids.StrIDArray()));
+    }
+    columns.push_back(std::make_shared<FloatFieldData>("score", result.Scores()));
+    columns.insert(columns.end(), result.OutputFields().begin(), result.OutputFields().end());
+    return ExportColumns(columns, schema, array);
+}
+
+}  // namespace milvus
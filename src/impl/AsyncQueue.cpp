@@ -0,0 +1,131 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AsyncQueue.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "ThreadAffinity.h"
+
+namespace milvus {
+
+namespace {
+
+class AsyncCallHandle : public AsyncHandle {
+ public:
+    explicit AsyncCallHandle(const std::shared_ptr<AsyncCall>& call) : call_(call) {
+    }
+
+    void
+    Cancel() override {
+        auto call = call_.lock();
+        if (call != nullptr) {
+            call->Cancel();
+        }
+    }
+
+ private:
+    std::weak_ptr<AsyncCall> call_;
+};
+
+}  // namespace
+
+std::shared_ptr<AsyncQueue>
+AsyncQueue::Create(size_t thread_count, const std::vector<int>& cpus) {
+    std::shared_ptr<AsyncQueue> queue(new AsyncQueue());
+    // the threads keep the queue alive until it is drained, even if one is detached by Shutdown()
+    for (size_t i = 0; i < std::max<size_t>(1, thread_count); ++i) {
+        queue->threads_.emplace_back([queue, cpus] { queue->Poll(cpus); });
+    }
+    return queue;
+}
+
+AsyncQueue::~AsyncQueue() {
+    // the last reference may be dropped by a polling thread itself
+    for (auto& thread : threads_) {
+        if (thread.joinable()) {
+            thread.detach();
+        }
+    }
+}
+
+Status
+AsyncQueue::Start(const std::shared_ptr<AsyncCall>& call, std::shared_ptr<AsyncHandle>& handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (shutdown_) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+    pending_[call.get()] = call;
+    call->Start(&queue_);
+    handle = std::make_shared<AsyncCallHandle>(call);
+    return Status::OK();
+}
+
+void
+AsyncQueue::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (shutdown_) {
+            return;
+        }
+        shutdown_ = true;
+        for (auto& item : pending_) {
+            item.second->Cancel();
+        }
+    }
+
+    queue_.Shutdown();
+    for (auto& thread : threads_) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+}
+
+size_t
+AsyncQueue::PendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+}
+
+void
+AsyncQueue::Poll(const std::vector<int>& cpus) {
+    auto status = PinCurrentThread(cpus);
+    if (!status.IsOk()) {
+        std::cerr << status.Message() << std::endl;
+    }
+
+    void* tag = nullptr;
+    bool ok = false;
+    while (queue_.Next(&tag, &ok)) {
+        std::shared_ptr<AsyncCall> call;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = pending_.find(tag);
+            if (it == pending_.end()) {
+                continue;
+            }
+            call = std::move(it->second);
+            pending_.erase(it);
+        }
+        call->Complete();
+    }
+}
+
+}  // namespace milvus
@@ -0,0 +1,157 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/impl/codegen/async_unary_call.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "AdmissionController.h"
+#include "Async.h"
+#include "Status.h"
+
+namespace milvus {
+
+/**
+ * @brief State of one async unary call, owned by the AsyncQueue until it completes.
+ */
+class AsyncCall {
+ public:
+    virtual ~AsyncCall() = default;
+
+    /**
+     * @brief Send the request, the completion is tagged with this call.
+     */
+    virtual void
+    Start(::grpc::CompletionQueue* queue) = 0;
+
+    /**
+     * @brief Deliver the result, called once on the completion thread.
+     */
+    virtual void
+    Complete() = 0;
+
+    void
+    Cancel() {
+        context_.TryCancel();
+    }
+
+ protected:
+    ::grpc::ClientContext context_;
+};
+
+/**
+ * @brief Async unary call with a typed response, the admission is held until the call completes.
+ */
+template <typename Response>
+class TypedAsyncCall : public AsyncCall {
+ public:
+    using Reader = ::grpc::ClientAsyncResponseReader<Response>;
+    using Prepare = std::function<std::unique_ptr<Reader>(::grpc::ClientContext*, ::grpc::CompletionQueue*)>;
+    using Done = std::function<void(const Status&, Response&)>;
+
+    TypedAsyncCall(Prepare&& prepare, Done&& done, std::unique_ptr<AdmissionGuard>&& admission)
+        : prepare_(std::move(prepare)), done_(std::move(done)), admission_(std::move(admission)) {
+    }
+
+    void
+    Start(::grpc::CompletionQueue* queue) override {
+        reader_ = prepare_(&context_, queue);
+        prepare_ = nullptr;
+        reader_->StartCall();
+        reader_->Finish(&response_, &grpc_status_, this);
+    }
+
+    void
+    Complete() override {
+        Status status;
+        if (grpc_status_.error_code() == ::grpc::StatusCode::CANCELLED) {
+            status = Status(StatusCode::Cancelled, "Request is cancelled!");
+        } else if (!grpc_status_.ok()) {
+            status = Status(StatusCode::ServerFailed, grpc_status_.error_message());
+        }
+        if (admission_ != nullptr) {
+            admission_->SetSucceeded(grpc_status_.ok());
+            admission_.reset();
+        }
+
+        // release the captured state of the caller, the handle may keep this call alive
+        Done done = std::move(done_);
+        done(status, response_);
+    }
+
+ private:
+    Prepare prepare_;
+    Done done_;
+    std::unique_ptr<AdmissionGuard> admission_;
+    std::unique_ptr<Reader> reader_;
+    Response response_;
+    ::grpc::Status grpc_status_;
+};
+
+/**
+ * @brief Completion queue polled by a fixed number of threads, drives the async calls of a connection.
+ * Results are handed to the callers' done functions on those threads.
+ */
+class AsyncQueue {
+ public:
+    /**
+     * @brief Start the polling threads, each is pinned to cpus if it is not empty.
+     */
+    static std::shared_ptr<AsyncQueue>
+    Create(size_t thread_count, const std::vector<int>& cpus);
+
+    ~AsyncQueue();
+
+    /**
+     * @brief Start the call and return a handle to cancel it, fail if the queue is shut down.
+     */
+    Status
+    Start(const std::shared_ptr<AsyncCall>& call, std::shared_ptr<AsyncHandle>& handle);
+
+    /**
+     * @brief Cancel the calls in flight and wait until their done functions have returned. It doesn't wait when
+     * called from a done function.
+     */
+    void
+    Shutdown();
+
+    size_t
+    PendingCount() const;
+
+ private:
+    AsyncQueue() = default;
+
+    void
+    Poll(const std::vector<int>& cpus);
+
+ private:
+    ::grpc::CompletionQueue queue_;
+    std::vector<std::thread> threads_;
+    mutable std::mutex mutex_;
+    bool shutdown_ = false;
+    std::unordered_map<void*, std::shared_ptr<AsyncCall>> pending_;
+};
+
+}  // namespace milvus
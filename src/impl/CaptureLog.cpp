@@ -0,0 +1,267 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CaptureLog.h"
+
+#include <cstring>
+
+namespace milvus {
+
+namespace {
+
+void
+AppendVarint(std::string& buffer, uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+void
+AppendFixed64(std::string& buffer, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+}  // namespace
+
+Status
+CaptureWriter::Open(const CaptureConfig& config, std::shared_ptr<CaptureWriter>& writer) {
+    std::FILE* file = std::fopen(config.Path().c_str(), "ab");
+    if (file == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Failed to open capture log: " + config.Path());
+    }
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    writer.reset(new CaptureWriter(config, file, size > 0 ? static_cast<uint64_t>(size) : 0));
+    return Status::OK();
+}
+
+CaptureWriter::CaptureWriter(const CaptureConfig& config, std::FILE* file, uint64_t file_bytes)
+    : config_(config), file_(file), file_bytes_(file_bytes), last_time_(Clock::now()) {
+    auto wall_time = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
+    buffer_.push_back(kCaptureSessionTag);
+    buffer_.append(kCaptureMagic, kCaptureMagicLength);
+    AppendFixed64(buffer_, static_cast<uint64_t>(wall_time.count()));
+    std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+    file_bytes_ += buffer_.size();
+}
+
+CaptureWriter::~CaptureWriter() {
+    std::fclose(file_);
+}
+
+void
+CaptureWriter::Record(const char* method, const ::google::protobuf::MessageLite& request) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!Sample()) {
+        return;
+    }
+    Write(method, request.SerializeAsString());
+}
+
+void
+CaptureWriter::Record(const char* method, const ::grpc::ByteBuffer& request) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!Sample()) {
+        return;
+    }
+    std::vector<::grpc::Slice> slices;
+    std::string payload;
+    if (request.Dump(&slices).ok()) {
+        payload.reserve(request.Length());
+        for (const auto& slice : slices) {
+            payload.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+        }
+    }
+    Write(method, payload);
+}
+
+void
+CaptureWriter::Flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::fflush(file_);
+}
+
+uint64_t
+CaptureWriter::RecordCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return record_count_;
+}
+
+bool
+CaptureWriter::Sample() {
+    if (full_ || config_.SampleRatio() <= 0) {
+        return false;
+    }
+    if (config_.SampleRatio() >= 1) {
+        return true;
+    }
+    sample_credit_ += config_.SampleRatio();
+    if (sample_credit_ < 1) {
+        return false;
+    }
+    sample_credit_ -= 1;
+    return true;
+}
+
+void
+CaptureWriter::Write(const char* method, const std::string& payload) {
+    buffer_.clear();
+    auto it = method_ids_.find(method);
+    const bool new_method = it == method_ids_.end();
+    const uint64_t method_id = new_method ? method_ids_.size() : it->second;
+    if (new_method) {
+        const size_t length = std::strlen(method);
+        buffer_.push_back(kCaptureMethodTag);
+        AppendVarint(buffer_, method_id);
+        AppendVarint(buffer_, length);
+        buffer_.append(method, length);
+    }
+
+    auto now = Clock::now();
+    auto delta = std::chrono::duration_cast<std::chrono::microseconds>(now - last_time_).count();
+    buffer_.push_back(kCaptureRequestTag);
+    AppendVarint(buffer_, method_id);
+    AppendVarint(buffer_, delta > 0 ? static_cast<uint64_t>(delta) : 0);
+    AppendVarint(buffer_, payload.size());
+    buffer_.append(payload);
+
+    if (config_.MaxFileBytes() > 0 && file_bytes_ + buffer_.size() > config_.MaxFileBytes()) {
+        full_ = true;
+        return;
+    }
+    if (new_method) {
+        method_ids_.emplace(method, method_id);
+    }
+    last_time_ = now;
+    std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+    file_bytes_ += buffer_.size();
+    ++record_count_;
+}
+
+CaptureLogReader::~CaptureLogReader() {
+    if (file_ != nullptr) {
+        std::fclose(file_);
+    }
+}
+
+Status
+CaptureLogReader::Open(const std::string& path) {
+    file_ = std::fopen(path.c_str(), "rb");
+    if (file_ == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Failed to open capture log: " + path);
+    }
+    return Status::OK();
+}
+
+Status
+CaptureLogReader::Next(CaptureRecord& record, bool& end) {
+    end = false;
+    if (file_ == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Capture log is not open!");
+    }
+
+    const Status corrupted(StatusCode::UnknownError, "Capture log is corrupted!");
+    while (true) {
+        int tag = std::fgetc(file_);
+        if (tag == EOF) {
+            end = true;
+            return Status::OK();
+        }
+
+        if (tag == kCaptureSessionTag) {
+            std::string header;
+            if (!ReadBytes(kCaptureMagicLength + 8, header) ||
+                header.compare(0, kCaptureMagicLength, kCaptureMagic) != 0) {
+                return corrupted;
+            }
+            methods_.clear();
+        } else if (tag == kCaptureMethodTag) {
+            uint64_t method_id = 0;
+            uint64_t length = 0;
+            std::string name;
+            if (!ReadVarint(method_id) || method_id != methods_.size() || !ReadVarint(length) ||
+                !ReadBytes(length, name)) {
+                return corrupted;
+            }
+            methods_.emplace_back(std::move(name));
+        } else if (tag == kCaptureRequestTag) {
+            uint64_t method_id = 0;
+            uint64_t delta = 0;
+            uint64_t length = 0;
+            if (!ReadVarint(method_id) || method_id >= methods_.size() || !ReadVarint(delta) || !ReadVarint(length) ||
+                !ReadBytes(length, record.Payload())) {
+                return corrupted;
+            }
+            offset_us_ += delta;
+            record.SetMethod(methods_[method_id]);
+            record.SetOffsetUs(offset_us_);
+            return Status::OK();
+        } else {
+            return corrupted;
+        }
+    }
+}
+
+bool
+CaptureLogReader::ReadVarint(uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        int byte = std::fgetc(file_);
+        if (byte == EOF) {
+            return false;
+        }
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+CaptureLogReader::ReadBytes(size_t length, std::string& bytes) {
+    // gRPC messages are limited to 2GB, a larger length comes from a corrupted log
+    if (length > (1ULL << 31)) {
+        return false;
+    }
+    bytes.resize(length);
+    return length == 0 || std::fread(&bytes[0], 1, length, file_) == length;
+}
+
+CaptureReader::CaptureReader() = default;
+
+CaptureReader::~CaptureReader() = default;
+
+Status
+CaptureReader::Open(const std::string& path) {
+    reader_.reset(new CaptureLogReader());
+    return reader_->Open(path);
+}
+
+Status
+CaptureReader::Next(CaptureRecord& record, bool& end) {
+    if (reader_ == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Capture log is not open!");
+    }
+    return reader_->Next(record, end);
+}
+
+}  // namespace milvus
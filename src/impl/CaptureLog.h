@@ -0,0 +1,126 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <google/protobuf/message_lite.h>
+#include <grpcpp/support/byte_buffer.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Capture.h"
+#include "Status.h"
+#include "types/CaptureConfig.h"
+
+namespace milvus {
+
+/**
+ * @brief Capture log format, a sequence of records each starting with a tag byte, integers are varints:
+ *   'H' session header: magic "MVSCAP1", wall clock start in microseconds as little-endian fixed64
+ *   'M' method definition: method id, name length, name
+ *   'R' request: method id, microseconds since the previous request of the session, payload length, payload
+ * Method ids are assigned in order of first use and are valid within a session.
+ */
+constexpr char kCaptureSessionTag = 'H';
+constexpr char kCaptureMethodTag = 'M';
+constexpr char kCaptureRequestTag = 'R';
+constexpr char kCaptureMagic[] = "MVSCAP1";
+constexpr size_t kCaptureMagicLength = sizeof(kCaptureMagic) - 1;
+
+/**
+ * @brief Append-only writer of a capture log, thread safe.
+ */
+class CaptureWriter {
+ public:
+    using Clock = std::chrono::steady_clock;
+
+    static Status
+    Open(const CaptureConfig& config, std::shared_ptr<CaptureWriter>& writer);
+
+    ~CaptureWriter();
+
+    CaptureWriter(const CaptureWriter&) = delete;
+    CaptureWriter&
+    operator=(const CaptureWriter&) = delete;
+
+    void
+    Record(const char* method, const ::google::protobuf::MessageLite& request);
+
+    void
+    Record(const char* method, const ::grpc::ByteBuffer& request);
+
+    void
+    Flush();
+
+    uint64_t
+    RecordCount() const;
+
+ private:
+    CaptureWriter(const CaptureConfig& config, std::FILE* file, uint64_t file_bytes);
+
+    /**
+     * @brief Decide whether the next request is recorded, must be called with mutex_ held.
+     */
+    bool
+    Sample();
+
+    void
+    Write(const char* method, const std::string& payload);
+
+ private:
+    const CaptureConfig config_;
+    mutable std::mutex mutex_;
+    std::FILE* file_ = nullptr;
+    uint64_t file_bytes_ = 0;
+    double sample_credit_ = 0;
+    uint64_t record_count_ = 0;
+    bool full_ = false;
+    Clock::time_point last_time_;
+    std::unordered_map<std::string, uint64_t> method_ids_;
+    std::string buffer_;
+};
+
+class CaptureLogReader {
+ public:
+    ~CaptureLogReader();
+
+    Status
+    Open(const std::string& path);
+
+    Status
+    Next(CaptureRecord& record, bool& end);
+
+ private:
+    bool
+    ReadVarint(uint64_t& value);
+
+    bool
+    ReadBytes(size_t length, std::string& bytes);
+
+ private:
+    std::FILE* file_ = nullptr;
+    std::vector<std::string> methods_;
+    // sessions continue the timeline of the previous one
+    uint64_t offset_us_ = 0;
+};
+
+}  // namespace milvus
@@ -0,0 +1,181 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpcpp/impl/codegen/client_unary_call.h>
+#include <grpcpp/impl/codegen/rpc_method.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <thread>
+
+#include "Capture.h"
+#include "ChannelRegistry.h"
+
+namespace milvus {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct ReplayTask {
+    ReplayTask(const ::grpc::internal::RpcMethod* method, Clock::time_point scheduled, std::string&& payload)
+        : method_(method), scheduled_(scheduled), payload_(std::move(payload)) {
+    }
+
+    const ::grpc::internal::RpcMethod* method_;
+    Clock::time_point scheduled_;
+    std::string payload_;
+};
+
+/**
+ * @brief Requests scheduled by the reader and sent by the workers, bounded so a fast replay doesn't load the
+ * whole log into memory.
+ */
+class ReplayQueue {
+ public:
+    explicit ReplayQueue(size_t capacity) : capacity_(capacity) {
+    }
+
+    void
+    Push(ReplayTask&& task) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] { return tasks_.size() < capacity_; });
+        tasks_.emplace_back(std::move(task));
+        not_empty_.notify_one();
+    }
+
+    bool
+    Pop(ReplayTask& task) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this] { return !tasks_.empty() || closed_; });
+        if (tasks_.empty()) {
+            return false;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+        not_full_.notify_one();
+        return true;
+    }
+
+    void
+    Close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_empty_.notify_all();
+    }
+
+ private:
+    const size_t capacity_;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    std::deque<ReplayTask> tasks_;
+    bool closed_ = false;
+};
+
+}  // namespace
+
+Status
+ReplayCapture(const std::string& path, const std::string& host, uint16_t port, const ReplayOptions& options,
+              ReplayStats& stats) {
+    CaptureReader reader;
+    auto status = reader.Open(path);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    ChannelArgs args;
+    args.SetInt(GRPC_ARG_MAX_SEND_MESSAGE_LENGTH, -1);
+    args.SetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, -1);
+    auto channel = CreateChannel(host + ":" + std::to_string(port), args);
+    if (channel == nullptr) {
+        return Status(StatusCode::NotConnected, "Failed to connect uri: " + host + ":" + std::to_string(port));
+    }
+
+    const size_t thread_count = std::max<uint32_t>(1, options.Threads());
+    ReplayQueue queue(thread_count * 16);
+    std::mutex stats_mutex;
+    uint64_t requests = 0;
+    uint64_t failures = 0;
+    Clock::duration max_lag = Clock::duration::zero();
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < thread_count; ++i) {
+        workers.emplace_back([&] {
+            ReplayTask task(nullptr, Clock::time_point(), std::string());
+            while (queue.Pop(task)) {
+                auto lag = Clock::now() - task.scheduled_;
+                ::grpc::Slice slice(task.payload_);
+                ::grpc::ByteBuffer request(&slice, 1);
+                ::grpc::ByteBuffer response;
+                ::grpc::ClientContext context;
+                auto grpc_status = ::grpc::internal::BlockingUnaryCall<::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+                    channel.get(), *task.method_, &context, request, &response);
+
+                std::lock_guard<std::mutex> lock(stats_mutex);
+                ++requests;
+                if (!grpc_status.ok()) {
+                    ++failures;
+                }
+                max_lag = std::max(max_lag, lag);
+            }
+        });
+    }
+
+    // methods are registered on the channel once and outlive the workers
+    std::map<std::string, std::unique_ptr<::grpc::internal::RpcMethod>> methods;
+    const auto start = Clock::now();
+    CaptureRecord record;
+    while (true) {
+        bool end = false;
+        status = reader.Next(record, end);
+        if (!status.IsOk() || end) {
+            break;
+        }
+
+        auto it = methods.find(record.Method());
+        if (it == methods.end()) {
+            it = methods.emplace(record.Method(), nullptr).first;
+            // RpcMethod keeps the name pointer, the key of the map is stable
+            it->second.reset(new ::grpc::internal::RpcMethod(it->first.c_str(), ::grpc::internal::RpcMethod::NORMAL_RPC,
+                                                             channel));
+        }
+        auto scheduled = start;
+        if (options.Speed() > 0) {
+            auto offset = std::chrono::duration<double, std::micro>(record.OffsetUs() / options.Speed());
+            scheduled += std::chrono::duration_cast<Clock::duration>(offset);
+            std::this_thread::sleep_until(scheduled);
+        } else {
+            scheduled = Clock::now();
+        }
+        queue.Push(ReplayTask(it->second.get(), scheduled, std::move(record.Payload())));
+    }
+
+    queue.Close();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    stats.SetRequests(requests);
+    stats.SetFailures(failures);
+    stats.SetElapsedMs(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count());
+    stats.SetMaxLagMs(std::chrono::duration_cast<std::chrono::milliseconds>(max_lag).count());
+    return status;
+}
+
+}  // namespace milvus
@@ -0,0 +1,170 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ChannelRegistry.h"
+
+#include <grpcpp/create_channel.h>
+#include <grpcpp/resource_quota.h>
+#include <grpcpp/security/credentials.h>
+
+#include <thread>
+
+namespace milvus {
+
+std::string
+ChannelArgs::Key(const std::string& target) const {
+    // '\n' doesn't appear in targets or argument names
+    std::string key = target;
+    for (const auto& arg : int_args_) {
+        key.append("\n").append(arg.first).append("=").append(std::to_string(arg.second));
+    }
+    for (const auto& arg : string_args_) {
+        key.append("\n").append(arg.first).append("=\"").append(arg.second).append("\"");
+    }
+    if (quota_max_threads_ > 0 || quota_memory_bytes_ > 0) {
+        key.append("\nresource_quota=").append(std::to_string(quota_max_threads_));
+        key.append("/").append(std::to_string(quota_memory_bytes_));
+    }
+    return key;
+}
+
+::grpc::ChannelArguments
+ChannelArgs::ToChannelArguments() const {
+    ::grpc::ChannelArguments arguments;
+    for (const auto& arg : int_args_) {
+        arguments.SetInt(arg.first, arg.second);
+    }
+    for (const auto& arg : string_args_) {
+        arguments.SetString(arg.first, arg.second);
+    }
+    if (quota_max_threads_ > 0 || quota_memory_bytes_ > 0) {
+        ::grpc::ResourceQuota quota("milvus_sdk");
+        if (quota_max_threads_ > 0) {
+            quota.SetMaxThreads(static_cast<int>(quota_max_threads_));
+        }
+        if (quota_memory_bytes_ > 0) {
+            quota.Resize(quota_memory_bytes_);
+        }
+        arguments.SetResourceQuota(quota);
+    }
+    return arguments;
+}
+
+std::shared_ptr<::grpc::Channel>
+CreateChannel(const std::string& target, const ChannelArgs& args) {
+    return ::grpc::CreateCustomChannel(target, ::grpc::InsecureChannelCredentials(), args.ToChannelArguments());
+}
+
+ChannelRegistry&
+ChannelRegistry::Instance() {
+    // never destroyed, leases held by static clients may be released during static destruction
+    static auto registry = new ChannelRegistry(true);
+    return *registry;
+}
+
+std::shared_ptr<::grpc::Channel>
+ChannelRegistry::Acquire(const std::string& target, const ChannelArgs& args, std::chrono::milliseconds idle_timeout) {
+    const auto key = args.Key(target);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& entry = channels_[key];
+    if (entry.channel_ == nullptr) {
+        entry.channel_ = CreateChannel(target, args);
+        if (entry.channel_ == nullptr) {
+            channels_.erase(key);
+            return nullptr;
+        }
+    }
+    ++entry.leases_;
+    entry.idle_timeout_ = idle_timeout;
+
+    // the lease shares the channel pointer, its deleter only returns the lease to the registry
+    auto channel = entry.channel_;
+    return std::shared_ptr<::grpc::Channel>(channel.get(), [this, key, channel](::grpc::Channel*) { Release(key); });
+}
+
+size_t
+ChannelRegistry::ChannelCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return channels_.size();
+}
+
+void
+ChannelRegistry::CloseExpired() {
+    // declared before the lock, so the channels are destroyed after unlocking
+    std::vector<std::shared_ptr<::grpc::Channel>> closed;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto next_expiry = Clock::time_point::max();
+    CloseExpiredLocked(Clock::now(), next_expiry, closed);
+}
+
+void
+ChannelRegistry::Release(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = channels_.find(key);
+    if (iter == channels_.end() || --iter->second.leases_ > 0) {
+        return;
+    }
+
+    iter->second.idle_since_ = Clock::now();
+    if (background_reaper_ && !reaper_started_) {
+        reaper_started_ = true;
+        std::thread(&ChannelRegistry::Reap, this).detach();
+    }
+    cond_.notify_one();
+}
+
+void
+ChannelRegistry::CloseExpiredLocked(Clock::time_point now, Clock::time_point& next_expiry,
+                                    std::vector<std::shared_ptr<::grpc::Channel>>& closed) {
+    for (auto iter = channels_.begin(); iter != channels_.end();) {
+        const auto& entry = iter->second;
+        if (entry.leases_ > 0) {
+            ++iter;
+            continue;
+        }
+        const auto expiry = entry.idle_since_ + entry.idle_timeout_;
+        if (expiry <= now) {
+            closed.emplace_back(std::move(iter->second.channel_));
+            iter = channels_.erase(iter);
+        } else {
+            next_expiry = std::min(next_expiry, expiry);
+            ++iter;
+        }
+    }
+}
+
+void
+ChannelRegistry::Reap() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        std::vector<std::shared_ptr<::grpc::Channel>> closed;
+        auto next_expiry = Clock::time_point::max();
+        CloseExpiredLocked(Clock::now(), next_expiry, closed);
+        if (!closed.empty()) {
+            lock.unlock();
+            closed.clear();
+            lock.lock();
+            continue;
+        }
+        if (next_expiry == Clock::time_point::max()) {
+            cond_.wait(lock);
+        } else {
+            cond_.wait_until(lock, next_expiry);
+        }
+    }
+}
+
+}  // namespace milvus
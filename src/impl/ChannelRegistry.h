@@ -0,0 +1,151 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <grpcpp/channel.h>
+#include <grpcpp/support/channel_arguments.h>
+
+#include <chrono>
+#include <cstdint>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Channel arguments that can be compared, channels are shared only if target and arguments are identical.
+ */
+class ChannelArgs {
+ public:
+    void
+    SetInt(const std::string& name, int value) {
+        int_args_[name] = value;
+    }
+
+    void
+    SetString(const std::string& name, const std::string& value) {
+        string_args_[name] = value;
+    }
+
+    /**
+     * @brief Give the channel its own gRPC resource quota, 0 means no limit.
+     */
+    void
+    SetResourceQuota(uint32_t max_threads, uint64_t memory_bytes) {
+        quota_max_threads_ = max_threads;
+        quota_memory_bytes_ = memory_bytes;
+    }
+
+    /**
+     * @brief Key of the channel, built from the target and all arguments in name order.
+     */
+    std::string
+    Key(const std::string& target) const;
+
+    ::grpc::ChannelArguments
+    ToChannelArguments() const;
+
+ private:
+    std::map<std::string, int> int_args_;
+    std::map<std::string, std::string> string_args_;
+    uint32_t quota_max_threads_ = 0;
+    uint64_t quota_memory_bytes_ = 0;
+};
+
+/**
+ * @brief Create a channel that is not shared.
+ */
+std::shared_ptr<::grpc::Channel>
+CreateChannel(const std::string& target, const ChannelArgs& args);
+
+/**
+ * @brief Process-wide registry of channels shared by all clients.
+ *
+ * Acquire() returns a lease on the channel of the same target and arguments, creating it if needed. The lease is a
+ * shared_ptr that can be copied freely, the channel becomes idle when the last copy is destroyed and is closed after
+ * the idle timeout unless it is acquired again.
+ */
+class ChannelRegistry {
+ public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief With background_reaper, a thread closes expired channels, otherwise call CloseExpired().
+     */
+    explicit ChannelRegistry(bool background_reaper) : background_reaper_(background_reaper) {
+    }
+
+    static ChannelRegistry&
+    Instance();
+
+    /**
+     * @brief Get a lease on a shared channel.
+     *
+     * @param [in] target endpoint, for example "localhost:19530"
+     * @param [in] args channel arguments
+     * @param [in] idle_timeout time an idle channel is kept, the latest value of a channel applies
+     */
+    std::shared_ptr<::grpc::Channel>
+    Acquire(const std::string& target, const ChannelArgs& args, std::chrono::milliseconds idle_timeout);
+
+    /**
+     * @brief Number of open channels, including idle ones.
+     */
+    size_t
+    ChannelCount() const;
+
+    /**
+     * @brief Close idle channels whose timeout has expired.
+     */
+    void
+    CloseExpired();
+
+ private:
+    struct Entry {
+        std::shared_ptr<::grpc::Channel> channel_;
+        size_t leases_ = 0;
+        std::chrono::milliseconds idle_timeout_{0};
+        Clock::time_point idle_since_;
+    };
+
+    void
+    Release(const std::string& key);
+
+    /**
+     * @brief Move expired channels into closed, they are destroyed after the mutex is unlocked.
+     */
+    void
+    CloseExpiredLocked(Clock::time_point now, Clock::time_point& next_expiry,
+                       std::vector<std::shared_ptr<::grpc::Channel>>& closed);
+
+    void
+    Reap();
+
+ private:
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    std::unordered_map<std::string, Entry> channels_;
+    const bool background_reaper_;
+    bool reaper_started_ = false;
+};
+
+}  // namespace milvus
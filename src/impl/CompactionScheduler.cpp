@@ -0,0 +1,296 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CompactionScheduler.h"
+
+#include <algorithm>
+#include <ctime>
+
+namespace milvus {
+
+namespace {
+
+/**
+ * @brief Reports kept after their compactions are completed.
+ */
+constexpr size_t kMaxReports = 64;
+
+/**
+ * @brief Days since 1970-01-01 of a civil date, for any year.
+ */
+int64_t
+DaysFromCivil(int64_t year, int64_t month, int64_t day) {
+    year -= month <= 2 ? 1 : 0;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t year_of_era = year - era * 400;
+    const int64_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+int64_t
+ToMilliseconds(CompactionScheduler::Clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+}
+
+}  // namespace
+
+SegmentSummary
+SummarizeSegments(const std::vector<SegmentInfo>& segments, int64_t small_segment_rows) {
+    SegmentSummary summary;
+    for (const auto& segment : segments) {
+        // growing segments are not compacted, dropped ones are gone
+        const auto state = segment.State();
+        if (state != SegmentState::SEALED && state != SegmentState::FLUSHED && state != SegmentState::FLUSHING) {
+            continue;
+        }
+        ++summary.segment_count_;
+        summary.row_count_ += segment.RowCount();
+        if (segment.RowCount() < small_segment_rows) {
+            ++summary.small_segment_count_;
+        }
+    }
+    return summary;
+}
+
+std::string
+AdviseCompaction(const CompactionConfig& config, const SegmentSummary& summary, int64_t deleted_rows) {
+    if (deleted_rows > 0 && summary.row_count_ > 0 &&
+        static_cast<double>(deleted_rows) >= config.DeleteRatio() * static_cast<double>(summary.row_count_)) {
+        const int64_t percent = deleted_rows * 100 / summary.row_count_;
+        return "deleted rows " + std::to_string(percent) + "% of " + std::to_string(summary.row_count_);
+    }
+    if (config.SmallSegmentCount() > 0 && summary.small_segment_count_ >= config.SmallSegmentCount()) {
+        return std::to_string(summary.small_segment_count_) + " segments smaller than " +
+               std::to_string(config.SmallSegmentRows()) + " rows";
+    }
+    return std::string();
+}
+
+int64_t
+MaintenanceWindow(const CompactionConfig& config, int64_t day, uint32_t minute) {
+    const uint32_t start = config.WindowStartMinute();
+    const uint32_t end = config.WindowEndMinute();
+    if (start == end) {
+        return day;
+    }
+    if (start < end) {
+        return (minute >= start && minute < end) ? day : -1;
+    }
+    // wraps midnight: the part after midnight belongs to the window started the day before
+    if (minute >= start) {
+        return day;
+    }
+    return minute < end ? day - 1 : -1;
+}
+
+CompactionScheduler::CompactionScheduler(const CompactionConfig& config, ListSegments list_segments,
+                                         Compact compact, GetProgress get_progress)
+    : config_(config),
+      list_segments_(std::move(list_segments)),
+      compact_(std::move(compact)),
+      get_progress_(std::move(get_progress)) {
+}
+
+CompactionScheduler::~CompactionScheduler() {
+    Stop();
+}
+
+void
+CompactionScheduler::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!thread_.joinable()) {
+        stopping_ = false;
+        thread_ = std::thread(&CompactionScheduler::Run, this);
+    }
+}
+
+void
+CompactionScheduler::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cond_.notify_all();
+    if (thread_.joinable() && thread_.get_id() != std::this_thread::get_id()) {
+        thread_.join();
+    }
+}
+
+void
+CompactionScheduler::RecordMutation(const std::string& collection_name, int64_t inserted_rows,
+                                    int64_t deleted_rows) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& history = histories_[collection_name];
+    history.inserted_rows_ += inserted_rows;
+    history.deleted_rows_ += deleted_rows;
+}
+
+void
+CompactionScheduler::Check(Clock::time_point now) {
+    const std::time_t time = Clock::to_time_t(now);
+    std::tm local{};
+    localtime_r(&time, &local);
+    const int64_t day = DaysFromCivil(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
+    const auto minute = static_cast<uint32_t>(local.tm_hour * 60 + local.tm_min);
+    const int64_t window = MaintenanceWindow(config_, day, minute);
+    if (window < 0) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (window != window_) {
+            window_ = window;
+            window_started_ = 0;
+        }
+    }
+
+    for (const auto& collection_name : config_.Collections()) {
+        int64_t deleted_rows = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (window_started_ >= config_.Budget()) {
+                return;
+            }
+            auto& history = histories_[collection_name];
+            if (history.compacting_) {
+                continue;
+            }
+            deleted_rows = history.deleted_rows_;
+        }
+
+        std::vector<SegmentInfo> segments;
+        if (!list_segments_(collection_name, segments).IsOk()) {
+            continue;
+        }
+        const auto summary = SummarizeSegments(segments, config_.SmallSegmentRows());
+        const auto reason = AdviseCompaction(config_, summary, deleted_rows);
+        if (reason.empty()) {
+            continue;
+        }
+
+        int64_t compaction_id = 0;
+        if (!compact_(collection_name, compaction_id).IsOk()) {
+            continue;
+        }
+
+        CompactionReport report;
+        report.SetCollectionName(collection_name);
+        report.SetCompactionID(compaction_id);
+        report.SetReason(reason);
+        report.SetState(CompactionState::EXECUTING);
+        report.SetBefore(summary);
+        report.SetStartTimeMs(ToMilliseconds(now));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& history = histories_[collection_name];
+        history.compacting_ = true;
+        history.compacting_deleted_rows_ = deleted_rows;
+        ++window_started_;
+        AddReport(report);
+    }
+}
+
+void
+CompactionScheduler::Poll(Clock::time_point now) {
+    std::vector<CompactionReport> running;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& report : reports_) {
+            if (report.State() == CompactionState::EXECUTING) {
+                running.push_back(report);
+            }
+        }
+    }
+
+    for (auto& report : running) {
+        CompactionProgress progress;
+        if (!get_progress_(report.CompactionID(), progress).IsOk() ||
+            progress.State() == CompactionState::EXECUTING) {
+            continue;
+        }
+
+        // a compaction unknown to the server is not followed anymore, its deletes are counted again
+        const bool completed = progress.State() == CompactionState::COMPLETED;
+        std::vector<SegmentInfo> segments;
+        if (completed && list_segments_(report.CollectionName(), segments).IsOk()) {
+            report.SetAfter(SummarizeSegments(segments, config_.SmallSegmentRows()));
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& kept : reports_) {
+            if (kept.CompactionID() == report.CompactionID()) {
+                kept.SetState(progress.State());
+                kept.SetAfter(report.After());
+                kept.SetEndTimeMs(ToMilliseconds(now));
+            }
+        }
+        auto& history = histories_[report.CollectionName()];
+        if (completed) {
+            history.deleted_rows_ = std::max<int64_t>(history.deleted_rows_ - history.compacting_deleted_rows_, 0);
+        }
+        history.compacting_deleted_rows_ = 0;
+        history.compacting_ = false;
+    }
+}
+
+std::vector<CompactionReport>
+CompactionScheduler::Reports() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::vector<CompactionReport>(reports_.begin(), reports_.end());
+}
+
+void
+CompactionScheduler::AddReport(const CompactionReport& report) {
+    reports_.push_back(report);
+    // drop the oldest finished reports, running ones are still followed
+    for (auto iter = reports_.begin(); reports_.size() > kMaxReports && iter != reports_.end();) {
+        if (iter->State() != CompactionState::EXECUTING) {
+            iter = reports_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void
+CompactionScheduler::Run() {
+    const std::chrono::milliseconds check_interval(config_.CheckIntervalMs());
+    const std::chrono::milliseconds poll_interval(config_.PollIntervalMs());
+    auto next_check = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        lock.unlock();
+        auto now = std::chrono::steady_clock::now();
+        if (now >= next_check) {
+            Check(Clock::now());
+            next_check = now + check_interval;
+        }
+        Poll(Clock::now());
+        lock.lock();
+
+        bool running = false;
+        for (const auto& pair : histories_) {
+            running = running || pair.second.compacting_;
+        }
+        auto wake = running ? std::min(next_check, now + poll_interval) : next_check;
+        cond_.wait_until(lock, wake, [this] { return stopping_; });
+    }
+}
+
+}  // namespace milvus
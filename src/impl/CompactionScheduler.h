@@ -0,0 +1,142 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Status.h"
+#include "types/CompactionConfig.h"
+#include "types/CompactionProgress.h"
+#include "types/CompactionReport.h"
+#include "types/SegmentInfo.h"
+
+namespace milvus {
+
+/**
+ * @brief Count the flushed and sealed segments, their rows and the segments smaller than small_segment_rows.
+ */
+SegmentSummary
+SummarizeSegments(const std::vector<SegmentInfo>& segments, int64_t small_segment_rows);
+
+/**
+ * @brief Reason to compact a collection, empty if it needs no compaction.
+ *
+ * @param [in] config thresholds
+ * @param [in] summary segments of the collection
+ * @param [in] deleted_rows rows deleted since the last compaction
+ */
+std::string
+AdviseCompaction(const CompactionConfig& config, const SegmentSummary& summary, int64_t deleted_rows);
+
+/**
+ * @brief Index of the maintenance window containing minute of day, -1 if outside the window. Windows are numbered
+ * by the day they start on, so a window wrapping midnight keeps one index.
+ */
+int64_t
+MaintenanceWindow(const CompactionConfig& config, int64_t day, uint32_t minute);
+
+/**
+ * @brief Watch the segments of collections and start compactions, see CompactionConfig.
+ *
+ * The server is reached through the callbacks, a background thread created by Start() calls Check() and Poll() on
+ * their intervals. It is thread safe.
+ */
+class CompactionScheduler {
+ public:
+    using ListSegments = std::function<Status(const std::string& collection_name, std::vector<SegmentInfo>&)>;
+    using Compact = std::function<Status(const std::string& collection_name, int64_t& compaction_id)>;
+    using GetProgress = std::function<Status(int64_t compaction_id, CompactionProgress&)>;
+    using Clock = std::chrono::system_clock;
+
+    CompactionScheduler(const CompactionConfig& config, ListSegments list_segments, Compact compact,
+                        GetProgress get_progress);
+
+    ~CompactionScheduler();
+
+    void
+    Start();
+
+    void
+    Stop();
+
+    /**
+     * @brief Count the rows inserted and deleted through this client.
+     */
+    void
+    RecordMutation(const std::string& collection_name, int64_t inserted_rows, int64_t deleted_rows);
+
+    /**
+     * @brief Read the segments of the watched collections and start the compactions they need, if now is inside
+     * the maintenance window and the budget of the window is not spent.
+     */
+    void
+    Check(Clock::time_point now);
+
+    /**
+     * @brief Follow the running compactions, a completed one is reported with the segments after it.
+     */
+    void
+    Poll(Clock::time_point now);
+
+    /**
+     * @brief Running compactions and the last completed ones, oldest first.
+     */
+    std::vector<CompactionReport>
+    Reports() const;
+
+ private:
+    struct History {
+        int64_t inserted_rows_ = 0;
+        int64_t deleted_rows_ = 0;
+        // deleted rows counted when the running compaction started, they are cleaned once it completes
+        int64_t compacting_deleted_rows_ = 0;
+        bool compacting_ = false;
+    };
+
+    void
+    Run();
+
+    void
+    AddReport(const CompactionReport& report);
+
+ private:
+    const CompactionConfig config_;
+    const ListSegments list_segments_;
+    const Compact compact_;
+    const GetProgress get_progress_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, History> histories_;
+    std::deque<CompactionReport> reports_;
+    int64_t window_ = -1;
+    uint32_t window_started_ = 0;
+
+    std::condition_variable cond_;
+    bool stopping_ = false;
+    std::thread thread_;
+};
+
+}  // namespace milvus
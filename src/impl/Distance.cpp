@@ -0,0 +1,188 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Distance.h"
+
+#include <cstring>
+
+#if defined(__SSE__)
+#include <immintrin.h>
+#endif
+
+namespace milvus {
+
+namespace {
+
+#if defined(__SSE__)
+float
+HorizontalSum(__m128 sum) {
+    // (s0 + s2, s1 + s3, ...) then (s0 + s2) + (s1 + s3)
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+}
+#endif
+
+#if defined(__AVX__)
+float
+HorizontalSum(__m256 sum) {
+    return HorizontalSum(_mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1)));
+}
+#endif
+
+uint64_t
+LoadWord(const uint8_t* data) {
+    uint64_t word = 0;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+int
+PopCount(uint64_t word) {
+    return __builtin_popcountll(word);
+}
+
+float
+L2SqrRow(const void* a, const void* b, size_t dimension) {
+    return L2Sqr(static_cast<const float*>(a), static_cast<const float*>(b), dimension);
+}
+
+float
+InnerProductRow(const void* a, const void* b, size_t dimension) {
+    return InnerProduct(static_cast<const float*>(a), static_cast<const float*>(b), dimension);
+}
+
+float
+HammingRow(const void* a, const void* b, size_t dimension) {
+    return Hamming(static_cast<const uint8_t*>(a), static_cast<const uint8_t*>(b), dimension / 8);
+}
+
+float
+JaccardRow(const void* a, const void* b, size_t dimension) {
+    return Jaccard(static_cast<const uint8_t*>(a), static_cast<const uint8_t*>(b), dimension / 8);
+}
+
+}  // namespace
+
+float
+L2Sqr(const float* a, const float* b, size_t dimension) {
+    size_t i = 0;
+    float result = 0;
+#if defined(__AVX__)
+    __m256 sum8 = _mm256_setzero_ps();
+    for (; i + 8 <= dimension; i += 8) {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+        sum8 = _mm256_add_ps(sum8, _mm256_mul_ps(diff, diff));
+    }
+    result += HorizontalSum(sum8);
+#endif
+#if defined(__SSE__)
+    __m128 sum4 = _mm_setzero_ps();
+    for (; i + 4 <= dimension; i += 4) {
+        __m128 diff = _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+        sum4 = _mm_add_ps(sum4, _mm_mul_ps(diff, diff));
+    }
+    result += HorizontalSum(sum4);
+#endif
+    for (; i < dimension; ++i) {
+        float diff = a[i] - b[i];
+        result += diff * diff;
+    }
+    return result;
+}
+
+float
+InnerProduct(const float* a, const float* b, size_t dimension) {
+    size_t i = 0;
+    float result = 0;
+#if defined(__AVX__)
+    __m256 sum8 = _mm256_setzero_ps();
+    for (; i + 8 <= dimension; i += 8) {
+        sum8 = _mm256_add_ps(sum8, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    result += HorizontalSum(sum8);
+#endif
+#if defined(__SSE__)
+    __m128 sum4 = _mm_setzero_ps();
+    for (; i + 4 <= dimension; i += 4) {
+        sum4 = _mm_add_ps(sum4, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    result += HorizontalSum(sum4);
+#endif
+    for (; i < dimension; ++i) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+float
+Hamming(const uint8_t* a, const uint8_t* b, size_t bytes) {
+    size_t i = 0;
+    int count = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        count += PopCount(LoadWord(a + i) ^ LoadWord(b + i));
+    }
+    for (; i < bytes; ++i) {
+        count += PopCount(a[i] ^ b[i]);
+    }
+    return static_cast<float>(count);
+}
+
+float
+Jaccard(const uint8_t* a, const uint8_t* b, size_t bytes) {
+    size_t i = 0;
+    int intersection = 0;
+    int union_count = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        uint64_t x = LoadWord(a + i);
+        uint64_t y = LoadWord(b + i);
+        intersection += PopCount(x & y);
+        union_count += PopCount(x | y);
+    }
+    for (; i < bytes; ++i) {
+        intersection += PopCount(a[i] & b[i]);
+        union_count += PopCount(a[i] | b[i]);
+    }
+    if (union_count == 0) {
+        return 0;
+    }
+    return 1.0f - static_cast<float>(intersection) / static_cast<float>(union_count);
+}
+
+Status
+GetDistanceMetric(const std::string& metric_type, DataType vector_type, DistanceMetric& metric) {
+    metric = DistanceMetric();
+    if (vector_type == DataType::FLOAT_VECTOR) {
+        if (metric_type == "L2") {
+            metric.function_ = L2SqrRow;
+        } else if (metric_type == "IP") {
+            metric.function_ = InnerProductRow;
+            metric.larger_is_closer_ = true;
+        }
+    } else if (vector_type == DataType::BINARY_VECTOR) {
+        if (metric_type == "HAMMING") {
+            metric.function_ = HammingRow;
+        } else if (metric_type == "JACCARD") {
+            metric.function_ = JaccardRow;
+        }
+    }
+    if (metric.function_ == nullptr) {
+        return Status(StatusCode::NotSupported, "Metric type " + metric_type + " is not supported by refine");
+    }
+    return Status::OK();
+}
+
+}  // namespace milvus
@@ -0,0 +1,77 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Status.h"
+#include "types/DataType.h"
+
+namespace milvus {
+
+/**
+ * @brief Squared euclidean distance, as reported by the server for metric L2.
+ */
+float
+L2Sqr(const float* a, const float* b, size_t dimension);
+
+float
+InnerProduct(const float* a, const float* b, size_t dimension);
+
+/**
+ * @brief Number of differing bits of two binary vectors of length bytes.
+ */
+float
+Hamming(const uint8_t* a, const uint8_t* b, size_t bytes);
+
+/**
+ * @brief 1 - |a & b| / |a | b|, 0 for two empty vectors.
+ */
+float
+Jaccard(const uint8_t* a, const uint8_t* b, size_t bytes);
+
+/**
+ * @brief Exact distance function of a metric type, on raw vector rows.
+ */
+struct DistanceMetric {
+    using Function = float (*)(const void* a, const void* b, size_t dimension);
+
+    Function function_ = nullptr;
+    // IP ranks larger scores first, the other metrics smaller distances first
+    bool larger_is_closer_ = false;
+
+    float
+    Distance(const void* a, const void* b, size_t dimension) const {
+        return function_(a, b, dimension);
+    }
+
+    bool
+    Closer(float lhs, float rhs) const {
+        return larger_is_closer_ ? lhs > rhs : lhs < rhs;
+    }
+};
+
+/**
+ * @brief Distance function of metric_type on vectors of vector_type, the dimension passed to it is the row
+ * dimension of the vector field.
+ */
+Status
+GetDistanceMetric(const std::string& metric_type, DataType vector_type, DistanceMetric& metric);
+
+}  // namespace milvus
@@ -0,0 +1,400 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "DuplicateFilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace milvus {
+
+namespace {
+
+const char kFilterMagic[] = "MVSDUPF1";
+constexpr size_t kFilterMagicLength = 8;
+
+// each new filter has half the false positive rate of the previous one, the rates sum up to the configured one
+constexpr double kTighteningRatio = 0.5;
+constexpr uint64_t kGrowthFactor = 2;
+
+uint64_t
+Mix64(uint64_t value) {
+    // splitmix64 finalizer
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ULL;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+    return value;
+}
+
+void
+AppendFixed64(std::string& buffer, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+bool
+ReadFixed64(std::FILE* file, uint64_t& value) {
+    unsigned char bytes[8];
+    if (std::fread(bytes, 1, sizeof(bytes), file) != sizeof(bytes)) {
+        return false;
+    }
+    value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | bytes[i];
+    }
+    return true;
+}
+
+uint64_t
+DoubleBits(double value) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double
+BitsDouble(uint64_t bits) {
+    double value = 0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+template <typename T>
+std::vector<T>
+InsertedKeysImpl(const std::vector<T>& keys, const Status& status, const DmlResults& results) {
+    std::vector<uint32_t> error_rows(results.ErrorRows());
+    if (!status.IsOk() && (results.InsertCount() == 0 || error_rows.empty())) {
+        return std::vector<T>();
+    }
+    std::sort(error_rows.begin(), error_rows.end());
+
+    std::vector<T> inserted;
+    inserted.reserve(keys.size());
+    for (size_t i = 0, next = 0; i < keys.size(); ++i) {
+        if (next < error_rows.size() && error_rows[next] == i) {
+            ++next;
+            continue;
+        }
+        inserted.push_back(keys[i]);
+    }
+    return inserted;
+}
+
+}  // namespace
+
+std::vector<int64_t>
+InsertedKeys(const std::vector<int64_t>& keys, const Status& status, const DmlResults& results) {
+    return InsertedKeysImpl(keys, status, results);
+}
+
+std::vector<std::string>
+InsertedKeys(const std::vector<std::string>& keys, const Status& status, const DmlResults& results) {
+    return InsertedKeysImpl(keys, status, results);
+}
+
+DuplicateFilter::DuplicateFilter(uint64_t initial_capacity, double false_positive_rate, uint32_t max_stages)
+    : initial_capacity_(std::max<uint64_t>(initial_capacity, 1)),
+      false_positive_rate_(std::min(std::max(false_positive_rate, 1e-12), 0.5)),
+      max_stages_(max_stages) {
+    AddStage();
+}
+
+DuplicateFilter::KeyHash
+DuplicateFilter::Hash(int64_t key) {
+    const uint64_t value = static_cast<uint64_t>(key);
+    // h2 is odd so the probe sequence h1 + i * h2 doesn't cycle early
+    return KeyHash{Mix64(value), Mix64(value ^ 0x9E3779B97F4A7C15ULL) | 1};
+}
+
+DuplicateFilter::KeyHash
+DuplicateFilter::Hash(const std::string& key) {
+    // FNV-1a, stable across platforms unlike std::hash
+    uint64_t value = 0xCBF29CE484222325ULL;
+    for (unsigned char c : key) {
+        value ^= c;
+        value *= 0x100000001B3ULL;
+    }
+    return KeyHash{Mix64(value), Mix64(value ^ 0x9E3779B97F4A7C15ULL) | 1};
+}
+
+std::vector<uint32_t>
+DuplicateFilter::FindDuplicates(const std::vector<int64_t>& keys) const {
+    return FindDuplicatesImpl(keys);
+}
+
+std::vector<uint32_t>
+DuplicateFilter::FindDuplicates(const std::vector<std::string>& keys) const {
+    return FindDuplicatesImpl(keys);
+}
+
+void
+DuplicateFilter::Add(const std::vector<int64_t>& keys) {
+    AddImpl(keys);
+}
+
+void
+DuplicateFilter::Add(const std::vector<std::string>& keys) {
+    AddImpl(keys);
+}
+
+std::vector<uint32_t>
+DuplicateFilter::Reserve(const std::vector<int64_t>& keys) {
+    return ReserveImpl(keys);
+}
+
+std::vector<uint32_t>
+DuplicateFilter::Reserve(const std::vector<std::string>& keys) {
+    return ReserveImpl(keys);
+}
+
+void
+DuplicateFilter::Release(const std::vector<int64_t>& reserved, const std::vector<int64_t>& inserted) {
+    ReleaseImpl(reserved, inserted);
+}
+
+void
+DuplicateFilter::Release(const std::vector<std::string>& reserved, const std::vector<std::string>& inserted) {
+    ReleaseImpl(reserved, inserted);
+}
+
+template <typename T>
+std::vector<uint32_t>
+DuplicateFilter::FindDuplicatesImpl(const std::vector<T>& keys) const {
+    std::vector<uint32_t> duplicates;
+    std::unordered_set<T> batch;
+    batch.reserve(keys.size());
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        const auto hash = Hash(keys[i]);
+        if (!batch.insert(keys[i]).second || reserved_.count(hash) > 0 || MayContain(hash)) {
+            duplicates.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return duplicates;
+}
+
+template <typename T>
+std::vector<uint32_t>
+DuplicateFilter::ReserveImpl(const std::vector<T>& keys) {
+    std::vector<uint32_t> duplicates;
+    std::unordered_set<T> batch;
+    batch.reserve(keys.size());
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (!batch.insert(keys[i]).second) {
+            duplicates.push_back(static_cast<uint32_t>(i));
+            continue;
+        }
+        const auto hash = Hash(keys[i]);
+        if (MayContain(hash) || !reserved_.insert(hash).second) {
+            duplicates.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return duplicates;
+}
+
+template <typename T>
+void
+DuplicateFilter::ReleaseImpl(const std::vector<T>& reserved, const std::vector<T>& inserted) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& key : inserted) {
+        Insert(Hash(key));
+    }
+    for (const auto& key : reserved) {
+        reserved_.erase(Hash(key));
+    }
+}
+
+template <typename T>
+void
+DuplicateFilter::AddImpl(const std::vector<T>& keys) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& key : keys) {
+        Insert(Hash(key));
+    }
+}
+
+bool
+DuplicateFilter::MayContain(const KeyHash& hash) const {
+    for (const auto& stage : stages_) {
+        bool found = true;
+        for (uint32_t i = 0; i < stage.hash_count_ && found; ++i) {
+            const uint64_t bit = (hash.h1_ + i * hash.h2_) % stage.bit_count_;
+            found = (stage.bits_[bit / 64] >> (bit % 64)) & 1;
+        }
+        if (found) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+DuplicateFilter::Insert(const KeyHash& hash) {
+    if (MayContain(hash)) {
+        return;
+    }
+    if (stages_.back().count_ >= stages_.back().capacity_) {
+        AddStage();
+    }
+    auto& stage = stages_.back();
+    for (uint32_t i = 0; i < stage.hash_count_; ++i) {
+        const uint64_t bit = (hash.h1_ + i * hash.h2_) % stage.bit_count_;
+        stage.bits_[bit / 64] |= uint64_t{1} << (bit % 64);
+    }
+    ++stage.count_;
+}
+
+void
+DuplicateFilter::AddStage() {
+    // the level of a stage is the number of times its capacity has grown, it determines the false positive rate
+    size_t level = 0;
+    Stage stage;
+    stage.capacity_ = initial_capacity_;
+    if (!stages_.empty()) {
+        while (stage.capacity_ < stages_.back().capacity_) {
+            stage.capacity_ *= kGrowthFactor;
+            ++level;
+        }
+        if (max_stages_ == 0 || stages_.size() < max_stages_) {
+            stage.capacity_ *= kGrowthFactor;
+            ++level;
+        } else {
+            // the dropped stage had a higher rate than the new one, so the rates still sum up under the bound
+            stages_.erase(stages_.begin());
+        }
+    }
+    const double ln2 = std::log(2.0);
+    const double rate = false_positive_rate_ * (1 - kTighteningRatio) * std::pow(kTighteningRatio, level);
+
+    const double bits = -static_cast<double>(stage.capacity_) * std::log(rate) / (ln2 * ln2);
+    stage.bit_count_ = (static_cast<uint64_t>(std::ceil(bits)) + 63) / 64 * 64;
+    stage.hash_count_ = std::max<uint32_t>(1, static_cast<uint32_t>(std::ceil(-std::log2(rate))));
+    stage.bits_.resize(stage.bit_count_ / 64);
+    stages_.push_back(std::move(stage));
+}
+
+uint64_t
+DuplicateFilter::Count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t count = 0;
+    for (const auto& stage : stages_) {
+        count += stage.count_;
+    }
+    return count;
+}
+
+uint64_t
+DuplicateFilter::MemoryBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t bytes = 0;
+    for (const auto& stage : stages_) {
+        bytes += stage.bits_.size() * sizeof(uint64_t);
+    }
+    return bytes;
+}
+
+Status
+DuplicateFilter::Save(const std::string& path) const {
+    std::string buffer(kFilterMagic, kFilterMagicLength);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        AppendFixed64(buffer, initial_capacity_);
+        AppendFixed64(buffer, DoubleBits(false_positive_rate_));
+        AppendFixed64(buffer, stages_.size());
+        for (const auto& stage : stages_) {
+            AppendFixed64(buffer, stage.capacity_);
+            AppendFixed64(buffer, stage.count_);
+            AppendFixed64(buffer, stage.hash_count_);
+            AppendFixed64(buffer, stage.bit_count_);
+            for (auto word : stage.bits_) {
+                AppendFixed64(buffer, word);
+            }
+        }
+    }
+
+    const std::string temp_path = path + ".tmp";
+    std::FILE* file = std::fopen(temp_path.c_str(), "wb");
+    if (file == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Failed to open duplicate filter file: " + temp_path);
+    }
+    const bool written = std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    const bool closed = std::fclose(file) == 0;
+    if (!written || !closed || std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return Status(StatusCode::UnknownError, "Failed to write duplicate filter file: " + path);
+    }
+    return Status::OK();
+}
+
+Status
+DuplicateFilter::Load(const std::string& path, std::shared_ptr<DuplicateFilter>& filter, uint32_t max_stages) {
+    filter = nullptr;
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return Status::OK();
+    }
+
+    char magic[kFilterMagicLength];
+    uint64_t initial_capacity = 0;
+    uint64_t rate_bits = 0;
+    uint64_t stage_count = 0;
+    bool valid = std::fread(magic, 1, kFilterMagicLength, file) == kFilterMagicLength &&
+                 std::memcmp(magic, kFilterMagic, kFilterMagicLength) == 0 && ReadFixed64(file, initial_capacity) &&
+                 ReadFixed64(file, rate_bits) && ReadFixed64(file, stage_count) && stage_count > 0;
+
+    std::shared_ptr<DuplicateFilter> loaded;
+    if (valid) {
+        loaded = std::make_shared<DuplicateFilter>(initial_capacity, BitsDouble(rate_bits), max_stages);
+        loaded->stages_.clear();
+    }
+    for (uint64_t i = 0; valid && i < stage_count; ++i) {
+        Stage stage;
+        uint64_t hash_count = 0;
+        valid = ReadFixed64(file, stage.capacity_) && ReadFixed64(file, stage.count_) &&
+                ReadFixed64(file, hash_count) && ReadFixed64(file, stage.bit_count_) && hash_count > 0 &&
+                stage.bit_count_ > 0 && stage.bit_count_ % 64 == 0;
+        if (!valid) {
+            break;
+        }
+        stage.hash_count_ = static_cast<uint32_t>(hash_count);
+        stage.bits_.resize(stage.bit_count_ / 64);
+        for (auto& word : stage.bits_) {
+            if (!ReadFixed64(file, word)) {
+                valid = false;
+                break;
+            }
+        }
+        loaded->stages_.push_back(std::move(stage));
+    }
+    std::fclose(file);
+
+    if (!valid) {
+        return Status(StatusCode::InvalidAgument, "Corrupted duplicate filter file: " + path);
+    }
+    if (max_stages > 0 && loaded->stages_.size() > max_stages) {
+        loaded->stages_.erase(loaded->stages_.begin(), loaded->stages_.end() - max_stages);
+    }
+    filter = std::move(loaded);
+    return Status::OK();
+}
+
+}  // namespace milvus
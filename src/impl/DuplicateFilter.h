@@ -0,0 +1,180 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "Status.h"
+#include "types/DmlResults.h"
+
+namespace milvus {
+
+/**
+ * @brief Keys of the rows an insert has stored, to be added to the duplicate filter. A failed insert stored the rows
+ * out of DmlResults::ErrorRows() only if it reports a partial outcome, that is some rows were inserted and the
+ * others are listed; otherwise nothing is stored and a retry must not be dropped as a duplicate.
+ */
+std::vector<int64_t>
+InsertedKeys(const std::vector<int64_t>& keys, const Status& status, const DmlResults& results);
+
+std::vector<std::string>
+InsertedKeys(const std::vector<std::string>& keys, const Status& status, const DmlResults& results);
+
+/**
+ * @brief Scalable Bloom filter of primary keys. It starts with one filter of initial_capacity keys; when the last
+ * filter is full a new one is added with twice the capacity and half the false positive rate, so the false
+ * positive rates of all filters sum up to at most false_positive_rate. With max_stages above 0, the oldest filter is
+ * dropped when another one would exceed it and the new filter repeats the size and rate of the last one, so the
+ * keys of the dropped filter age out and the memory stays bounded.
+ *
+ * Keys are hashed with fixed functions so a saved filter stays valid across processes. It is thread safe.
+ */
+class DuplicateFilter {
+ public:
+    DuplicateFilter(uint64_t initial_capacity, double false_positive_rate, uint32_t max_stages = 0);
+
+    /**
+     * @brief Rows of keys that were probably added before, are reserved or repeat an earlier key of the same batch.
+     */
+    std::vector<uint32_t>
+    FindDuplicates(const std::vector<int64_t>& keys) const;
+
+    std::vector<uint32_t>
+    FindDuplicates(const std::vector<std::string>& keys) const;
+
+    void
+    Add(const std::vector<int64_t>& keys);
+
+    void
+    Add(const std::vector<std::string>& keys);
+
+    /**
+     * @brief FindDuplicates() and reserve the other keys in one step, so a concurrent call reports them as duplicates
+     * while their insert is in flight. Every reservation must be ended by Release().
+     */
+    std::vector<uint32_t>
+    Reserve(const std::vector<int64_t>& keys);
+
+    std::vector<uint32_t>
+    Reserve(const std::vector<std::string>& keys);
+
+    /**
+     * @brief End the reservation of reserved keys and add inserted, the keys the insert has stored, to the filter.
+     * A reserved key that is not inserted can be reserved again by a retry.
+     */
+    void
+    Release(const std::vector<int64_t>& reserved, const std::vector<int64_t>& inserted);
+
+    void
+    Release(const std::vector<std::string>& reserved, const std::vector<std::string>& inserted);
+
+    /**
+     * @brief Approximate number of distinct keys held, a key that is a false positive when added is not counted and
+     * the keys of dropped filters are not counted.
+     */
+    uint64_t
+    Count() const;
+
+    uint64_t
+    MemoryBytes() const;
+
+    /**
+     * @brief Write the filter to a temporary file and rename it to path, so a crash never leaves a partial file.
+     */
+    Status
+    Save(const std::string& path) const;
+
+    /**
+     * @brief Load a saved filter, filter is set to nullptr if the file doesn't exist. The oldest filters beyond
+     * max_stages are dropped.
+     */
+    static Status
+    Load(const std::string& path, std::shared_ptr<DuplicateFilter>& filter, uint32_t max_stages = 0);
+
+ private:
+    struct KeyHash {
+        uint64_t h1_;
+        uint64_t h2_;
+
+        bool
+        operator==(const KeyHash& other) const {
+            return h1_ == other.h1_ && h2_ == other.h2_;
+        }
+    };
+
+    struct KeyHashHasher {
+        size_t
+        operator()(const KeyHash& hash) const {
+            return static_cast<size_t>(hash.h1_);
+        }
+    };
+
+    struct Stage {
+        uint64_t capacity_ = 0;
+        uint64_t count_ = 0;
+        uint32_t hash_count_ = 0;
+        uint64_t bit_count_ = 0;
+        std::vector<uint64_t> bits_;
+    };
+
+    static KeyHash
+    Hash(int64_t key);
+
+    static KeyHash
+    Hash(const std::string& key);
+
+    template <typename T>
+    std::vector<uint32_t>
+    FindDuplicatesImpl(const std::vector<T>& keys) const;
+
+    template <typename T>
+    void
+    AddImpl(const std::vector<T>& keys);
+
+    template <typename T>
+    std::vector<uint32_t>
+    ReserveImpl(const std::vector<T>& keys);
+
+    template <typename T>
+    void
+    ReleaseImpl(const std::vector<T>& reserved, const std::vector<T>& inserted);
+
+    bool
+    MayContain(const KeyHash& hash) const;
+
+    void
+    Insert(const KeyHash& hash);
+
+    void
+    AddStage();
+
+ private:
+    mutable std::mutex mutex_;
+    uint64_t initial_capacity_;
+    double false_positive_rate_;
+    uint32_t max_stages_;
+    std::vector<Stage> stages_;
+    // keys of the inserts in flight, not saved
+    std::unordered_set<KeyHash, KeyHashHasher> reserved_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,79 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Endpoint.h"
+
+namespace milvus {
+
+namespace {
+
+bool
+StartsWith(const std::string& value, const std::string& prefix) {
+    return value.compare(0, prefix.size(), prefix) == 0;
+}
+
+}  // namespace
+
+Status
+ResolveEndpoint(const std::string& uri, Endpoint& endpoint) {
+    endpoint = Endpoint();
+    if (uri.empty()) {
+        return Status(StatusCode::InvalidAgument, "Connect uri cannot be empty!");
+    }
+
+    if (StartsWith(uri, "unix:") || StartsWith(uri, "unix-abstract:")) {
+        const auto name = uri.substr(uri.find(':') + 1);
+        if (name.empty() || name == "//" || name == "///") {
+            return Status(StatusCode::InvalidAgument, "Socket path is missing in uri: " + uri);
+        }
+        endpoint.target_ = uri;
+        endpoint.transport_ = Transport::UNIX;
+        return Status::OK();
+    }
+
+    const auto scheme_end = uri.find("://");
+    if (scheme_end != std::string::npos) {
+        const auto scheme = uri.substr(0, scheme_end);
+        const auto address = uri.substr(scheme_end + 3);
+        if (scheme == "https") {
+            return Status(StatusCode::NotSupported, "TLS is not supported, uri: " + uri);
+        }
+        if (scheme == "tcp" || scheme == "http") {
+            if (address.empty()) {
+                return Status(StatusCode::InvalidAgument, "Address is missing in uri: " + uri);
+            }
+            // "http://host:port/" is accepted as written by users
+            endpoint.target_ = address.back() == '/' ? address.substr(0, address.size() - 1) : address;
+            return Status::OK();
+        }
+        endpoint.target_ = uri;
+        endpoint.transport_ = Transport::OTHER;
+        return Status::OK();
+    }
+
+    for (const char* scheme : {"dns:", "ipv4:", "ipv6:", "vsock:"}) {
+        if (StartsWith(uri, scheme)) {
+            endpoint.target_ = uri;
+            endpoint.transport_ = Transport::OTHER;
+            return Status::OK();
+        }
+    }
+
+    endpoint.target_ = uri;
+    return Status::OK();
+}
+
+}  // namespace milvus
@@ -0,0 +1,54 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "Status.h"
+
+namespace milvus {
+
+/**
+ * @brief Transport of a channel target, local transports get channel defaults tuned for same-host IPC.
+ */
+enum class Transport {
+    TCP = 0,
+    // unix domain socket, by path or in the abstract namespace
+    UNIX,
+    // other gRPC target schemes, passed through unchanged
+    OTHER,
+};
+
+/**
+ * @brief gRPC channel target resolved from a connect uri.
+ */
+struct Endpoint {
+    std::string target_;
+    Transport transport_ = Transport::TCP;
+};
+
+/**
+ * @brief Resolve a connect uri into a gRPC target.
+ *
+ * "host:port" and "tcp://host:port" or "http://host:port" connect by TCP. "unix:path", "unix:///absolute/path" and
+ * "unix-abstract:name" connect by unix domain socket. Other gRPC schemes such as "dns:", "ipv4:", "ipv6:" and
+ * "vsock:" are passed through. "https://" returns NotSupported since the channel has no TLS credentials.
+ */
+Status
+ResolveEndpoint(const std::string& uri, Endpoint& endpoint);
+
+}  // namespace milvus
@@ -0,0 +1,431 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "EntityCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+namespace milvus {
+
+namespace {
+
+// per-entry bookkeeping of the list node, the index node and the layout reference
+constexpr uint64_t kEntryOverheadBytes = 96;
+
+// odd multipliers, one for each row of the sketch
+constexpr uint64_t kSketchSeeds[] = {0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL,
+                                     0xD6E8FEB86659FD93ULL};
+
+uint64_t
+HashKey(const std::string& key) {
+    return std::hash<std::string>()(key);
+}
+
+template <typename T>
+void
+AppendValue(std::string& data, const T& value) {
+    data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void
+AppendValue(std::string& data, const std::string& value) {
+    AppendValue(data, static_cast<uint32_t>(value.size()));
+    data.append(value);
+}
+
+template <typename T>
+void
+ReadValue(const char*& cursor, T& value) {
+    std::memcpy(&value, cursor, sizeof(T));
+    cursor += sizeof(T);
+}
+
+void
+ReadValue(const char*& cursor, std::string& value) {
+    uint32_t length = 0;
+    ReadValue(cursor, length);
+    value.assign(cursor, length);
+    cursor += length;
+}
+
+template <typename Column>
+void
+EncodeScalar(const Field& field, size_t row, std::string& data) {
+    const typename Column::ElementType value = static_cast<const Column&>(field).Data()[row];
+    AppendValue(data, value);
+}
+
+template <typename Column>
+void
+EncodeVector(const Field& field, size_t row, std::string& data) {
+    const auto& column = static_cast<const Column&>(field);
+    data.append(reinterpret_cast<const char*>(column.Row(row)),
+                column.RowWidth() * sizeof(typename Column::ElementType));
+}
+
+template <typename Column>
+void
+DecodeScalar(const char*& cursor, Field* field) {
+    typename Column::ElementType value;
+    ReadValue(cursor, value);
+    if (field != nullptr) {
+        static_cast<Column*>(field)->Add(value);
+    }
+}
+
+template <typename Column, DataType Dt>
+void
+DecodeVector(const char*& cursor, uint32_t dimension, Field* field) {
+    const size_t bytes = DataTypeTraits<Dt>::RowWidth(dimension) * sizeof(typename Column::ElementType);
+    if (field != nullptr) {
+        auto& data = static_cast<Column*>(field)->Data();
+        const size_t offset = data.size();
+        data.resize(offset + DataTypeTraits<Dt>::RowWidth(dimension));
+        std::memcpy(data.data() + offset, cursor, bytes);
+    }
+    cursor += bytes;
+}
+
+}  // namespace
+
+FrequencySketch::FrequencySketch(size_t width) {
+    size_t power = 64;
+    while (power < width) {
+        power <<= 1;
+    }
+    counters_.resize(kRows * power);
+    mask_ = power - 1;
+    sample_size_ = 10 * power;
+}
+
+size_t
+FrequencySketch::Index(uint64_t hash, size_t row) const {
+    uint64_t mixed = hash * kSketchSeeds[row];
+    mixed ^= mixed >> 32;
+    return row * (mask_ + 1) + (mixed & mask_);
+}
+
+void
+FrequencySketch::Increment(uint64_t hash) {
+    bool added = false;
+    for (size_t row = 0; row < kRows; ++row) {
+        auto& counter = counters_[Index(hash, row)];
+        if (counter < kMaxCount) {
+            ++counter;
+            added = true;
+        }
+    }
+    if (added && ++additions_ >= sample_size_) {
+        Reset();
+    }
+}
+
+uint32_t
+FrequencySketch::Frequency(uint64_t hash) const {
+    uint32_t frequency = kMaxCount;
+    for (size_t row = 0; row < kRows; ++row) {
+        frequency = std::min<uint32_t>(frequency, counters_[Index(hash, row)]);
+    }
+    return frequency;
+}
+
+void
+FrequencySketch::Reset() {
+    for (auto& counter : counters_) {
+        counter >>= 1;
+    }
+    additions_ /= 2;
+}
+
+Status
+MakeEntityLayout(const std::vector<FieldDataPtr>& columns, EntityLayout& layout) {
+    layout.clear();
+    for (const auto& column : columns) {
+        EntityField field;
+        field.name_ = column->Name();
+        field.type_ = column->Type();
+        switch (column->Type()) {
+            case DataType::BOOL:
+            case DataType::INT8:
+            case DataType::INT16:
+            case DataType::INT32:
+            case DataType::INT64:
+            case DataType::FLOAT:
+            case DataType::DOUBLE:
+            case DataType::STRING:
+                break;
+            case DataType::BINARY_VECTOR:
+                field.dimension_ = static_cast<const BinaryVecFieldData&>(*column).Dimension();
+                break;
+            case DataType::FLOAT_VECTOR:
+                field.dimension_ = static_cast<const FloatVecFieldData&>(*column).Dimension();
+                break;
+            default:
+                return Status(StatusCode::NotSupported, "Field '" + column->Name() + "' cannot be cached!");
+        }
+        layout.push_back(field);
+    }
+    return Status::OK();
+}
+
+void
+EncodeEntity(const std::vector<FieldDataPtr>& columns, size_t row, std::string& data) {
+    data.clear();
+    for (const auto& column : columns) {
+        switch (column->Type()) {
+            case DataType::BOOL:
+                EncodeScalar<BoolFieldData>(*column, row, data);
+                break;
+            case DataType::INT8:
+                EncodeScalar<Int8FieldData>(*column, row, data);
+                break;
+            case DataType::INT16:
+                EncodeScalar<Int16FieldData>(*column, row, data);
+                break;
+            case DataType::INT32:
+                EncodeScalar<Int32FieldData>(*column, row, data);
+                break;
+            case DataType::INT64:
+                EncodeScalar<Int64FieldData>(*column, row, data);
+                break;
+            case DataType::FLOAT:
+                EncodeScalar<FloatFieldData>(*column, row, data);
+                break;
+            case DataType::DOUBLE:
+                EncodeScalar<DoubleFieldData>(*column, row, data);
+                break;
+            case DataType::STRING:
+                EncodeScalar<StringFieldData>(*column, row, data);
+                break;
+            case DataType::BINARY_VECTOR:
+                EncodeVector<BinaryVecFieldData>(*column, row, data);
+                break;
+            case DataType::FLOAT_VECTOR:
+                EncodeVector<FloatVecFieldData>(*column, row, data);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+FieldDataPtr
+CreateEntityColumn(const EntityField& field) {
+    switch (field.type_) {
+        case DataType::BOOL:
+            return std::make_shared<BoolFieldData>(field.name_);
+        case DataType::INT8:
+            return std::make_shared<Int8FieldData>(field.name_);
+        case DataType::INT16:
+            return std::make_shared<Int16FieldData>(field.name_);
+        case DataType::INT32:
+            return std::make_shared<Int32FieldData>(field.name_);
+        case DataType::INT64:
+            return std::make_shared<Int64FieldData>(field.name_);
+        case DataType::FLOAT:
+            return std::make_shared<FloatFieldData>(field.name_);
+        case DataType::DOUBLE:
+            return std::make_shared<DoubleFieldData>(field.name_);
+        case DataType::STRING:
+            return std::make_shared<StringFieldData>(field.name_);
+        case DataType::BINARY_VECTOR:
+            return std::make_shared<BinaryVecFieldData>(field.name_, field.dimension_);
+        case DataType::FLOAT_VECTOR:
+            return std::make_shared<FloatVecFieldData>(field.name_, field.dimension_);
+        default:
+            return nullptr;
+    }
+}
+
+void
+DecodeEntity(const EntityRow& row, const std::vector<FieldDataPtr>& columns) {
+    const char* cursor = row.data_.data();
+    const auto& layout = *row.layout_;
+    for (size_t i = 0; i < layout.size(); ++i) {
+        Field* column = columns[i].get();
+        switch (layout[i].type_) {
+            case DataType::BOOL:
+                DecodeScalar<BoolFieldData>(cursor, column);
+                break;
+            case DataType::INT8:
+                DecodeScalar<Int8FieldData>(cursor, column);
+                break;
+            case DataType::INT16:
+                DecodeScalar<Int16FieldData>(cursor, column);
+                break;
+            case DataType::INT32:
+                DecodeScalar<Int32FieldData>(cursor, column);
+                break;
+            case DataType::INT64:
+                DecodeScalar<Int64FieldData>(cursor, column);
+                break;
+            case DataType::FLOAT:
+                DecodeScalar<FloatFieldData>(cursor, column);
+                break;
+            case DataType::DOUBLE:
+                DecodeScalar<DoubleFieldData>(cursor, column);
+                break;
+            case DataType::STRING:
+                DecodeScalar<StringFieldData>(cursor, column);
+                break;
+            case DataType::BINARY_VECTOR:
+                DecodeVector<BinaryVecFieldData, DataType::BINARY_VECTOR>(cursor, layout[i].dimension_, column);
+                break;
+            case DataType::FLOAT_VECTOR:
+                DecodeVector<FloatVecFieldData, DataType::FLOAT_VECTOR>(cursor, layout[i].dimension_, column);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+EntityCache::EntityCache(const EntityCacheConfig& config)
+    : capacity_bytes_(config.CapacityBytes()),
+      sketch_(static_cast<size_t>(config.CapacityBytes() / std::max<uint32_t>(config.AverageEntityBytes(), 1))) {
+}
+
+std::string
+EntityCache::Key(const std::string& collection_name, int64_t id) {
+    std::string key;
+    key.reserve(collection_name.size() + 2 + sizeof(id));
+    key.append(collection_name).push_back('\0');
+    key.push_back('i');
+    AppendValue(key, id);
+    return key;
+}
+
+std::string
+EntityCache::Key(const std::string& collection_name, const std::string& id) {
+    std::string key;
+    key.reserve(collection_name.size() + 2 + id.size());
+    key.append(collection_name).push_back('\0');
+    key.push_back('s');
+    key.append(id);
+    return key;
+}
+
+bool
+EntityCache::Get(const std::string& key, const std::vector<std::string>& fields, EntityRow& row) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sketch_.Increment(HashKey(key));
+    auto iter = index_.find(key);
+    if (iter == index_.end()) {
+        ++miss_count_;
+        return false;
+    }
+
+    const auto& layout = *iter->second->row_.layout_;
+    for (const auto& name : fields) {
+        auto has_field = [&name](const EntityField& field) { return field.name_ == name; };
+        if (std::find_if(layout.begin(), layout.end(), has_field) == layout.end()) {
+            ++miss_count_;
+            return false;
+        }
+    }
+
+    lru_.splice(lru_.begin(), lru_, iter->second);
+    row = iter->second->row_;
+    ++hit_count_;
+    return true;
+}
+
+uint64_t
+EntityCache::Epoch() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return epoch_;
+}
+
+void
+EntityCache::Put(const std::string& key, EntityRow&& row, uint64_t epoch) {
+    const uint64_t bytes = key.size() + row.data_.size() + kEntryOverheadBytes;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (epoch != epoch_) {
+        return;
+    }
+    if (bytes > capacity_bytes_) {
+        ++reject_count_;
+        return;
+    }
+
+    // a refetched entity replaces the cached one without admission
+    auto iter = index_.find(key);
+    const bool replace = iter != index_.end();
+    if (replace) {
+        Erase(iter->second);
+    }
+
+    const uint32_t frequency = sketch_.Frequency(HashKey(key));
+    while (used_bytes_ + bytes > capacity_bytes_ && !lru_.empty()) {
+        auto victim = std::prev(lru_.end());
+        if (!replace && frequency <= sketch_.Frequency(HashKey(victim->key_))) {
+            ++reject_count_;
+            return;
+        }
+        Erase(victim);
+    }
+
+    Entry entry;
+    entry.key_ = key;
+    entry.row_ = std::move(row);
+    entry.bytes_ = bytes;
+    lru_.push_front(std::move(entry));
+    index_[key] = lru_.begin();
+    used_bytes_ += bytes;
+}
+
+void
+EntityCache::Invalidate(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++epoch_;
+    auto iter = index_.find(key);
+    if (iter != index_.end()) {
+        Erase(iter->second);
+    }
+}
+
+void
+EntityCache::InvalidateCollection(const std::string& collection_name) {
+    std::string prefix = collection_name;
+    prefix.push_back('\0');
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++epoch_;
+    for (auto iter = lru_.begin(); iter != lru_.end();) {
+        auto next = std::next(iter);
+        if (iter->key_.compare(0, prefix.size(), prefix) == 0) {
+            Erase(iter);
+        }
+        iter = next;
+    }
+}
+
+EntityCacheStat
+EntityCache::Stat() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return EntityCacheStat(capacity_bytes_, used_bytes_, lru_.size(), hit_count_, miss_count_, reject_count_);
+}
+
+void
+EntityCache::Erase(std::list<Entry>::iterator iter) {
+    used_bytes_ -= iter->bytes_;
+    index_.erase(iter->key_);
+    lru_.erase(iter);
+}
+
+}  // namespace milvus
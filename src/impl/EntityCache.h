@@ -0,0 +1,178 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Status.h"
+#include "types/EntityCacheConfig.h"
+#include "types/EntityCacheStat.h"
+#include "types/FieldData.h"
+
+namespace milvus {
+
+/**
+ * @brief Count-min sketch of access frequencies, 4 counters of 4 bits for each key. The counters are halved after
+ * 10 * width increments, so keys that were popular long ago fade out.
+ */
+class FrequencySketch {
+ public:
+    explicit FrequencySketch(size_t width);
+
+    void
+    Increment(uint64_t hash);
+
+    uint32_t
+    Frequency(uint64_t hash) const;
+
+ private:
+    size_t
+    Index(uint64_t hash, size_t row) const;
+
+    void
+    Reset();
+
+ private:
+    static constexpr size_t kRows = 4;
+    static constexpr uint8_t kMaxCount = 15;
+
+    std::vector<uint8_t> counters_;
+    size_t mask_ = 0;
+    size_t sample_size_ = 0;
+    size_t additions_ = 0;
+};
+
+/**
+ * @brief Name, type and dimension of a field of a cached entity.
+ */
+struct EntityField {
+    std::string name_;
+    DataType type_ = DataType::UNKNOWN;
+    uint32_t dimension_ = 0;
+};
+
+using EntityLayout = std::vector<EntityField>;
+
+/**
+ * @brief An entity packed into one buffer: fixed-size scalars by value, strings as a 32-bit length followed by the
+ * bytes, vectors as their raw row. The layout is shared by all entities fetched by the same query.
+ */
+struct EntityRow {
+    std::shared_ptr<const EntityLayout> layout_;
+    std::string data_;
+};
+
+/**
+ * @brief Describe the columns of a query result, return NotSupported for a column of unknown type.
+ */
+Status
+MakeEntityLayout(const std::vector<FieldDataPtr>& columns, EntityLayout& layout);
+
+/**
+ * @brief Pack row of the columns into data, the columns must match the layout made by MakeEntityLayout().
+ */
+void
+EncodeEntity(const std::vector<FieldDataPtr>& columns, size_t row, std::string& data);
+
+/**
+ * @brief Create an empty column for a field of the layout.
+ */
+FieldDataPtr
+CreateEntityColumn(const EntityField& field);
+
+/**
+ * @brief Append the fields of row to columns, field i of the layout goes to columns[i] and is skipped if it is
+ * nullptr.
+ */
+void
+DecodeEntity(const EntityRow& row, const std::vector<FieldDataPtr>& columns);
+
+/**
+ * @brief LRU cache of entities keyed by collection and primary key, bounded by bytes, with TinyLFU admission.
+ * It is thread safe.
+ */
+class EntityCache {
+ public:
+    explicit EntityCache(const EntityCacheConfig& config);
+
+    static std::string
+    Key(const std::string& collection_name, int64_t id);
+
+    static std::string
+    Key(const std::string& collection_name, const std::string& id);
+
+    /**
+     * @brief Find an entity holding all of fields, every lookup is counted by the admission policy.
+     */
+    bool
+    Get(const std::string& key, const std::vector<std::string>& fields, EntityRow& row);
+
+    /**
+     * @brief Counter of invalidations, read it before fetching entities from the server and pass it to Put().
+     */
+    uint64_t
+    Epoch() const;
+
+    /**
+     * @brief Cache a fetched entity. It is dropped if anything was invalidated since epoch, because the entity may
+     * have been fetched before a delete or insert of it. When the cache is full, it is admitted only if it is
+     * requested more often than the least recently used entity.
+     */
+    void
+    Put(const std::string& key, EntityRow&& row, uint64_t epoch);
+
+    void
+    Invalidate(const std::string& key);
+
+    void
+    InvalidateCollection(const std::string& collection_name);
+
+    EntityCacheStat
+    Stat() const;
+
+ private:
+    struct Entry {
+        std::string key_;
+        EntityRow row_;
+        uint64_t bytes_ = 0;
+    };
+
+    void
+    Erase(std::list<Entry>::iterator iter);
+
+ private:
+    const uint64_t capacity_bytes_;
+
+    mutable std::mutex mutex_;
+    FrequencySketch sketch_;
+    // most recently used first
+    std::list<Entry> lru_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    uint64_t used_bytes_ = 0;
+    uint64_t epoch_ = 0;
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+    uint64_t reject_count_ = 0;
+};
+
+}  // namespace milvus
@@ -0,0 +1,619 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Expr.h"
+
+#include <cmath>
+#include <cstdio>
+#include <unordered_map>
+
+#include "ExprFormatter.h"
+
+namespace milvus {
+
+/**
+ * @brief Node of an expression tree.
+ */
+class ExprNode {
+ public:
+    enum class Type {
+        FIELD = 0,
+        PARAM,
+        LITERAL,
+        COMPARE,
+        IN,
+        RANGE,
+        AND,
+        OR,
+        NOT,
+    };
+
+    ExprNode(Type type, const std::string& name) : type_(type), name_(name) {
+    }
+
+    Type type_;
+
+    /**
+     * @brief Field name, placeholder name or comparison operator.
+     */
+    std::string name_;
+
+    ExprValue value_;
+    bool inclusive_ = false;
+    std::vector<std::shared_ptr<const ExprNode>> children_;
+};
+
+/**
+ * @brief Constant text followed by an optional placeholder slot.
+ */
+struct ExprSegment {
+    ExprSegment(std::string&& text, int slot) : text_(std::move(text)), slot_(slot) {
+    }
+
+    std::string text_;
+    int slot_ = -1;
+};
+
+class CompiledExpr {
+ public:
+    int
+    FindParam(const std::string& name) const {
+        for (size_t i = 0; i < param_names_.size(); ++i) {
+            if (param_names_[i] == name) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    std::vector<ExprSegment> segments_;
+    std::vector<std::string> param_names_;
+    std::vector<ExprValue::Kind> param_kinds_;
+    size_t text_length_ = 0;
+};
+
+namespace {
+
+using NodePtr = std::shared_ptr<const ExprNode>;
+
+NodePtr
+MakeNode(ExprNode::Type type, const std::string& name, std::vector<NodePtr>&& children) {
+    auto node = std::make_shared<ExprNode>(type, name);
+    node->children_ = std::move(children);
+    return node;
+}
+
+NodePtr
+MakeLiteral(ExprValue&& value) {
+    auto node = std::make_shared<ExprNode>(ExprNode::Type::LITERAL, "");
+    node->value_ = std::move(value);
+    return node;
+}
+
+void
+AppendDouble(std::string& out, double value) {
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+    // snprintf follows LC_NUMERIC, the server always expects '.' as the decimal point
+    bool in_point = false;
+    for (int i = 0; i < length; ++i) {
+        char c = buffer[i];
+        if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == 'e') {
+            out.push_back(c);
+            in_point = false;
+        } else if (!in_point) {
+            out.push_back('.');
+            in_point = true;
+        }
+    }
+}
+
+template <typename T, typename Append>
+void
+AppendList(std::string& out, const std::vector<T>& values, Append append) {
+    out.push_back('[');
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i > 0) {
+            out.push_back(',');
+        }
+        append(out, values[i]);
+    }
+    out.push_back(']');
+}
+
+void
+AppendValue(std::string& out, const ExprValue& value) {
+    switch (value.ValueKind()) {
+        case ExprValue::Kind::BOOL:
+            out.append(value.BoolValue() ? "true" : "false");
+            break;
+        case ExprValue::Kind::INT64:
+            AppendInt64(out, value.Int64Value());
+            break;
+        case ExprValue::Kind::DOUBLE:
+            AppendDouble(out, value.DoubleValue());
+            break;
+        case ExprValue::Kind::STRING:
+            AppendQuoted(out, value.StringValue());
+            break;
+        case ExprValue::Kind::INT64_LIST:
+            AppendList(out, value.Int64Values(), AppendInt64);
+            break;
+        case ExprValue::Kind::DOUBLE_LIST:
+            AppendList(out, value.DoubleValues(), AppendDouble);
+            break;
+        case ExprValue::Kind::STRING_LIST:
+            AppendList(out, value.StringValues(), AppendQuoted);
+            break;
+        default:
+            break;
+    }
+}
+
+ExprValue::Kind
+ScalarKind(DataType data_type) {
+    switch (data_type) {
+        case DataType::BOOL:
+            return ExprValue::Kind::BOOL;
+        case DataType::INT8:
+        case DataType::INT16:
+        case DataType::INT32:
+        case DataType::INT64:
+            return ExprValue::Kind::INT64;
+        case DataType::FLOAT:
+        case DataType::DOUBLE:
+            return ExprValue::Kind::DOUBLE;
+        case DataType::STRING:
+            return ExprValue::Kind::STRING;
+        default:
+            return ExprValue::Kind::NONE;
+    }
+}
+
+ExprValue::Kind
+ListKind(ExprValue::Kind kind) {
+    switch (kind) {
+        case ExprValue::Kind::INT64:
+            return ExprValue::Kind::INT64_LIST;
+        case ExprValue::Kind::DOUBLE:
+            return ExprValue::Kind::DOUBLE_LIST;
+        case ExprValue::Kind::STRING:
+            return ExprValue::Kind::STRING_LIST;
+        default:
+            return ExprValue::Kind::NONE;
+    }
+}
+
+/**
+ * @brief Integer values are accepted by float fields.
+ */
+bool
+IsCompatible(ExprValue::Kind expected, ExprValue::Kind actual) {
+    return expected == actual || (expected == ExprValue::Kind::DOUBLE && actual == ExprValue::Kind::INT64) ||
+           (expected == ExprValue::Kind::DOUBLE_LIST && actual == ExprValue::Kind::INT64_LIST);
+}
+
+/**
+ * @brief The server cannot parse nan or inf, reject them before they reach an expression.
+ */
+bool
+IsFinite(const ExprValue& value) {
+    if (value.ValueKind() == ExprValue::Kind::DOUBLE) {
+        return std::isfinite(value.DoubleValue());
+    }
+    if (value.ValueKind() == ExprValue::Kind::DOUBLE_LIST) {
+        for (auto item : value.DoubleValues()) {
+            if (!std::isfinite(item)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+class ExprCompiler {
+ public:
+    explicit ExprCompiler(const CollectionSchema& schema) {
+        for (const auto& field : schema.Fields()) {
+            field_kinds_[field.Name()] = ScalarKind(field.FieldDataType());
+        }
+    }
+
+    Status
+    Compile(const ExprNode& root, CompiledExpr& compiled) {
+        compiled_ = &compiled;
+        auto status = CompilePredicate(root);
+        if (!status.IsOk()) {
+            return status;
+        }
+        compiled_->text_length_ += text_.size();
+        compiled_->segments_.emplace_back(std::move(text_), -1);
+        return Status::OK();
+    }
+
+ private:
+    Status
+    FieldKind(const ExprNode& node, ExprValue::Kind& kind) const {
+        auto iter = field_kinds_.find(node.name_);
+        if (iter == field_kinds_.end()) {
+            return Status(StatusCode::InvalidAgument, "Field '" + node.name_ + "' doesn't exist");
+        }
+        if (iter->second == ExprValue::Kind::NONE) {
+            return Status(StatusCode::InvalidAgument, "Field '" + node.name_ + "' is not a scalar field");
+        }
+        kind = iter->second;
+        return Status::OK();
+    }
+
+    /**
+     * @brief Emit a literal or placeholder whose value must be compatible with expected kind.
+     */
+    Status
+    CompileValue(const ExprNode& node, ExprValue::Kind expected) {
+        if (node.type_ == ExprNode::Type::LITERAL) {
+            if (!IsCompatible(expected, node.value_.ValueKind())) {
+                return Status(StatusCode::InvalidAgument, "Literal value type doesn't match the field type");
+            }
+            if (!IsFinite(node.value_)) {
+                return Status(StatusCode::InvalidAgument, "Literal value must be a finite number");
+            }
+            AppendValue(text_, node.value_);
+            return Status::OK();
+        }
+        if (node.type_ != ExprNode::Type::PARAM) {
+            return Status(StatusCode::InvalidAgument, "Operand must be a literal value or a placeholder");
+        }
+
+        int slot = compiled_->FindParam(node.name_);
+        if (slot < 0) {
+            slot = static_cast<int>(compiled_->param_names_.size());
+            compiled_->param_names_.push_back(node.name_);
+            compiled_->param_kinds_.push_back(expected);
+        } else if (compiled_->param_kinds_[slot] != expected) {
+            return Status(StatusCode::InvalidAgument, "Placeholder '" + node.name_ + "' is used with different types");
+        }
+        compiled_->text_length_ += text_.size();
+        compiled_->segments_.emplace_back(std::move(text_), slot);
+        text_.clear();
+        return Status::OK();
+    }
+
+    Status
+    CompileCompare(const ExprNode& node) {
+        const auto& lhs = *node.children_[0];
+        const auto& rhs = *node.children_[1];
+        const bool lhs_field = lhs.type_ == ExprNode::Type::FIELD;
+        const bool rhs_field = rhs.type_ == ExprNode::Type::FIELD;
+        if (!lhs_field && !rhs_field) {
+            return Status(StatusCode::InvalidAgument, "Comparison requires at least one field");
+        }
+
+        ExprValue::Kind kind = ExprValue::Kind::NONE;
+        auto status = FieldKind(lhs_field ? lhs : rhs, kind);
+        if (!status.IsOk()) {
+            return status;
+        }
+        const bool equality = node.name_ == "==" || node.name_ == "!=";
+        if (kind == ExprValue::Kind::BOOL && !equality) {
+            return Status(StatusCode::InvalidAgument, "Bool field only supports == and !=");
+        }
+
+        if (lhs_field && rhs_field) {
+            ExprValue::Kind rhs_kind = ExprValue::Kind::NONE;
+            status = FieldKind(rhs, rhs_kind);
+            if (!status.IsOk()) {
+                return status;
+            }
+            if (!IsCompatible(kind, rhs_kind) && !IsCompatible(rhs_kind, kind)) {
+                return Status(StatusCode::InvalidAgument, "Fields '" + lhs.name_ + "' and '" + rhs.name_ +
+                                                              "' are not comparable");
+            }
+            text_.append(lhs.name_).append(" ").append(node.name_).append(" ").append(rhs.name_);
+            return Status::OK();
+        }
+
+        if (lhs_field) {
+            text_.append(lhs.name_).append(" ").append(node.name_).append(" ");
+            return CompileValue(rhs, kind);
+        }
+        status = CompileValue(lhs, kind);
+        if (!status.IsOk()) {
+            return status;
+        }
+        text_.append(" ").append(node.name_).append(" ").append(rhs.name_);
+        return Status::OK();
+    }
+
+    Status
+    CompileIn(const ExprNode& node) {
+        const auto& field = *node.children_[0];
+        if (field.type_ != ExprNode::Type::FIELD) {
+            return Status(StatusCode::InvalidAgument, "In() must be called on a field");
+        }
+        ExprValue::Kind kind = ExprValue::Kind::NONE;
+        auto status = FieldKind(field, kind);
+        if (!status.IsOk()) {
+            return status;
+        }
+        if (ListKind(kind) == ExprValue::Kind::NONE) {
+            return Status(StatusCode::InvalidAgument, "Field '" + field.name_ + "' doesn't support in");
+        }
+        text_.append(field.name_).append(" in ");
+        return CompileValue(*node.children_[1], ListKind(kind));
+    }
+
+    Status
+    CompileRange(const ExprNode& node) {
+        const auto& field = *node.children_[0];
+        if (field.type_ != ExprNode::Type::FIELD) {
+            return Status(StatusCode::InvalidAgument, "Between() must be called on a field");
+        }
+        ExprValue::Kind kind = ExprValue::Kind::NONE;
+        auto status = FieldKind(field, kind);
+        if (!status.IsOk()) {
+            return status;
+        }
+        if (kind != ExprValue::Kind::INT64 && kind != ExprValue::Kind::DOUBLE) {
+            return Status(StatusCode::InvalidAgument, "Field '" + field.name_ + "' doesn't support range");
+        }
+        const char* op = node.inclusive_ ? " <= " : " < ";
+        status = CompileValue(*node.children_[1], kind);
+        if (!status.IsOk()) {
+            return status;
+        }
+        text_.append(op).append(field.name_).append(op);
+        return CompileValue(*node.children_[2], kind);
+    }
+
+    Status
+    CompilePredicate(const ExprNode& node) {
+        switch (node.type_) {
+            case ExprNode::Type::FIELD: {
+                ExprValue::Kind kind = ExprValue::Kind::NONE;
+                auto status = FieldKind(node, kind);
+                if (!status.IsOk()) {
+                    return status;
+                }
+                if (kind != ExprValue::Kind::BOOL) {
+                    return Status(StatusCode::InvalidAgument, "Field '" + node.name_ + "' is not a bool field");
+                }
+                text_.append(node.name_);
+                return Status::OK();
+            }
+            case ExprNode::Type::COMPARE:
+                return CompileCompare(node);
+            case ExprNode::Type::IN:
+                return CompileIn(node);
+            case ExprNode::Type::RANGE:
+                return CompileRange(node);
+            case ExprNode::Type::AND:
+            case ExprNode::Type::OR: {
+                text_.push_back('(');
+                auto status = CompilePredicate(*node.children_[0]);
+                if (!status.IsOk()) {
+                    return status;
+                }
+                text_.append(node.type_ == ExprNode::Type::AND ? ") && (" : ") || (");
+                status = CompilePredicate(*node.children_[1]);
+                text_.push_back(')');
+                return status;
+            }
+            case ExprNode::Type::NOT: {
+                text_.append("not (");
+                auto status = CompilePredicate(*node.children_[0]);
+                text_.push_back(')');
+                return status;
+            }
+            default:
+                return Status(StatusCode::InvalidAgument, "Expression is not a boolean predicate");
+        }
+    }
+
+ private:
+    std::unordered_map<std::string, ExprValue::Kind> field_kinds_;
+    CompiledExpr* compiled_ = nullptr;
+    std::string text_;
+};
+
+}  // namespace
+
+Expr
+Expr::Field(const std::string& name) {
+    return Expr(MakeNode(ExprNode::Type::FIELD, name, {}));
+}
+
+Expr
+Expr::Param(const std::string& name) {
+    return Expr(MakeNode(ExprNode::Type::PARAM, name, {}));
+}
+
+Expr
+Expr::Value(bool value) {
+    return Expr(MakeLiteral(ExprValue(value)));
+}
+
+Expr
+Expr::Value(int value) {
+    return Expr(MakeLiteral(ExprValue(static_cast<int64_t>(value))));
+}
+
+Expr
+Expr::Value(int64_t value) {
+    return Expr(MakeLiteral(ExprValue(value)));
+}
+
+Expr
+Expr::Value(double value) {
+    return Expr(MakeLiteral(ExprValue(value)));
+}
+
+Expr
+Expr::Value(const std::string& value) {
+    return Expr(MakeLiteral(ExprValue(value)));
+}
+
+Expr
+Expr::Value(const char* value) {
+    return Expr(MakeLiteral(ExprValue(std::string(value))));
+}
+
+Expr
+Expr::In(const std::vector<int64_t>& values) const {
+    return Expr(MakeNode(ExprNode::Type::IN, "", {node_, MakeLiteral(ExprValue(values))}));
+}
+
+Expr
+Expr::In(const std::vector<std::string>& values) const {
+    return Expr(MakeNode(ExprNode::Type::IN, "", {node_, MakeLiteral(ExprValue(values))}));
+}
+
+Expr
+Expr::In(const Expr& param) const {
+    return Expr(MakeNode(ExprNode::Type::IN, "", {node_, param.node_}));
+}
+
+Expr
+Expr::Between(const Expr& lower, const Expr& upper, bool inclusive) const {
+    auto node = std::make_shared<ExprNode>(ExprNode::Type::RANGE, "");
+    node->children_ = {node_, lower.node_, upper.node_};
+    node->inclusive_ = inclusive;
+    return Expr(std::move(node));
+}
+
+Expr
+operator==(const Expr& lhs, const Expr& rhs) {
+    return Expr(MakeNode(ExprNode::Type::COMPARE, "==", {lhs.node_, rhs.node_}));
+}
+
+Expr
+operator!=(const Expr& lhs, const Expr& rhs) {
+    return Expr(MakeNode(ExprNode::Type::COMPARE, "!=", {lhs.node_, rhs.node_}));
+}
+
+Expr
+operator<(const Expr& lhs, const Expr& rhs) {
+    return Expr(MakeNode(ExprNode::Type::COMPARE, "<", {lhs.node_, rhs.node_}));
+}
+
+Expr
+operator<=(const Expr& lhs, const Expr& rhs) {
+    return Expr(MakeNode(ExprNode::Type::COMPARE, "<=", {lhs.node_, rhs.node_}));
+}
+
+Expr
+operator>(const Expr& lhs, const Expr& rhs) {
+    return Expr(MakeNode(ExprNode::Type::COMPARE, ">", {lhs.node_, rhs.node_}));
+}
+
+Expr
+operator>=(const Expr& lhs, const Expr& rhs) {
+    return Expr(MakeNode(ExprNode::Type::COMPARE, ">=", {lhs.node_, rhs.node_}));
+}
+
+Expr
+operator&&(const Expr& lhs, const Expr& rhs) {
+    return Expr(MakeNode(ExprNode::Type::AND, "", {lhs.node_, rhs.node_}));
+}
+
+Expr
+operator||(const Expr& lhs, const Expr& rhs) {
+    return Expr(MakeNode(ExprNode::Type::OR, "", {lhs.node_, rhs.node_}));
+}
+
+Expr
+operator!(const Expr& expr) {
+    return Expr(MakeNode(ExprNode::Type::NOT, "", {expr.node_}));
+}
+
+ExprParams::ExprParams(const std::shared_ptr<const CompiledExpr>& compiled)
+    : compiled_(compiled), values_(compiled->param_names_.size()) {
+}
+
+bool
+ExprParams::Set(const std::string& name, const ExprValue& value) {
+    if (compiled_ == nullptr) {
+        return false;
+    }
+    int slot = compiled_->FindParam(name);
+    if (slot < 0) {
+        return false;
+    }
+    values_[slot] = value;
+    return true;
+}
+
+Status
+PreparedExpr::Prepare(const Expr& expr, const CollectionSchema& schema, PreparedExpr& prepared) {
+    if (expr.Node() == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Expression is empty");
+    }
+
+    auto compiled = std::make_shared<CompiledExpr>();
+    ExprCompiler compiler(schema);
+    auto status = compiler.Compile(*expr.Node(), *compiled);
+    if (!status.IsOk()) {
+        return status;
+    }
+    prepared.compiled_ = std::move(compiled);
+    return Status::OK();
+}
+
+const std::vector<std::string>&
+PreparedExpr::ParamNames() const {
+    static const std::vector<std::string> empty;
+    return compiled_ == nullptr ? empty : compiled_->param_names_;
+}
+
+ExprParams
+PreparedExpr::NewParams() const {
+    return compiled_ == nullptr ? ExprParams() : ExprParams(compiled_);
+}
+
+Status
+PreparedExpr::Bind(const ExprParams& params, std::string& expression) const {
+    if (compiled_ == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Expression is not prepared");
+    }
+    if (params.compiled_ != compiled_) {
+        return Status(StatusCode::InvalidAgument, "Parameters are not created by this expression");
+    }
+
+    expression.clear();
+    expression.reserve(compiled_->text_length_);
+    for (const auto& segment : compiled_->segments_) {
+        expression.append(segment.text_);
+        if (segment.slot_ < 0) {
+            continue;
+        }
+        const auto& value = params.values_[segment.slot_];
+        if (value.ValueKind() == ExprValue::Kind::NONE) {
+            return Status(StatusCode::InvalidAgument,
+                          "Placeholder '" + compiled_->param_names_[segment.slot_] + "' is not set");
+        }
+        if (!IsCompatible(compiled_->param_kinds_[segment.slot_], value.ValueKind())) {
+            return Status(StatusCode::InvalidAgument,
+                          "Value type of placeholder '" + compiled_->param_names_[segment.slot_] + "' is mismatched");
+        }
+        if (!IsFinite(value)) {
+            return Status(StatusCode::InvalidAgument,
+                          "Value of placeholder '" + compiled_->param_names_[segment.slot_] + "' must be finite");
+        }
+        AppendValue(expression, value);
+    }
+    return Status::OK();
+}
+
+}  // namespace milvus
@@ -0,0 +1,116 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ExprFormatter.h"
+
+namespace milvus {
+
+namespace {
+
+const char kDigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+size_t
+DigitCount(uint64_t value) {
+    size_t count = 1;
+    while (value >= 10000) {
+        value /= 10000;
+        count += 4;
+    }
+    if (value >= 1000) {
+        return count + 3;
+    }
+    if (value >= 100) {
+        return count + 2;
+    }
+    if (value >= 10) {
+        return count + 1;
+    }
+    return count;
+}
+
+uint64_t
+Magnitude(int64_t value) {
+    // negate in unsigned arithmetic so that INT64_MIN doesn't overflow
+    return value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+}
+
+}  // namespace
+
+size_t
+Int64Length(int64_t value) {
+    return DigitCount(Magnitude(value)) + (value < 0 ? 1 : 0);
+}
+
+void
+AppendInt64(std::string& out, int64_t value) {
+    uint64_t magnitude = Magnitude(value);
+    const size_t length = Int64Length(value);
+    const size_t start = out.size();
+    out.resize(start + length);
+
+    char* end = &out[start] + length;
+    while (magnitude >= 100) {
+        const size_t pair = static_cast<size_t>(magnitude % 100) * 2;
+        magnitude /= 100;
+        *--end = kDigitPairs[pair + 1];
+        *--end = kDigitPairs[pair];
+    }
+    if (magnitude >= 10) {
+        const size_t pair = static_cast<size_t>(magnitude) * 2;
+        *--end = kDigitPairs[pair + 1];
+        *--end = kDigitPairs[pair];
+    } else {
+        *--end = static_cast<char>('0' + magnitude);
+    }
+    if (value < 0) {
+        *--end = '-';
+    }
+}
+
+size_t
+QuotedLength(const std::string& value) {
+    size_t length = value.size() + 2;
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            ++length;
+        }
+    }
+    return length;
+}
+
+void
+AppendQuoted(std::string& out, const std::string& value) {
+    out.push_back('"');
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out.push_back('\\');
+        }
+        out.push_back(c);
+    }
+    out.push_back('"');
+}
+
+}  // namespace milvus
@@ -0,0 +1,49 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace milvus {
+
+/**
+ * @brief Length of the decimal text of value, including the minus sign.
+ */
+size_t
+Int64Length(int64_t value);
+
+/**
+ * @brief Append the decimal text of value, two digits are converted per step without going through a stream.
+ */
+void
+AppendInt64(std::string& out, int64_t value);
+
+/**
+ * @brief Length of value as a quoted string literal of the expression.
+ */
+size_t
+QuotedLength(const std::string& value);
+
+/**
+ * @brief Append value as a double quoted string literal, escaping quotes and backslashes.
+ */
+void
+AppendQuoted(std::string& out, const std::string& value);
+
+}  // namespace milvus
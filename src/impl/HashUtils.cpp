@@ -0,0 +1,69 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "HashUtils.h"
+
+namespace milvus {
+
+namespace {
+
+constexpr uint32_t kMurmurC1 = 0xcc9e2d51;
+constexpr uint32_t kMurmurC2 = 0x1b873593;
+
+inline uint32_t
+RotateLeft(uint32_t x, int r) {
+    return (x << r) | (x >> (32 - r));
+}
+
+inline uint32_t
+MixBlock(uint32_t h, uint32_t k) {
+    k *= kMurmurC1;
+    k = RotateLeft(k, 15);
+    k *= kMurmurC2;
+    h ^= k;
+    h = RotateLeft(h, 13);
+    return h * 5 + 0xe6546b64;
+}
+
+inline uint32_t
+Murmur3Int64(uint64_t key) {
+    uint32_t h = 0;
+    h = MixBlock(h, static_cast<uint32_t>(key));
+    h = MixBlock(h, static_cast<uint32_t>(key >> 32));
+    h ^= 8;  // length of the key in bytes
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h & 0x7fffffff;
+}
+
+}  // namespace
+
+uint32_t
+HashInt64Key(int64_t key) {
+    return Murmur3Int64(static_cast<uint64_t>(key));
+}
+
+void
+HashInt64Keys(const int64_t* keys, size_t count, uint32_t* hashes) {
+    for (size_t i = 0; i < count; ++i) {
+        hashes[i] = Murmur3Int64(static_cast<uint64_t>(keys[i]));
+    }
+}
+
+}  // namespace milvus
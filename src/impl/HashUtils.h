@@ -0,0 +1,39 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace milvus {
+
+/**
+ * @brief Hash of an int64 primary key, same as the server: murmur3 32-bit with seed 0 on the 8 little-endian
+ * bytes of the key, masked to 31 bits. The shard of an entity is hash % shard_num.
+ */
+uint32_t
+HashInt64Key(int64_t key);
+
+/**
+ * @brief Hash an array of int64 primary keys.
+ *
+ * The loop has no branch and no cross-iteration dependency, so the compiler can vectorize it.
+ */
+void
+HashInt64Keys(const int64_t* keys, size_t count, uint32_t* hashes);
+
+}  // namespace milvus
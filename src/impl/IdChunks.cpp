@@ -0,0 +1,174 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "IdChunks.h"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <mutex>
+
+#include "ExprFormatter.h"
+
+namespace milvus {
+
+namespace {
+
+size_t
+FormattedLength(int64_t id) {
+    return Int64Length(id);
+}
+
+size_t
+FormattedLength(const std::string& id) {
+    return QuotedLength(id);
+}
+
+void
+AppendId(std::string& expression, int64_t id) {
+    AppendInt64(expression, id);
+}
+
+void
+AppendId(std::string& expression, const std::string& id) {
+    AppendQuoted(expression, id);
+}
+
+template <typename T>
+std::vector<size_t>
+SplitChunks(const std::vector<T>& ids, size_t prefix_length, size_t limit) {
+    std::vector<size_t> bounds{0};
+    size_t length = prefix_length;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const size_t id_length = FormattedLength(ids[i]) + 1;  // with separator
+        if (length + id_length > limit && i > bounds.back()) {
+            bounds.push_back(i);
+            length = prefix_length;
+        }
+        length += id_length;
+    }
+    bounds.push_back(ids.size());
+    return bounds;
+}
+
+template <typename T>
+void
+FormatChunk(const std::vector<T>& ids, const std::string& primary_name, size_t begin, size_t end,
+            std::string& expression) {
+    expression.clear();
+    expression.append(primary_name).append(" in [");
+    for (size_t i = begin; i < end; ++i) {
+        if (i > begin) {
+            expression.push_back(',');
+        }
+        AppendId(expression, ids[i]);
+    }
+    expression.push_back(']');
+}
+
+template <typename T>
+void
+FormatRange(const std::vector<T>& ids, const std::string& primary_name, size_t begin, size_t end,
+            std::string& expression) {
+    expression.clear();
+    expression.append(primary_name).append(" >= ");
+    AppendId(expression, ids[begin]);
+    expression.append(" && ").append(primary_name).append(" <= ");
+    AppendId(expression, ids[end - 1]);
+}
+
+}  // namespace
+
+std::vector<size_t>
+SplitIdChunks(const std::vector<int64_t>& ids, size_t prefix_length, size_t limit) {
+    return SplitChunks(ids, prefix_length, limit);
+}
+
+std::vector<size_t>
+SplitIdChunks(const std::vector<std::string>& ids, size_t prefix_length, size_t limit) {
+    return SplitChunks(ids, prefix_length, limit);
+}
+
+void
+FormatIdChunk(const std::vector<int64_t>& ids, const std::string& primary_name, size_t begin, size_t end,
+              std::string& expression) {
+    FormatChunk(ids, primary_name, begin, end, expression);
+}
+
+void
+FormatIdChunk(const std::vector<std::string>& ids, const std::string& primary_name, size_t begin, size_t end,
+              std::string& expression) {
+    FormatChunk(ids, primary_name, begin, end, expression);
+}
+
+void
+FormatIdRange(const std::vector<int64_t>& ids, const std::string& primary_name, size_t begin, size_t end,
+              std::string& expression) {
+    FormatRange(ids, primary_name, begin, end, expression);
+}
+
+void
+FormatIdRange(const std::vector<std::string>& ids, const std::string& primary_name, size_t begin, size_t end,
+              std::string& expression) {
+    FormatRange(ids, primary_name, begin, end, expression);
+}
+
+Status
+DeleteInChunks(ThreadPool& pool, size_t chunk_count, size_t concurrency,
+               const std::function<void(size_t, std::string&)>& format,
+               const std::function<Status(const std::string&, DmlResults&)>& send, DmlResults& results) {
+    std::mutex mutex;
+    Status first_error;
+    int64_t delete_count = 0;
+    uint64_t timestamp = 0;
+    std::atomic<size_t> next_chunk{0};
+
+    auto worker = [&]() {
+        std::string expression;
+        for (size_t chunk = next_chunk++; chunk < chunk_count; chunk = next_chunk++) {
+            format(chunk, expression);
+            DmlResults chunk_results;
+            auto status = send(expression, chunk_results);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!status.IsOk()) {
+                if (first_error.IsOk()) {
+                    first_error = status;
+                }
+                continue;
+            }
+            delete_count += chunk_results.DeleteCount();
+            timestamp = std::max(timestamp, chunk_results.Timestamp());
+        }
+    };
+
+    // the calling thread is a worker too, so the chunks are sent even if the pool is busy
+    const size_t worker_count = std::min(chunk_count, concurrency);
+    std::vector<std::future<void>> futures;
+    for (size_t i = 1; i < worker_count; ++i) {
+        futures.emplace_back(pool.Enqueue(worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.wait();
+    }
+
+    results.SetDeleteCount(delete_count);
+    results.SetTimestamp(timestamp);
+    return first_error;
+}
+
+}  // namespace milvus
@@ -0,0 +1,88 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Status.h"
+#include "ThreadPool.h"
+#include "types/DmlResults.h"
+
+namespace milvus {
+
+/**
+ * @brief Size limit of each "pk in [...]" expression generated for a list of primary keys.
+ */
+constexpr size_t kIdExpressionBytes = 256 * 1024;
+
+/**
+ * @brief Max number of delete requests of one DeleteByIds() call in flight.
+ */
+constexpr size_t kDeleteConcurrency = 4;
+
+/**
+ * @brief Split ids into chunks whose expression doesn't exceed limit bytes, return the start offset of each chunk
+ * followed by ids.size(). A single id longer than the limit makes a chunk of its own.
+ *
+ * @param [in] prefix_length length of the "pk in []" around the ids
+ */
+std::vector<size_t>
+SplitIdChunks(const std::vector<int64_t>& ids, size_t prefix_length, size_t limit = kIdExpressionBytes);
+
+std::vector<size_t>
+SplitIdChunks(const std::vector<std::string>& ids, size_t prefix_length, size_t limit = kIdExpressionBytes);
+
+/**
+ * @brief Write "primary_name in [...]" of ids[begin, end) into expression, its capacity is reused.
+ */
+void
+FormatIdChunk(const std::vector<int64_t>& ids, const std::string& primary_name, size_t begin, size_t end,
+              std::string& expression);
+
+void
+FormatIdChunk(const std::vector<std::string>& ids, const std::string& primary_name, size_t begin, size_t end,
+              std::string& expression);
+
+/**
+ * @brief Write "primary_name >= ids[begin] && primary_name <= ids[end - 1]" into expression, ids must be sorted and
+ * begin < end. Unlike FormatIdChunk() its length doesn't grow with the chunk.
+ */
+void
+FormatIdRange(const std::vector<int64_t>& ids, const std::string& primary_name, size_t begin, size_t end,
+              std::string& expression);
+
+void
+FormatIdRange(const std::vector<std::string>& ids, const std::string& primary_name, size_t begin, size_t end,
+              std::string& expression);
+
+/**
+ * @brief Send the chunks of a delete by up to concurrency workers, the calling thread and the others from pool.
+ *
+ * format(chunk, expression) writes the expression of a chunk right before it is sent, so formatting overlaps with
+ * the rpc of other workers. All chunks are sent even if some fail, results sums the delete counts of the succeeded
+ * ones and the first error is returned.
+ */
+Status
+DeleteInChunks(ThreadPool& pool, size_t chunk_count, size_t concurrency,
+               const std::function<void(size_t, std::string&)>& format,
+               const std::function<Status(const std::string&, DmlResults&)>& send, DmlResults& results);
+
+}  // namespace milvus
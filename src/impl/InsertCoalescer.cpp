@@ -0,0 +1,201 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "InsertCoalescer.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "TypeUtils.h"
+
+namespace milvus {
+
+namespace {
+
+uint32_t
+VectorDimension(const Field& field) {
+    switch (field.Type()) {
+        case DataType::BINARY_VECTOR:
+            return static_cast<const BinaryVecFieldData&>(field).Dimension();
+        case DataType::FLOAT_VECTOR:
+            return static_cast<const FloatVecFieldData&>(field).Dimension();
+        default:
+            return 0;
+    }
+}
+
+template <typename T, typename Repeated>
+std::vector<T>
+SliceIds(const Repeated& ids, size_t offset, size_t count) {
+    if (static_cast<size_t>(ids.size()) < offset + count) {
+        return std::vector<T>();
+    }
+    return std::vector<T>(ids.begin() + offset, ids.begin() + offset + count);
+}
+
+}  // namespace
+
+InsertCoalescer::InsertCoalescer(const InsertCoalesceConfig& config, Send send)
+    : config_(config), send_(std::move(send)) {
+}
+
+std::string
+InsertCoalescer::BatchKey(const std::string& collection_name, const std::string& partition_name,
+                          const std::vector<FieldDataPtr>& fields) {
+    std::string key = collection_name;
+    key.push_back('\0');
+    key.append(partition_name);
+    for (const auto& field : fields) {
+        key.push_back('\0');
+        key.append(field->Name());
+        key.push_back('\1');
+        key.append(std::to_string(static_cast<int>(field->Type())));
+        key.push_back('\1');
+        key.append(std::to_string(VectorDimension(*field)));
+    }
+    return key;
+}
+
+Status
+InsertCoalescer::Insert(const std::string& collection_name, const std::string& partition_name,
+                        const std::vector<FieldDataPtr>& fields, DmlResults& results) {
+    if (fields.empty()) {
+        return Status(StatusCode::InvalidAgument, "Fields cannot be empty!");
+    }
+    const size_t row_count = fields.front()->Count();
+    uint64_t bytes = 0;
+    for (const auto& field : fields) {
+        if (field->Count() != row_count) {
+            return Status(StatusCode::InvalidAgument, "Row count of field '" + field->Name() + "' is mismatched!");
+        }
+        bytes += FieldDataBytes(*field);
+    }
+
+    const auto key = BatchKey(collection_name, partition_name, fields);
+    std::shared_ptr<Batch> batch;
+    std::future<Outcome> future;
+    bool leader = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto iter = batches_.find(key);
+        // a call that would overflow the open batch seals it and opens the next one
+        if (iter != batches_.end() && (iter->second->rows_ + row_count > config_.MaxBatchRows() ||
+                                       iter->second->bytes_ + bytes > config_.MaxBatchBytes())) {
+            Seal(key, iter->second);
+            iter = batches_.end();
+        }
+        if (iter == batches_.end()) {
+            batch = std::make_shared<Batch>();
+            batch->collection_name_ = collection_name;
+            batch->partition_name_ = partition_name;
+            for (const auto& field : fields) {
+                batch->fields_.push_back(GatherRows(*field, {}));
+            }
+            batches_[key] = batch;
+            leader = true;
+        } else {
+            batch = iter->second;
+        }
+
+        for (size_t i = 0; i < fields.size(); ++i) {
+            AppendRows(*fields[i], *batch->fields_[i]);
+        }
+        Caller caller;
+        caller.offset_ = batch->rows_;
+        caller.count_ = row_count;
+        future = caller.promise_.get_future();
+        batch->callers_.push_back(std::move(caller));
+        batch->rows_ += row_count;
+        batch->bytes_ += bytes;
+        if (batch->rows_ >= config_.MaxBatchRows() || batch->bytes_ >= config_.MaxBatchBytes()) {
+            Seal(key, batch);
+        }
+
+        if (leader) {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(config_.MaxDelayUs());
+            batch->sealed_cv_.wait_until(lock, deadline, [&batch] { return batch->sealed_; });
+            Seal(key, batch);
+        }
+    }
+
+    if (leader) {
+        proto::milvus::MutationResult response;
+        auto status = send_(batch->collection_name_, batch->partition_name_, batch->fields_, response);
+        Complete(status, response, *batch);
+    }
+
+    auto outcome = future.get();
+    results = std::move(outcome.results_);
+    return outcome.status_;
+}
+
+void
+InsertCoalescer::Seal(const std::string& key, const std::shared_ptr<Batch>& batch) {
+    if (batch->sealed_) {
+        return;
+    }
+    batch->sealed_ = true;
+    auto iter = batches_.find(key);
+    if (iter != batches_.end() && iter->second == batch) {
+        batches_.erase(iter);
+    }
+    batch->sealed_cv_.notify_all();
+}
+
+void
+InsertCoalescer::Complete(const Status& status, const proto::milvus::MutationResult& response, Batch& batch) {
+    const bool server_failed = response.status().error_code() != proto::common::ErrorCode::Success;
+    const auto& error_index = response.err_index();
+    for (auto& caller : batch.callers_) {
+        Outcome outcome;
+        if (!status.IsOk()) {
+            outcome.status_ = status;
+            caller.promise_.set_value(std::move(outcome));
+            continue;
+        }
+        // without per-row errors a failed response fails every row
+        if (server_failed && error_index.empty()) {
+            outcome.status_ = Status(StatusCode::ServerFailed, response.status().reason());
+            caller.promise_.set_value(std::move(outcome));
+            continue;
+        }
+
+        std::vector<uint32_t> error_rows;
+        for (auto index : error_index) {
+            if (index >= caller.offset_ && index < caller.offset_ + caller.count_) {
+                error_rows.push_back(static_cast<uint32_t>(index - caller.offset_));
+            }
+        }
+        const auto& ids = response.ids();
+        if (ids.has_str_id()) {
+            outcome.results_.SetIdArray(
+                IDArray(SliceIds<std::string>(ids.str_id().data(), caller.offset_, caller.count_)));
+        } else {
+            outcome.results_.SetIdArray(IDArray(SliceIds<int64_t>(ids.int_id().data(), caller.offset_, caller.count_)));
+        }
+        outcome.results_.SetTimestamp(response.timestamp());
+        outcome.results_.SetInsertCount(static_cast<int64_t>(caller.count_ - error_rows.size()));
+        if (!error_rows.empty()) {
+            outcome.status_ = Status(StatusCode::ServerFailed, std::to_string(error_rows.size()) + " of " +
+                                                                   std::to_string(caller.count_) +
+                                                                   " rows failed: " + response.status().reason());
+        }
+        outcome.results_.SetErrorRows(std::move(error_rows));
+        caller.promise_.set_value(std::move(outcome));
+    }
+}
+
+}  // namespace milvus
@@ -0,0 +1,118 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Status.h"
+#include "milvus.pb.h"
+#include "types/DmlResults.h"
+#include "types/FieldData.h"
+#include "types/InsertCoalesceConfig.h"
+
+namespace milvus {
+
+/**
+ * @brief Group commit of small inserts with the same collection, partition and fields.
+ *
+ * The caller that opens a batch is its leader: it waits until the batch is full or MaxDelayUs() has passed, sends
+ * the batch and hands each caller the ids and errors of its rows. The other callers append their rows and wait.
+ * No thread is created, a batch is always sent by one of its callers. It is thread safe.
+ */
+class InsertCoalescer {
+ public:
+    /**
+     * @brief Send one insert request built from fields, return the rpc status and fill response.
+     */
+    using Send = std::function<Status(const std::string& collection_name, const std::string& partition_name,
+                                      const std::vector<FieldDataPtr>& fields, proto::milvus::MutationResult&)>;
+
+    InsertCoalescer(const InsertCoalesceConfig& config, Send send);
+
+    const InsertCoalesceConfig&
+    Config() const {
+        return config_;
+    }
+
+    /**
+     * @brief Insert the rows of fields as part of a batch, return after the batch is sent.
+     */
+    Status
+    Insert(const std::string& collection_name, const std::string& partition_name,
+           const std::vector<FieldDataPtr>& fields, DmlResults& results);
+
+ private:
+    struct Outcome {
+        Status status_;
+        DmlResults results_;
+    };
+
+    struct Caller {
+        size_t offset_ = 0;
+        size_t count_ = 0;
+        std::promise<Outcome> promise_;
+    };
+
+    struct Batch {
+        std::string collection_name_;
+        std::string partition_name_;
+        std::vector<FieldDataPtr> fields_;
+        size_t rows_ = 0;
+        uint64_t bytes_ = 0;
+        std::vector<Caller> callers_;
+        // no caller can join once sealed
+        bool sealed_ = false;
+        std::condition_variable sealed_cv_;
+    };
+
+    /**
+     * @brief Key of the batches a call can join: collection, partition and the name, type and dimension of each
+     * field.
+     */
+    static std::string
+    BatchKey(const std::string& collection_name, const std::string& partition_name,
+             const std::vector<FieldDataPtr>& fields);
+
+    /**
+     * @brief Remove the batch from the open batches, called with mutex_ held.
+     */
+    void
+    Seal(const std::string& key, const std::shared_ptr<Batch>& batch);
+
+    /**
+     * @brief Split the response of a batch to its callers.
+     */
+    static void
+    Complete(const Status& status, const proto::milvus::MutationResult& response, Batch& batch);
+
+ private:
+    const InsertCoalesceConfig config_;
+    const Send send_;
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<Batch>> batches_;
+};
+
+}  // namespace milvus
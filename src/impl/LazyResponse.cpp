@@ -0,0 +1,402 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "LazyResponse.h"
+
+#include <cstring>
+
+#include "TypeUtils.h"
+#include "WireReader.h"
+#include "common.pb.h"
+#include "schema.pb.h"
+
+namespace milvus {
+
+namespace {
+
+// field numbers of milvus.proto and schema.proto
+constexpr uint32_t kResultsStatusField = 1;
+constexpr uint32_t kSearchResultsDataField = 2;
+constexpr uint32_t kQueryResultsFieldsField = 2;
+constexpr uint32_t kStatusErrorCodeField = 1;
+constexpr uint32_t kStatusReasonField = 2;
+constexpr uint32_t kNumQueriesField = 1;
+constexpr uint32_t kFieldsDataField = 3;
+constexpr uint32_t kScoresField = 4;
+constexpr uint32_t kIdsField = 5;
+constexpr uint32_t kTopksField = 6;
+constexpr uint32_t kFieldNameField = 2;
+
+const std::vector<int64_t>&
+EmptyTopks() {
+    static const std::vector<int64_t> empty;
+    return empty;
+}
+
+const IDArray&
+EmptyIds() {
+    static const IDArray empty;
+    return empty;
+}
+
+const Status&
+MalformedResponse() {
+    static const Status status(StatusCode::RPCFailed, "Malformed response!");
+    return status;
+}
+
+}  // namespace
+
+Status
+LazyResponse::ParseSearchResults(const ::grpc::ByteBuffer& buffer, std::shared_ptr<LazyResponse>& response) {
+    auto parsed = std::make_shared<LazyResponse>();
+    if (!parsed->Load(buffer)) {
+        return MalformedResponse();
+    }
+
+    Status status;
+    WireReader reader(parsed->slice_.begin(), parsed->slice_.size());
+    uint32_t field_number = 0;
+    uint32_t wire_type = 0;
+    while (!reader.AtEnd()) {
+        if (!reader.ReadTag(field_number, wire_type)) {
+            return MalformedResponse();
+        }
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        bool ok = true;
+        if (field_number == kResultsStatusField && wire_type == WireReader::LENGTH_DELIMITED) {
+            ok = reader.ReadBytes(data, size) && parsed->ParseStatus(data, size, status);
+        } else if (field_number == kSearchResultsDataField && wire_type == WireReader::LENGTH_DELIMITED) {
+            ok = reader.ReadBytes(data, size) && parsed->ParseSearchResultData(data, size);
+        } else {
+            ok = reader.Skip(wire_type);
+        }
+        if (!ok) {
+            return MalformedResponse();
+        }
+    }
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    size_t offset = 0;
+    parsed->hit_offsets_.reserve(parsed->topks_.size());
+    for (auto topk : parsed->topks_) {
+        parsed->hit_offsets_.push_back(offset);
+        offset += static_cast<size_t>(topk);
+    }
+    response = std::move(parsed);
+    return Status::OK();
+}
+
+Status
+LazyResponse::ParseQueryResults(const ::grpc::ByteBuffer& buffer, std::shared_ptr<LazyResponse>& response) {
+    auto parsed = std::make_shared<LazyResponse>();
+    if (!parsed->Load(buffer)) {
+        return MalformedResponse();
+    }
+
+    Status status;
+    WireReader reader(parsed->slice_.begin(), parsed->slice_.size());
+    uint32_t field_number = 0;
+    uint32_t wire_type = 0;
+    while (!reader.AtEnd()) {
+        if (!reader.ReadTag(field_number, wire_type)) {
+            return MalformedResponse();
+        }
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        bool ok = true;
+        if (field_number == kResultsStatusField && wire_type == WireReader::LENGTH_DELIMITED) {
+            ok = reader.ReadBytes(data, size) && parsed->ParseStatus(data, size, status);
+        } else if (field_number == kQueryResultsFieldsField && wire_type == WireReader::LENGTH_DELIMITED) {
+            ok = reader.ReadBytes(data, size) && parsed->AddColumn(data, size);
+        } else {
+            ok = reader.Skip(wire_type);
+        }
+        if (!ok) {
+            return MalformedResponse();
+        }
+    }
+    if (!status.IsOk()) {
+        return status;
+    }
+    response = std::move(parsed);
+    return Status::OK();
+}
+
+std::vector<std::string>
+LazyResponse::FieldNames() const {
+    std::vector<std::string> names;
+    names.reserve(columns_.size());
+    for (const auto& column : columns_) {
+        names.push_back(column.name_);
+    }
+    return names;
+}
+
+FieldDataPtr
+LazyResponse::GetField(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& column : columns_) {
+        if (column.name_ != name) {
+            continue;
+        }
+        if (!column.decoded_) {
+            proto::schema::FieldData proto_field;
+            if (proto_field.ParseFromArray(column.data_, static_cast<int>(column.size_))) {
+                column.field_ = CreateFieldData(proto_field);
+            }
+            column.decoded_ = true;
+        }
+        return column.field_;
+    }
+    return nullptr;
+}
+
+const IDArray&
+LazyResponse::Ids() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!ids_decoded_) {
+        proto::schema::IDs proto_ids;
+        if (ids_data_ != nullptr && proto_ids.ParseFromArray(ids_data_, static_cast<int>(ids_size_))) {
+            if (proto_ids.has_str_id()) {
+                const auto& str_ids = proto_ids.str_id().data();
+                ids_ = IDArray(std::vector<std::string>(str_ids.begin(), str_ids.end()));
+            } else {
+                const auto& int_ids = proto_ids.int_id().data();
+                ids_ = IDArray(std::vector<int64_t>(int_ids.begin(), int_ids.end()));
+            }
+        }
+        ids_decoded_ = true;
+    }
+    return ids_;
+}
+
+float
+LazyResponse::Score(size_t index) const {
+    if (!owned_scores_.empty()) {
+        return owned_scores_[index];
+    }
+    // the view is not aligned for float
+    float score = 0;
+    std::memcpy(&score, score_data_ + index * sizeof(float), sizeof(float));
+    return score;
+}
+
+bool
+LazyResponse::Load(const ::grpc::ByteBuffer& buffer) {
+    // a response received in several slices is merged once, otherwise the slice is referenced without copying
+    if (buffer.TrySingleSlice(&slice_).ok()) {
+        return true;
+    }
+    return buffer.DumpToSingleSlice(&slice_).ok();
+}
+
+bool
+LazyResponse::ParseStatus(const uint8_t* data, size_t size, Status& status) const {
+    uint64_t error_code = 0;
+    std::string reason;
+    WireReader reader(data, size);
+    uint32_t field_number = 0;
+    uint32_t wire_type = 0;
+    while (!reader.AtEnd()) {
+        if (!reader.ReadTag(field_number, wire_type)) {
+            return false;
+        }
+        bool ok = true;
+        if (field_number == kStatusErrorCodeField && wire_type == WireReader::VARINT) {
+            ok = reader.ReadVarint(error_code);
+        } else if (field_number == kStatusReasonField && wire_type == WireReader::LENGTH_DELIMITED) {
+            const uint8_t* text = nullptr;
+            size_t length = 0;
+            ok = reader.ReadBytes(text, length);
+            reason.assign(reinterpret_cast<const char*>(text), length);
+        } else {
+            ok = reader.Skip(wire_type);
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    if (error_code != proto::common::ErrorCode::Success) {
+        status = Status(StatusCode::ServerFailed, reason);
+    }
+    return true;
+}
+
+bool
+LazyResponse::ParseSearchResultData(const uint8_t* data, size_t size) {
+    WireReader reader(data, size);
+    uint32_t field_number = 0;
+    uint32_t wire_type = 0;
+    while (!reader.AtEnd()) {
+        if (!reader.ReadTag(field_number, wire_type)) {
+            return false;
+        }
+        const uint8_t* bytes = nullptr;
+        size_t length = 0;
+        uint64_t value = 0;
+        bool ok = true;
+        if (field_number == kNumQueriesField && wire_type == WireReader::VARINT) {
+            ok = reader.ReadVarint(value);
+            num_queries_ = static_cast<int64_t>(value);
+        } else if (field_number == kFieldsDataField && wire_type == WireReader::LENGTH_DELIMITED) {
+            ok = reader.ReadBytes(bytes, length) && AddColumn(bytes, length);
+        } else if (field_number == kScoresField && wire_type == WireReader::LENGTH_DELIMITED) {
+            ok = reader.ReadBytes(bytes, length) && AddScores(bytes, length);
+        } else if (field_number == kScoresField && wire_type == WireReader::FIXED32) {
+            uint32_t bits = 0;
+            ok = reader.ReadFixed32(bits);
+            float score = 0;
+            std::memcpy(&score, &bits, sizeof(float));
+            OwnScores();
+            owned_scores_.push_back(score);
+        } else if (field_number == kIdsField && wire_type == WireReader::LENGTH_DELIMITED) {
+            ok = reader.ReadBytes(ids_data_, ids_size_);
+        } else if (field_number == kTopksField && wire_type == WireReader::LENGTH_DELIMITED) {
+            ok = reader.ReadBytes(bytes, length);
+            WireReader packed(bytes, length);
+            while (ok && !packed.AtEnd()) {
+                ok = packed.ReadVarint(value);
+                topks_.push_back(static_cast<int64_t>(value));
+            }
+        } else if (field_number == kTopksField && wire_type == WireReader::VARINT) {
+            ok = reader.ReadVarint(value);
+            topks_.push_back(static_cast<int64_t>(value));
+        } else {
+            ok = reader.Skip(wire_type);
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+LazyResponse::AddColumn(const uint8_t* data, size_t size) {
+    Column column;
+    column.data_ = data;
+    column.size_ = size;
+
+    WireReader reader(data, size);
+    uint32_t field_number = 0;
+    uint32_t wire_type = 0;
+    while (!reader.AtEnd()) {
+        if (!reader.ReadTag(field_number, wire_type)) {
+            return false;
+        }
+        if (field_number == kFieldNameField && wire_type == WireReader::LENGTH_DELIMITED) {
+            const uint8_t* name = nullptr;
+            size_t length = 0;
+            if (!reader.ReadBytes(name, length)) {
+                return false;
+            }
+            column.name_.assign(reinterpret_cast<const char*>(name), length);
+        } else if (!reader.Skip(wire_type)) {
+            return false;
+        }
+    }
+    columns_.emplace_back(std::move(column));
+    return true;
+}
+
+bool
+LazyResponse::AddScores(const uint8_t* data, size_t size) {
+    if (size % sizeof(float) != 0) {
+        return false;
+    }
+    if (score_data_ == nullptr && owned_scores_.empty()) {
+        score_data_ = data;
+        score_count_ = size / sizeof(float);
+        return true;
+    }
+
+    // more than one run, fall back to a copy
+    OwnScores();
+    const size_t count = size / sizeof(float);
+    const size_t offset = owned_scores_.size();
+    owned_scores_.resize(offset + count);
+    if (count > 0) {
+        std::memcpy(owned_scores_.data() + offset, data, count * sizeof(float));
+    }
+    return true;
+}
+
+void
+LazyResponse::OwnScores() {
+    if (score_data_ == nullptr) {
+        return;
+    }
+    owned_scores_.resize(score_count_);
+    std::memcpy(owned_scores_.data(), score_data_, score_count_ * sizeof(float));
+    score_data_ = nullptr;
+    score_count_ = 0;
+}
+
+std::vector<std::string>
+LazyQueryResults::FieldNames() const {
+    return response_ == nullptr ? std::vector<std::string>() : response_->FieldNames();
+}
+
+FieldDataPtr
+LazyQueryResults::GetFieldByName(const std::string& name) const {
+    return response_ == nullptr ? nullptr : response_->GetField(name);
+}
+
+int64_t
+LazySearchResults::NumQueries() const {
+    return response_ == nullptr ? 0 : response_->NumQueries();
+}
+
+const std::vector<int64_t>&
+LazySearchResults::TopKs() const {
+    return response_ == nullptr ? EmptyTopks() : response_->TopKs();
+}
+
+size_t
+LazySearchResults::HitOffset(size_t query) const {
+    return response_->HitOffsets()[query];
+}
+
+size_t
+LazySearchResults::ScoreCount() const {
+    return response_ == nullptr ? 0 : response_->ScoreCount();
+}
+
+float
+LazySearchResults::Score(size_t index) const {
+    return response_->Score(index);
+}
+
+const IDArray&
+LazySearchResults::Ids() const {
+    return response_ == nullptr ? EmptyIds() : response_->Ids();
+}
+
+std::vector<std::string>
+LazySearchResults::FieldNames() const {
+    return response_ == nullptr ? std::vector<std::string>() : response_->FieldNames();
+}
+
+FieldDataPtr
+LazySearchResults::GetFieldByName(const std::string& name) const {
+    return response_ == nullptr ? nullptr : response_->GetField(name);
+}
+
+}  // namespace milvus
@@ -0,0 +1,125 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Status.h"
+#include "types/LazyResults.h"
+
+namespace milvus {
+
+/**
+ * @brief A received SearchResults or QueryResults kept in its serialized form.
+ *
+ * Parsing only walks the top level fields: status, counts and topks are read, scores are kept as a view into the
+ * buffer, and ids and each column of fields_data are recorded as byte ranges that are decoded on first access.
+ */
+class LazyResponse {
+ public:
+    static Status
+    ParseSearchResults(const ::grpc::ByteBuffer& buffer, std::shared_ptr<LazyResponse>& response);
+
+    static Status
+    ParseQueryResults(const ::grpc::ByteBuffer& buffer, std::shared_ptr<LazyResponse>& response);
+
+    std::vector<std::string>
+    FieldNames() const;
+
+    FieldDataPtr
+    GetField(const std::string& name);
+
+    const IDArray&
+    Ids();
+
+    int64_t
+    NumQueries() const {
+        return num_queries_;
+    }
+
+    const std::vector<int64_t>&
+    TopKs() const {
+        return topks_;
+    }
+
+    const std::vector<size_t>&
+    HitOffsets() const {
+        return hit_offsets_;
+    }
+
+    size_t
+    ScoreCount() const {
+        return owned_scores_.empty() ? score_count_ : owned_scores_.size();
+    }
+
+    float
+    Score(size_t index) const;
+
+ private:
+    struct Column {
+        std::string name_;
+        const uint8_t* data_ = nullptr;
+        size_t size_ = 0;
+        bool decoded_ = false;
+        FieldDataPtr field_;
+    };
+
+    bool
+    Load(const ::grpc::ByteBuffer& buffer);
+
+    bool
+    ParseStatus(const uint8_t* data, size_t size, Status& status) const;
+
+    bool
+    ParseSearchResultData(const uint8_t* data, size_t size);
+
+    bool
+    AddColumn(const uint8_t* data, size_t size);
+
+    bool
+    AddScores(const uint8_t* data, size_t size);
+
+    void
+    OwnScores();
+
+ private:
+    ::grpc::Slice slice_;
+
+    int64_t num_queries_ = 0;
+    std::vector<int64_t> topks_;
+    std::vector<size_t> hit_offsets_;
+
+    // scores are read in place when they come in one packed run, otherwise they are copied
+    const uint8_t* score_data_ = nullptr;
+    size_t score_count_ = 0;
+    std::vector<float> owned_scores_;
+
+    std::mutex mutex_;
+    const uint8_t* ids_data_ = nullptr;
+    size_t ids_size_ = 0;
+    bool ids_decoded_ = false;
+    IDArray ids_;
+    std::vector<Column> columns_;
+};
+
+}  // namespace milvus
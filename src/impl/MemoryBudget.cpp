@@ -0,0 +1,103 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MemoryBudget.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace milvus {
+
+MemoryBudget::MemoryBudget(const MemoryBudgetConfig& config) : config_(config) {
+}
+
+Status
+MemoryBudget::Reserve(uint64_t bytes, bool wait) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!Fits(bytes)) {
+        if (config_.FailFast() || !wait) {
+            ++reject_count_;
+            return Status(StatusCode::Throttled, "Memory budget of in-flight requests is exhausted!");
+        }
+        ++wait_count_;
+        auto timeout = std::chrono::milliseconds(config_.WaitTimeoutMs());
+        if (!cond_.wait_for(lock, timeout, [this, bytes] { return Fits(bytes); })) {
+            ++reject_count_;
+            return Status(StatusCode::Throttled, "Timeout waiting for memory budget of in-flight requests!");
+        }
+    }
+    used_ += bytes;
+    peak_ = std::max(peak_, used_);
+    return Status::OK();
+}
+
+void
+MemoryBudget::Grow(uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    used_ += bytes;
+    peak_ = std::max(peak_, used_);
+}
+
+void
+MemoryBudget::Release(uint64_t bytes) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        used_ -= std::min(used_, bytes);
+    }
+    cond_.notify_all();
+}
+
+MemoryBudgetStat
+MemoryBudget::Stat() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return MemoryBudgetStat(config_.BudgetBytes(), used_, peak_, wait_count_, reject_count_);
+}
+
+bool
+MemoryBudget::Fits(uint64_t bytes) const {
+    // an oversized request is admitted alone, otherwise it would never be sent
+    return config_.BudgetBytes() == 0 || used_ == 0 || used_ + bytes <= config_.BudgetBytes();
+}
+
+MemoryReservation::MemoryReservation(MemoryBudget* budget, uint64_t bytes, bool wait) : budget_(budget) {
+    if (budget_ != nullptr) {
+        status_ = budget_->Reserve(bytes, wait);
+        if (status_.IsOk()) {
+            bytes_ = bytes;
+        }
+    }
+}
+
+MemoryReservation::~MemoryReservation() {
+    if (budget_ != nullptr && bytes_ > 0) {
+        budget_->Release(bytes_);
+    }
+}
+
+void
+MemoryReservation::Resize(uint64_t bytes) {
+    if (budget_ == nullptr || !status_.IsOk()) {
+        return;
+    }
+    if (bytes > bytes_) {
+        budget_->Grow(bytes - bytes_);
+    } else if (bytes < bytes_) {
+        budget_->Release(bytes_ - bytes);
+    }
+    bytes_ = bytes;
+}
+
+}  // namespace milvus
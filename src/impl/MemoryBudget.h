@@ -0,0 +1,103 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+#include "Status.h"
+#include "types/MemoryBudgetConfig.h"
+#include "types/MemoryBudgetStat.h"
+
+namespace milvus {
+
+/**
+ * @brief Accounting of the bytes held by in-flight requests and responses.
+ */
+class MemoryBudget {
+ public:
+    explicit MemoryBudget(const MemoryBudgetConfig& config);
+
+    /**
+     * @brief Reserve bytes, block or fail by the config when the budget is exhausted. Without wait, fail at once
+     * as in fail-fast mode, used by async calls.
+     */
+    Status
+    Reserve(uint64_t bytes, bool wait = true);
+
+    /**
+     * @brief Grow a reservation without blocking, the payload already exists in memory.
+     */
+    void
+    Grow(uint64_t bytes);
+
+    void
+    Release(uint64_t bytes);
+
+    MemoryBudgetStat
+    Stat() const;
+
+    const MemoryBudgetConfig&
+    Config() const {
+        return config_;
+    }
+
+ private:
+    bool
+    Fits(uint64_t bytes) const;
+
+ private:
+    const MemoryBudgetConfig config_;
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    uint64_t used_ = 0;
+    uint64_t peak_ = 0;
+    uint64_t wait_count_ = 0;
+    uint64_t reject_count_ = 0;
+};
+
+/**
+ * @brief Reserve bytes on construction and release them on destruction, does nothing if budget is null.
+ */
+class MemoryReservation {
+ public:
+    MemoryReservation(MemoryBudget* budget, uint64_t bytes, bool wait = true);
+
+    ~MemoryReservation();
+
+    MemoryReservation(const MemoryReservation&) = delete;
+    MemoryReservation&
+    operator=(const MemoryReservation&) = delete;
+
+    const Status&
+    Result() const {
+        return status_;
+    }
+
+    /**
+     * @brief Correct the reservation to the actual size, for example when the response has arrived.
+     */
+    void
+    Resize(uint64_t bytes);
+
+ private:
+    MemoryBudget* budget_ = nullptr;
+    uint64_t bytes_ = 0;
+    Status status_;
+};
+
+}  // namespace milvus
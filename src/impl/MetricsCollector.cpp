@@ -0,0 +1,198 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MetricsCollector.h"
+
+#include <google/protobuf/struct.pb.h>
+#include <google/protobuf/util/json_util.h>
+
+#include <chrono>
+#include <utility>
+
+namespace milvus {
+
+const char* const kSystemInfoMetricsRequest = R"({"metric_type":"system_info"})";
+
+namespace {
+
+using google::protobuf::Value;
+
+// the json has no schema, every member is optional and a missing or mistyped one reads as zero
+const Value*
+Member(const Value* value, const char* key) {
+    if (value == nullptr || value->kind_case() != Value::kStructValue) {
+        return nullptr;
+    }
+    const auto& fields = value->struct_value().fields();
+    auto it = fields.find(key);
+    return it == fields.end() ? nullptr : &it->second;
+}
+
+double
+Number(const Value* value) {
+    return (value != nullptr && value->kind_case() == Value::kNumberValue) ? value->number_value() : 0;
+}
+
+int64_t
+Integer(const Value* value) {
+    return static_cast<int64_t>(Number(value));
+}
+
+std::string
+Text(const Value* value) {
+    return (value != nullptr && value->kind_case() == Value::kStringValue) ? value->string_value() : std::string();
+}
+
+bool
+Flag(const Value* value) {
+    return value != nullptr && value->kind_case() == Value::kBoolValue && value->bool_value();
+}
+
+TaskQueueMetrics
+ParseTaskQueue(const Value* value) {
+    TaskQueueMetrics queue;
+    queue.unsolved_ = Integer(Member(value, "UnsolvedQueue"));
+    queue.ready_ = Integer(Member(value, "ReadyQueue"));
+    // reported as a go duration in nanoseconds
+    queue.avg_latency_ms_ = Number(Member(value, "AvgQueueDuration")) / 1e6;
+    return queue;
+}
+
+NodeMetrics
+ParseNode(const Value& value) {
+    NodeMetrics node;
+    const Value* infos = Member(&value, "infos");
+    const Value* id = Member(infos, "id");
+    node.node_id_ = id != nullptr ? Integer(id) : Integer(Member(&value, "identifier"));
+    node.type_ = Text(Member(infos, "type"));
+    node.name_ = Text(Member(infos, "name"));
+    node.has_error_ = Flag(Member(infos, "has_error"));
+    node.error_reason_ = Text(Member(infos, "error_reason"));
+
+    const Value* hardware = Member(infos, "hardware_infos");
+    node.ip_ = Text(Member(hardware, "ip"));
+    node.cpu_core_count_ = Integer(Member(hardware, "cpu_core_count"));
+    node.cpu_usage_ = Number(Member(hardware, "cpu_core_usage"));
+    node.memory_bytes_ = Integer(Member(hardware, "memory"));
+    node.memory_usage_bytes_ = Integer(Member(hardware, "memory_usage"));
+    node.disk_bytes_ = Integer(Member(hardware, "disk"));
+    node.disk_usage_bytes_ = Integer(Member(hardware, "disk_usage"));
+
+    const Value* quota = Member(infos, "quota_metrics");
+    node.search_queue_ = ParseTaskQueue(Member(quota, "SearchQueue"));
+    node.query_queue_ = ParseTaskQueue(Member(quota, "QueryQueue"));
+
+    const Value* connected = Member(&value, "connected");
+    if (connected != nullptr && connected->kind_case() == Value::kListValue) {
+        for (const auto& item : connected->list_value().values()) {
+            node.connected_.push_back(Integer(Member(&item, "connected_identifier")));
+        }
+    }
+    return node;
+}
+
+}  // namespace
+
+Status
+ParseSystemInfo(const std::string& response, const std::string& component_name, int64_t timestamp_ms,
+                ServerMetrics& metrics) {
+    Value root;
+    auto parse_status = google::protobuf::util::JsonStringToMessage(response, &root);
+    if (!parse_status.ok()) {
+        return Status(StatusCode::UnknownError, "Invalid metrics response: " + parse_status.ToString());
+    }
+    const Value* nodes_info = Member(&root, "nodes_info");
+    if (nodes_info == nullptr || nodes_info->kind_case() != Value::kListValue) {
+        return Status(StatusCode::UnknownError, "Metrics response has no nodes_info!");
+    }
+
+    std::vector<NodeMetrics> nodes;
+    nodes.reserve(nodes_info->list_value().values_size());
+    for (const auto& item : nodes_info->list_value().values()) {
+        nodes.push_back(ParseNode(item));
+    }
+    metrics = ServerMetrics(timestamp_ms, component_name, std::move(nodes));
+    return Status::OK();
+}
+
+MetricsCollector::MetricsCollector(const MetricsConfig& config, Fetch fetch)
+    : config_(config), fetch_(std::move(fetch)) {
+}
+
+MetricsCollector::~MetricsCollector() {
+    Stop();
+}
+
+void
+MetricsCollector::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!thread_.joinable()) {
+        stopping_ = false;
+        thread_ = std::thread(&MetricsCollector::Run, this);
+    }
+}
+
+void
+MetricsCollector::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cond_.notify_all();
+    if (thread_.joinable() && thread_.get_id() != std::this_thread::get_id()) {
+        thread_.join();
+    }
+}
+
+Status
+MetricsCollector::Collect() {
+    ServerMetrics metrics;
+    auto status = fetch_(metrics);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (config_.Capacity() == 0) {
+        return status;
+    }
+    while (history_.size() >= config_.Capacity()) {
+        history_.pop_front();
+    }
+    history_.push_back(std::move(metrics));
+    return status;
+}
+
+std::vector<ServerMetrics>
+MetricsCollector::History() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::vector<ServerMetrics>(history_.begin(), history_.end());
+}
+
+void
+MetricsCollector::Run() {
+    const std::chrono::milliseconds interval(config_.IntervalMs());
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        lock.unlock();
+        auto next = std::chrono::steady_clock::now() + interval;
+        Collect();
+        lock.lock();
+        cond_.wait_until(lock, next, [this] { return stopping_; });
+    }
+}
+
+}  // namespace milvus
@@ -0,0 +1,100 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Status.h"
+#include "types/MetricsConfig.h"
+#include "types/ServerMetrics.h"
+
+namespace milvus {
+
+/**
+ * @brief Request of GetMetrics() for the system topology.
+ */
+extern const char* const kSystemInfoMetricsRequest;
+
+/**
+ * @brief Parse the jsonic response of a system_info GetMetrics() request.
+ *
+ * @param [in] response json text returned by the server
+ * @param [in] component_name component which answered the request
+ * @param [in] timestamp_ms time the response was received
+ * @param [out] metrics nodes of the topology, members missing from the json are left zero
+ * @return Status operation successfully or not
+ */
+Status
+ParseSystemInfo(const std::string& response, const std::string& component_name, int64_t timestamp_ms,
+                ServerMetrics& metrics);
+
+/**
+ * @brief Poll the server metrics and keep the last snapshots, see MetricsConfig.
+ *
+ * The server is reached through the callback, a background thread created by Start() calls Collect() on the
+ * interval. It is thread safe.
+ */
+class MetricsCollector {
+ public:
+    using Fetch = std::function<Status(ServerMetrics&)>;
+
+    MetricsCollector(const MetricsConfig& config, Fetch fetch);
+
+    ~MetricsCollector();
+
+    void
+    Start();
+
+    void
+    Stop();
+
+    /**
+     * @brief Fetch one snapshot into the ring, a failed fetch keeps the ring unchanged.
+     */
+    Status
+    Collect();
+
+    /**
+     * @brief Snapshots in the ring, oldest first.
+     */
+    std::vector<ServerMetrics>
+    History() const;
+
+ private:
+    void
+    Run();
+
+ private:
+    const MetricsConfig config_;
+    const Fetch fetch_;
+
+    mutable std::mutex mutex_;
+    std::deque<ServerMetrics> history_;
+
+    std::condition_variable cond_;
+    bool stopping_ = false;
+    std::thread thread_;
+};
+
+}  // namespace milvus
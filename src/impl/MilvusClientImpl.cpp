@@ -16,6 +16,23 @@
 
 #include "MilvusClientImpl.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "ExprFormatter.h"
+#include "HashUtils.h"
+#include "IdChunks.h"
+#include "LazyResponse.h"
+#include "QueryNodeBalancer.h"
+#include "Refine.h"
+#include "RowTransposer.h"
+#include "SearchTemplate.h"
+#include "SearchTuner.h"
+#include "ThreadPool.h"
+#include "TypeUtils.h"
+#include "Validator.h"
 #include "common.pb.h"
 #include "milvus.grpc.pb.h"
 #include "milvus.pb.h"
@@ -23,6 +40,210 @@
 
 namespace milvus {
 
+namespace {
+
+Status
+BuildInsertRequest(const std::string& collection_name, const std::string& partition_name,
+                   const std::vector<FieldDataPtr>& fields, proto::milvus::InsertRequest& rpc_request) {
+    if (fields.empty()) {
+        return Status(StatusCode::InvalidAgument, "Fields cannot be empty!");
+    }
+
+    const size_t row_count = fields.front()->Count();
+    rpc_request.set_collection_name(collection_name);
+    rpc_request.set_partition_name(partition_name);
+    rpc_request.set_num_rows(static_cast<uint32_t>(row_count));
+    for (const auto& field : fields) {
+        if (field->Count() != row_count) {
+            return Status(StatusCode::InvalidAgument, "Row count of field '" + field->Name() + "' is mismatched!");
+        }
+        ConvertFieldData(*field, *rpc_request.add_fields_data());
+    }
+    return Status::OK();
+}
+
+void
+BuildQueryRequest(const QueryArguments& arguments, proto::milvus::QueryRequest& rpc_request) {
+    rpc_request.set_collection_name(arguments.CollectionName());
+    rpc_request.set_expr(arguments.Expression());
+    for (const auto& partition_name : arguments.PartitionNames()) {
+        rpc_request.add_partition_names(partition_name);
+    }
+    for (const auto& field_name : arguments.OutputFields()) {
+        rpc_request.add_output_fields(field_name);
+    }
+    rpc_request.set_travel_timestamp(arguments.TravelTimestamp());
+    rpc_request.set_guarantee_timestamp(arguments.GuaranteeTimestamp());
+}
+
+Status
+BuildSearchRequest(const SearchArguments& arguments, proto::milvus::SearchRequest& rpc_request, uint64_t& bytes) {
+    auto status = CheckTargetVectors(arguments.TargetVectors());
+    if (!status.IsOk()) {
+        return status;
+    }
+    BuildSearchRequest(arguments, rpc_request);
+    EncodePlaceholderGroup(*arguments.TargetVectors(), *rpc_request.mutable_placeholder_group());
+    rpc_request.set_guarantee_timestamp(arguments.GuaranteeTimestamp());
+    bytes = rpc_request.ByteSizeLong();
+    return Status::OK();
+}
+
+/**
+ * @brief Data type of the primary key column of each id type.
+ */
+template <typename T>
+struct IdDataType;
+
+template <>
+struct IdDataType<int64_t> : std::integral_constant<DataType, DataType::INT64> {};
+
+template <>
+struct IdDataType<std::string> : std::integral_constant<DataType, DataType::STRING> {};
+
+/**
+ * @brief Response type of each kind of results, lazy results are decoded from the received byte buffer.
+ */
+template <typename Results>
+struct ResponseOf;
+
+template <>
+struct ResponseOf<SearchResults> {
+    using Type = proto::milvus::SearchResults;
+};
+
+template <>
+struct ResponseOf<LazySearchResults> {
+    using Type = ::grpc::ByteBuffer;
+};
+
+template <>
+struct ResponseOf<QueryResults> {
+    using Type = proto::milvus::QueryResults;
+};
+
+template <>
+struct ResponseOf<LazyQueryResults> {
+    using Type = ::grpc::ByteBuffer;
+};
+
+template <typename Response>
+Status
+Invoke(MilvusConnection& connection, const proto::milvus::SearchRequest& rpc_request, Response& response) {
+    return connection.Search(rpc_request, response);
+}
+
+template <typename Response>
+Status
+Invoke(MilvusConnection& connection, const ::grpc::ByteBuffer& rpc_request, Response& response) {
+    return connection.Search(rpc_request, response);
+}
+
+template <typename Response>
+Status
+Invoke(MilvusConnection& connection, const proto::milvus::QueryRequest& rpc_request, Response& response) {
+    return connection.Query(rpc_request, response);
+}
+
+Status
+InvokeAsync(MilvusConnection& connection, const proto::milvus::SearchRequest& rpc_request,
+            TypedAsyncCall<proto::milvus::SearchResults>::Done&& done, std::shared_ptr<AsyncHandle>& handle) {
+    return connection.SearchAsync(rpc_request, std::move(done), handle);
+}
+
+Status
+InvokeAsync(MilvusConnection& connection, const proto::milvus::QueryRequest& rpc_request,
+            TypedAsyncCall<proto::milvus::QueryResults>::Done&& done, std::shared_ptr<AsyncHandle>& handle) {
+    return connection.QueryAsync(rpc_request, std::move(done), handle);
+}
+
+/**
+ * @brief Hand the result of an async operation to its callback, on the executor or on the current thread.
+ */
+template <typename T>
+void
+PostResult(const std::shared_ptr<Executor>& executor, const AsyncCallback<T>& callback, const Status& status,
+           const std::shared_ptr<T>& result) {
+    auto task = [callback, status, result] { callback(status, std::move(*result)); };
+    if (executor != nullptr) {
+        executor->Post(task);
+    } else {
+        task();
+    }
+}
+
+uint64_t
+ResponseBytes(const ::google::protobuf::MessageLite& response) {
+    return response.ByteSizeLong();
+}
+
+uint64_t
+ResponseBytes(const ::grpc::ByteBuffer& response) {
+    return response.Length();
+}
+
+Status
+DecodeResponse(const proto::milvus::DescribeCollectionResponse& response, CollectionDesc& collection_desc) {
+    if (response.status().error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.status().reason());
+    }
+
+    collection_desc.SetSchema(ConvertCollectionSchema(response.schema(), response.shards_num()));
+    collection_desc.SetID(response.collectionid());
+    collection_desc.SetAlias(std::vector<std::string>(response.aliases().begin(), response.aliases().end()));
+    collection_desc.SetCreatedTime(response.created_utc_timestamp());
+    return Status::OK();
+}
+
+Status
+DecodeResponse(const proto::milvus::SearchResults& response, SearchResults& results) {
+    if (response.status().error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.status().reason());
+    }
+    results = ConvertSearchResults(response.results());
+    return Status::OK();
+}
+
+Status
+DecodeResponse(const proto::milvus::QueryResults& response, QueryResults& results) {
+    if (response.status().error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.status().reason());
+    }
+
+    std::vector<FieldDataPtr> output_fields;
+    output_fields.reserve(response.fields_data_size());
+    for (const auto& proto_field : response.fields_data()) {
+        auto field = CreateFieldData(proto_field);
+        if (field != nullptr) {
+            output_fields.emplace_back(std::move(field));
+        }
+    }
+    results = QueryResults(std::move(output_fields));
+    return Status::OK();
+}
+
+Status
+DecodeResponse(const ::grpc::ByteBuffer& response, LazySearchResults& results) {
+    std::shared_ptr<LazyResponse> lazy_response;
+    auto status = LazyResponse::ParseSearchResults(response, lazy_response);
+    if (status.IsOk()) {
+        results = LazySearchResults(std::move(lazy_response));
+    }
+    return status;
+}
+
+Status
+DecodeResponse(const ::grpc::ByteBuffer& response, LazyQueryResults& results) {
+    std::shared_ptr<LazyResponse> lazy_response;
+    auto status = LazyResponse::ParseQueryResults(response, lazy_response);
+    if (status.IsOk()) {
+        results = LazyQueryResults(std::move(lazy_response));
+    }
+    return status;
+}
+
+}  // namespace
+
 std::shared_ptr<MilvusClient>
 MilvusClient::Create() {
     return std::make_shared<MilvusClientImpl>();
@@ -34,25 +255,115 @@ MilvusClientImpl::~MilvusClientImpl() {
 
 Status
 MilvusClientImpl::Connect(const ConnectParam& connect_param) {
+    // filters of the previous connection are dropped below, keep the previous connection if they cannot be saved
+    auto status = SaveDuplicateFilters();
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (compaction_scheduler_ != nullptr) {
+        compaction_scheduler_->Stop();
+        compaction_scheduler_ = nullptr;
+    }
+    if (metrics_collector_ != nullptr) {
+        metrics_collector_->Stop();
+        metrics_collector_ = nullptr;
+    }
     if (connection_ != nullptr) {
         connection_->Disconnect();
     }
 
     // TODO: check connect parameter
 
+    {
+        std::lock_guard<std::mutex> lock(collection_cache_mutex_);
+        collection_cache_.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(duplicate_filters_mutex_);
+        duplicate_filters_.clear();
+        duplicate_filter_config_ = connect_param.DuplicateFilter();
+    }
+
     connection_ = std::make_shared<MilvusConnection>();
-    std::string uri = connect_param.host_ + ":" + std::to_string(connect_param.port_);
+    status = connection_->SetThreading(connect_param.Threading());
+    if (!status.IsOk()) {
+        connection_ = nullptr;
+        return status;
+    }
+    memory_budget_ = std::make_shared<MemoryBudget>(connect_param.MemoryBudget());
+    entity_cache_ = nullptr;
+    if (connect_param.EntityCache().CapacityBytes() > 0) {
+        entity_cache_ = std::make_shared<EntityCache>(connect_param.EntityCache());
+    }
+    insert_coalescer_ = std::make_shared<InsertCoalescer>(
+        connect_param.InsertCoalesce(), [this](const std::string& collection_name, const std::string& partition_name,
+                                               const std::vector<FieldDataPtr>& fields,
+                                               proto::milvus::MutationResult& response) {
+            proto::milvus::InsertRequest rpc_request;
+            auto status = BuildInsertRequest(collection_name, partition_name, fields, rpc_request);
+            if (!status.IsOk()) {
+                return status;
+            }
+            return SendInsertRequest(rpc_request, response);
+        });
+    if (connect_param.Admission().Enabled()) {
+        connection_->SetAdmissionController(std::make_shared<AdmissionController>(connect_param.Admission()));
+    }
+    if (!connect_param.Capture().Path().empty()) {
+        std::shared_ptr<CaptureWriter> capture;
+        status = CaptureWriter::Open(connect_param.Capture(), capture);
+        if (!status.IsOk()) {
+            connection_ = nullptr;
+            return status;
+        }
+        connection_->SetCaptureWriter(std::move(capture));
+    }
+    std::string uri = connect_param.Uri();
+    if (uri.empty()) {
+        uri = connect_param.host_ + ":" + std::to_string(connect_param.port_);
+    }
 
-    return connection_->Connect(uri);
+    status = connection_->Connect(uri, connect_param.ShareChannel(),
+                                  std::chrono::milliseconds(connect_param.ChannelIdleTimeoutMs()));
+    if (status.IsOk() && !connect_param.Compaction().Collections().empty()) {
+        compaction_scheduler_ = std::make_shared<CompactionScheduler>(
+            connect_param.Compaction(),
+            [this](const std::string& collection_name, std::vector<SegmentInfo>& segments) {
+                return GetPersistentSegmentInfo(collection_name, segments);
+            },
+            [this](const std::string& collection_name, int64_t& compaction_id) {
+                return ManualCompaction(collection_name, compaction_id);
+            },
+            [this](int64_t compaction_id, CompactionProgress& progress) {
+                return GetCompactionState(compaction_id, progress);
+            });
+        compaction_scheduler_->Start();
+    }
+    if (status.IsOk() && connect_param.Metrics().IntervalMs() > 0) {
+        metrics_collector_ = std::make_shared<MetricsCollector>(
+            connect_param.Metrics(), [this](ServerMetrics& metrics) { return GetServerMetrics(metrics); });
+        metrics_collector_->Start();
+    }
+    return status;
 }
 
 Status
 MilvusClientImpl::Disconnect() {
+    if (compaction_scheduler_ != nullptr) {
+        compaction_scheduler_->Stop();
+    }
+    if (metrics_collector_ != nullptr) {
+        metrics_collector_->Stop();
+    }
+    auto status = SaveDuplicateFilters();
     if (connection_ != nullptr) {
-        return connection_->Disconnect();
+        auto disconnect_status = connection_->Disconnect();
+        if (!disconnect_status.IsOk()) {
+            return disconnect_status;
+        }
     }
 
-    return Status::OK();
+    return status;
 }
 
 Status
@@ -76,8 +387,8 @@ MilvusClientImpl::CreateCollection(const CollectionSchema& schema) {
         rpc_field->set_is_primary_key(field.IsPrimaryKey());
         rpc_field->set_autoid(field.AutoID());
 
-        proto::common::KeyValuePair* kv = rpc_field->add_type_params();
         for (auto& pair : field.TypeParams()) {
+            proto::common::KeyValuePair* kv = rpc_field->add_type_params();
             kv->set_key(pair.first);
             kv->set_value(pair.second);
         }
@@ -87,6 +398,8 @@ MilvusClientImpl::CreateCollection(const CollectionSchema& schema) {
     rpc_collection.SerializeToString(&binary);
     rpc_request.set_schema(binary);
 
+    rpc_request.set_shards_num(schema.ShardNum());
+
     proto::common::Status response;
     return connection_->CreateCollection(rpc_request, response);
 }
@@ -98,21 +411,102 @@ MilvusClientImpl::HasCollection(const std::string& collection_name, bool& has) {
 
 Status
 MilvusClientImpl::DropCollection(const std::string& collection_name) {
+    auto entity_cache = entity_cache_;
+    if (entity_cache != nullptr) {
+        entity_cache->InvalidateCollection(collection_name);
+    }
+
+    std::lock_guard<std::mutex> lock(collection_cache_mutex_);
+    collection_cache_.erase(collection_name);
     return Status::OK();
 }
 
 Status
 MilvusClientImpl::LoadCollection(const std::string& collection_name, const TimeoutSetting* timeout) {
-    return Status::OK();
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::LoadCollectionRequest rpc_request;
+    rpc_request.set_collection_name(collection_name);
+
+    proto::common::Status response;
+    auto status = connection_->LoadCollection(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (response.error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.reason());
+    }
+    if (timeout == nullptr) {
+        return Status::OK();
+    }
+
+    // the collection is loaded when its in-memory percentage reaches 100
+    proto::milvus::ShowCollectionsRequest show_request;
+    show_request.set_type(proto::milvus::ShowType::InMemory);
+    show_request.add_collection_names(collection_name);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout->WaitingTimeout());
+    while (true) {
+        proto::milvus::ShowCollectionsResponse show_response;
+        status = connection_->ShowCollections(show_request, show_response);
+        if (!status.IsOk()) {
+            return status;
+        }
+        if (show_response.status().error_code() != proto::common::ErrorCode::Success) {
+            return Status(StatusCode::ServerFailed, show_response.status().reason());
+        }
+        if (show_response.inmemory_percentages_size() > 0 && show_response.inmemory_percentages(0) >= 100) {
+            return Status::OK();
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return Status(StatusCode::Timeout, "Loading collection '" + collection_name + "' timeout!");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeout->WaitingInterval()));
+    }
 }
 
 Status
 MilvusClientImpl::ReleaseCollection(const std::string& collection_name) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::ReleaseCollectionRequest rpc_request;
+    rpc_request.set_collection_name(collection_name);
+
+    proto::common::Status response;
+    auto status = connection_->ReleaseCollection(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (response.error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.reason());
+    }
     return Status::OK();
 }
 
 Status
 MilvusClientImpl::DescribeCollection(const std::string& collection_name, CollectionDesc& collection_desc) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::DescribeCollectionRequest rpc_request;
+    rpc_request.set_collection_name(collection_name);
+
+    proto::milvus::DescribeCollectionResponse response;
+    auto status = connection_->DescribeCollection(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    status = DecodeResponse(response, collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    std::lock_guard<std::mutex> lock(collection_cache_mutex_);
+    collection_cache_[collection_name] = collection_desc;
     return Status::OK();
 }
 
@@ -166,4 +560,1588 @@ MilvusClientImpl::ShowPartitions(const std::string& collection_name, const std::
     return Status::OK();
 }
 
+Status
+MilvusClientImpl::Insert(const std::string& collection_name, const std::string& partition_name,
+                         const std::vector<FieldDataPtr>& fields, DmlResults& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::InsertRequest rpc_request;
+    auto status = BuildInsertRequest(collection_name, partition_name, fields, rpc_request);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    return SendInsert(rpc_request, results);
+}
+
+Status
+MilvusClientImpl::Insert(const std::string& collection_name, const std::string& partition_name,
+                         const std::vector<FieldDataPtr>& fields, const InsertOptions& options, DmlResults& results) {
+    if (options.Validate()) {
+        ValidationResults validation;
+        auto status = ValidateInsert(collection_name, fields, validation);
+        if (!status.IsOk()) {
+            results = DmlResults();
+            results.SetErrorRows(validation.ErrorRows());
+            return status;
+        }
+    }
+
+    if (options.Duplicates() == DuplicateAction::NONE) {
+        return InsertRouted(collection_name, partition_name, fields, options, results);
+    }
+
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    CollectionDesc collection_desc;
+    auto status = GetCachedCollectionDesc(collection_name, collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    const auto& schema = collection_desc.Schema();
+    auto primary_field = std::find_if(schema.Fields().begin(), schema.Fields().end(),
+                                      [](const FieldSchema& field) { return field.IsPrimaryKey(); });
+    if (primary_field == schema.Fields().end() || primary_field->AutoID()) {
+        return Status(StatusCode::InvalidAgument, "Duplicate check requires a primary key without auto_id!");
+    }
+    auto primary_column = std::find_if(fields.begin(), fields.end(), [&primary_field](const FieldDataPtr& field) {
+        return field->Name() == primary_field->Name();
+    });
+    if (primary_column == fields.end()) {
+        return Status(StatusCode::InvalidAgument, "Primary key field '" + primary_field->Name() + "' is missing!");
+    }
+
+    if ((*primary_column)->Type() == DataType::INT64) {
+        const auto& keys = std::static_pointer_cast<Int64FieldData>(*primary_column)->Data();
+        return InsertUnique(collection_name, partition_name, fields, keys, options, results);
+    }
+    if ((*primary_column)->Type() == DataType::STRING) {
+        const auto& keys = std::static_pointer_cast<StringFieldData>(*primary_column)->Data();
+        return InsertUnique(collection_name, partition_name, fields, keys, options, results);
+    }
+    return Status(StatusCode::InvalidAgument, "Primary key field '" + primary_field->Name() + "' is mismatched!");
+}
+
+template <typename T>
+Status
+MilvusClientImpl::InsertUnique(const std::string& collection_name, const std::string& partition_name,
+                               const std::vector<FieldDataPtr>& fields, const std::vector<T>& keys,
+                               const InsertOptions& options, DmlResults& results) {
+    std::shared_ptr<DuplicateFilter> filter;
+    auto status = GetDuplicateFilter(collection_name, filter);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    // the unique keys stay reserved until the insert ends, so a concurrent insert reports them as duplicates
+    auto duplicates = filter->Reserve(keys);
+    std::vector<uint32_t> rows;
+    std::vector<T> unique_keys;
+    for (size_t i = 0, next = 0; i < keys.size(); ++i) {
+        if (next < duplicates.size() && duplicates[next] == i) {
+            ++next;
+            continue;
+        }
+        rows.push_back(static_cast<uint32_t>(i));
+        unique_keys.push_back(keys[i]);
+    }
+    if (options.Duplicates() != DuplicateAction::DROP || duplicates.empty()) {
+        status = InsertRouted(collection_name, partition_name, fields, options, results);
+        filter->Release(unique_keys, InsertedKeys(keys, status, results));
+        results.SetDuplicateRows(std::move(duplicates));
+        return status;
+    }
+
+    if (rows.empty()) {
+        results = DmlResults();
+        results.SetDuplicateRows(std::move(duplicates));
+        return Status::OK();
+    }
+
+    std::vector<FieldDataPtr> unique_fields;
+    for (const auto& field : fields) {
+        unique_fields.push_back(GatherRows(*field, rows));
+    }
+    status = InsertRouted(collection_name, partition_name, unique_fields, options, results);
+    filter->Release(unique_keys, InsertedKeys(unique_keys, status, results));
+    // error rows are numbered within the unique rows, report them as input rows
+    std::vector<uint32_t> error_rows;
+    for (auto row : results.ErrorRows()) {
+        error_rows.push_back(rows[row]);
+    }
+    results.SetErrorRows(std::move(error_rows));
+    results.SetDuplicateRows(std::move(duplicates));
+    return status;
+}
+
+Status
+MilvusClientImpl::InsertRouted(const std::string& collection_name, const std::string& partition_name,
+                               const std::vector<FieldDataPtr>& fields, const InsertOptions& options,
+                               DmlResults& results) {
+    if (!options.ClientHashing() && !options.GroupByShard()) {
+        auto insert_coalescer = insert_coalescer_;
+        if (options.Coalesce() && insert_coalescer != nullptr && !fields.empty() &&
+            fields.front()->Count() <= insert_coalescer->Config().MaxCallRows()) {
+            if (connection_ == nullptr) {
+                return Status(StatusCode::NotConnected, "Connection is not ready!");
+            }
+            return insert_coalescer->Insert(collection_name, partition_name, fields, results);
+        }
+        return Insert(collection_name, partition_name, fields, results);
+    }
+
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    CollectionDesc collection_desc;
+    auto status = GetCachedCollectionDesc(collection_name, collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    const auto& schema = collection_desc.Schema();
+    auto primary_field = std::find_if(schema.Fields().begin(), schema.Fields().end(),
+                                      [](const FieldSchema& field) { return field.IsPrimaryKey(); });
+    if (primary_field == schema.Fields().end() || primary_field->AutoID() ||
+        primary_field->FieldDataType() != DataType::INT64) {
+        return Status(StatusCode::InvalidAgument, "Client hashing requires an int64 primary key without auto_id!");
+    }
+    auto primary_column = std::find_if(fields.begin(), fields.end(), [&primary_field](const FieldDataPtr& field) {
+        return field->Name() == primary_field->Name();
+    });
+    if (primary_column == fields.end() || (*primary_column)->Type() != DataType::INT64) {
+        return Status(StatusCode::InvalidAgument, "Primary key field '" + primary_field->Name() + "' is missing!");
+    }
+
+    proto::milvus::InsertRequest rpc_request;
+    status = BuildInsertRequest(collection_name, partition_name, fields, rpc_request);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    const auto& keys = std::static_pointer_cast<Int64FieldData>(*primary_column)->Data();
+    std::vector<uint32_t> hashes(keys.size());
+    HashInt64Keys(keys.data(), keys.size(), hashes.data());
+
+    const uint32_t shard_num = static_cast<uint32_t>(std::max(1, schema.ShardNum()));
+    std::vector<std::vector<uint32_t>> shard_rows(shard_num);
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        shard_rows[hashes[i] % shard_num].push_back(static_cast<uint32_t>(i));
+    }
+    std::vector<int64_t> shard_row_counts;
+    for (const auto& rows : shard_rows) {
+        shard_row_counts.push_back(static_cast<int64_t>(rows.size()));
+    }
+
+    if (!options.GroupByShard()) {
+        rpc_request.mutable_hash_keys()->Add(hashes.begin(), hashes.end());
+        status = SendInsert(rpc_request, results);
+        results.SetShardRowCounts(std::move(shard_row_counts));
+        return status;
+    }
+
+    // every shard is sent even if others fail, the rows of the failed shards are reported by ErrorRows()
+    Status first_error;
+    std::vector<uint32_t> error_rows;
+    int64_t insert_count = 0;
+    uint64_t timestamp = 0;
+    for (size_t shard = 0; shard < shard_rows.size(); ++shard) {
+        const auto& rows = shard_rows[shard];
+        if (rows.empty()) {
+            continue;
+        }
+        proto::milvus::InsertRequest shard_request;
+        shard_request.set_collection_name(collection_name);
+        shard_request.set_partition_name(partition_name);
+        shard_request.set_num_rows(static_cast<uint32_t>(rows.size()));
+        for (const auto& field : fields) {
+            ConvertFieldData(*GatherRows(*field, rows), *shard_request.add_fields_data());
+        }
+        auto shard_hashes = shard_request.mutable_hash_keys();
+        shard_hashes->Reserve(static_cast<int>(rows.size()));
+        for (auto row : rows) {
+            shard_hashes->Add(hashes[row]);
+        }
+
+        DmlResults shard_results;
+        status = SendInsert(shard_request, shard_results);
+        if (!status.IsOk() && first_error.IsOk()) {
+            first_error = status;
+        }
+        if (!status.IsOk() && shard_results.ErrorRows().empty()) {
+            error_rows.insert(error_rows.end(), rows.begin(), rows.end());
+            shard_row_counts[shard] = 0;
+            continue;
+        }
+        // rows rejected by the server are numbered within the shard request
+        for (auto row : shard_results.ErrorRows()) {
+            error_rows.push_back(rows[row]);
+        }
+        shard_row_counts[shard] -= static_cast<int64_t>(shard_results.ErrorRows().size());
+        insert_count += shard_results.InsertCount();
+        timestamp = std::max(timestamp, shard_results.Timestamp());
+    }
+    std::sort(error_rows.begin(), error_rows.end());
+
+    // primary keys are provided by client, return the inserted ones in the input order
+    std::vector<int64_t> inserted_keys;
+    inserted_keys.reserve(keys.size() - error_rows.size());
+    for (size_t i = 0, next = 0; i < keys.size(); ++i) {
+        if (next < error_rows.size() && error_rows[next] == i) {
+            ++next;
+            continue;
+        }
+        inserted_keys.push_back(keys[i]);
+    }
+    results.SetIdArray(IDArray(inserted_keys));
+    results.SetInsertCount(insert_count);
+    results.SetTimestamp(timestamp);
+    results.SetShardRowCounts(std::move(shard_row_counts));
+    results.SetErrorRows(std::move(error_rows));
+    return first_error;
+}
+
+Status
+MilvusClientImpl::InsertRows(const std::string& collection_name, const std::string& partition_name,
+                             const RowLayout& layout, const void* rows, size_t row_count, DmlResults& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::InsertRequest rpc_request;
+    rpc_request.set_collection_name(collection_name);
+    rpc_request.set_partition_name(partition_name);
+
+    auto pool = connection_->WorkerPool();
+    RowTransposer transposer(*pool);
+    auto status = transposer.Transpose(layout, rows, row_count, rpc_request);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    return SendInsert(rpc_request, results);
+}
+
+Status
+MilvusClientImpl::GetCachedCollectionDesc(const std::string& collection_name, CollectionDesc& collection_desc) {
+    {
+        std::lock_guard<std::mutex> lock(collection_cache_mutex_);
+        auto iter = collection_cache_.find(collection_name);
+        if (iter != collection_cache_.end()) {
+            collection_desc = iter->second;
+            return Status::OK();
+        }
+    }
+
+    return DescribeCollection(collection_name, collection_desc);
+}
+
+Status
+MilvusClientImpl::GetDuplicateFilter(const std::string& collection_name, std::shared_ptr<DuplicateFilter>& filter) {
+    std::lock_guard<std::mutex> lock(duplicate_filters_mutex_);
+    auto iter = duplicate_filters_.find(collection_name);
+    if (iter != duplicate_filters_.end()) {
+        filter = iter->second;
+        return Status::OK();
+    }
+
+    filter = nullptr;
+    const auto& directory = duplicate_filter_config_.Directory();
+    if (!directory.empty()) {
+        auto status = DuplicateFilter::Load(directory + "/" + collection_name + ".dupfilter", filter,
+                                            duplicate_filter_config_.MaxStages());
+        if (!status.IsOk()) {
+            return status;
+        }
+    }
+    if (filter == nullptr) {
+        filter = std::make_shared<DuplicateFilter>(duplicate_filter_config_.InitialCapacity(),
+                                                   duplicate_filter_config_.FalsePositiveRate(),
+                                                   duplicate_filter_config_.MaxStages());
+    }
+    duplicate_filters_[collection_name] = filter;
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::SaveDuplicateFilters() {
+    std::unordered_map<std::string, std::shared_ptr<DuplicateFilter>> filters;
+    std::string directory;
+    {
+        std::lock_guard<std::mutex> lock(duplicate_filters_mutex_);
+        filters = duplicate_filters_;
+        directory = duplicate_filter_config_.Directory();
+    }
+    if (directory.empty()) {
+        return Status::OK();
+    }
+
+    Status first_error;
+    for (const auto& pair : filters) {
+        auto status = pair.second->Save(directory + "/" + pair.first + ".dupfilter");
+        if (!status.IsOk() && first_error.IsOk()) {
+            first_error = status;
+        }
+    }
+    return first_error;
+}
+
+Status
+MilvusClientImpl::GetPrimaryField(const std::string& collection_name, std::string& primary_name,
+                                  DataType& primary_type) {
+    CollectionDesc collection_desc;
+    auto status = GetCachedCollectionDesc(collection_name, collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    for (const auto& field : collection_desc.Schema().Fields()) {
+        if (field.IsPrimaryKey()) {
+            primary_name = field.Name();
+            primary_type = field.FieldDataType();
+            return Status::OK();
+        }
+    }
+    return Status(StatusCode::InvalidAgument, "Primary key field is not found!");
+}
+
+Status
+MilvusClientImpl::SendInsert(const proto::milvus::InsertRequest& rpc_request, DmlResults& results) {
+    proto::milvus::MutationResult response;
+    auto status = SendInsertRequest(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    // without per-row errors a failed response fails every row
+    const auto& error_index = response.err_index();
+    if (response.status().error_code() != proto::common::ErrorCode::Success && error_index.empty()) {
+        return Status(StatusCode::ServerFailed, response.status().reason());
+    }
+
+    const auto& ids = response.ids();
+    if (ids.has_str_id()) {
+        const auto& str_ids = ids.str_id().data();
+        results.SetIdArray(IDArray(std::vector<std::string>(str_ids.begin(), str_ids.end())));
+    } else {
+        const auto& int_ids = ids.int_id().data();
+        results.SetIdArray(IDArray(std::vector<int64_t>(int_ids.begin(), int_ids.end())));
+    }
+    results.SetTimestamp(response.timestamp());
+    if (error_index.empty()) {
+        results.SetInsertCount(response.insert_cnt());
+        return Status::OK();
+    }
+
+    std::vector<uint32_t> error_rows(error_index.begin(), error_index.end());
+    std::sort(error_rows.begin(), error_rows.end());
+    results.SetInsertCount(static_cast<int64_t>(rpc_request.num_rows() - error_rows.size()));
+    results.SetErrorRows(std::move(error_rows));
+    return Status(StatusCode::ServerFailed, std::to_string(error_index.size()) + " of " +
+                                                std::to_string(rpc_request.num_rows()) +
+                                                " rows failed: " + response.status().reason());
+}
+
+Status
+MilvusClientImpl::SendInsertRequest(const proto::milvus::InsertRequest& rpc_request,
+                                    proto::milvus::MutationResult& response) {
+    MemoryReservation reservation(memory_budget_.get(), rpc_request.ByteSizeLong());
+    if (!reservation.Result().IsOk()) {
+        return reservation.Result();
+    }
+
+    auto status = connection_->Insert(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    auto compaction_scheduler = compaction_scheduler_;
+    if (compaction_scheduler != nullptr) {
+        compaction_scheduler->RecordMutation(rpc_request.collection_name(), response.insert_cnt(), 0);
+    }
+    if (entity_cache_ == nullptr) {
+        return status;
+    }
+
+    // rows may be inserted even if the response reports errors
+    const auto& ids = response.ids();
+    if (ids.has_str_id()) {
+        const auto& str_ids = ids.str_id().data();
+        InvalidateEntities(rpc_request.collection_name(), std::vector<std::string>(str_ids.begin(), str_ids.end()));
+    } else {
+        const auto& int_ids = ids.int_id().data();
+        InvalidateEntities(rpc_request.collection_name(), std::vector<int64_t>(int_ids.begin(), int_ids.end()));
+    }
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::Delete(const std::string& collection_name, const std::string& partition_name,
+                         const std::string& expression, DmlResults& results) {
+    auto status = SendDelete(collection_name, partition_name, expression, results);
+    // the deleted entities are unknown, and the cache is invalidated after the delete so that entities fetched
+    // before it are not cached again
+    auto entity_cache = entity_cache_;
+    if (entity_cache != nullptr) {
+        entity_cache->InvalidateCollection(collection_name);
+    }
+    return status;
+}
+
+Status
+MilvusClientImpl::SendDelete(const std::string& collection_name, const std::string& partition_name,
+                             const std::string& expression, DmlResults& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::DeleteRequest rpc_request;
+    rpc_request.set_collection_name(collection_name);
+    rpc_request.set_partition_name(partition_name);
+    rpc_request.set_expr(expression);
+
+    MemoryReservation reservation(memory_budget_.get(), rpc_request.ByteSizeLong());
+    if (!reservation.Result().IsOk()) {
+        return reservation.Result();
+    }
+
+    proto::milvus::MutationResult response;
+    auto status = connection_->Delete(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (response.status().error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.status().reason());
+    }
+
+    auto compaction_scheduler = compaction_scheduler_;
+    if (compaction_scheduler != nullptr) {
+        compaction_scheduler->RecordMutation(collection_name, 0, response.delete_cnt());
+    }
+
+    results.SetTimestamp(response.timestamp());
+    results.SetDeleteCount(response.delete_cnt());
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::DeleteByIds(const std::string& collection_name, const std::string& partition_name,
+                              const std::vector<int64_t>& ids, DmlResults& results) {
+    return DeleteByIdsImpl(collection_name, partition_name, ids, results);
+}
+
+Status
+MilvusClientImpl::DeleteByIds(const std::string& collection_name, const std::string& partition_name,
+                              const std::vector<std::string>& ids, DmlResults& results) {
+    return DeleteByIdsImpl(collection_name, partition_name, ids, results);
+}
+
+template <typename T>
+Status
+MilvusClientImpl::DeleteByIdsImpl(const std::string& collection_name, const std::string& partition_name,
+                                  const std::vector<T>& ids, DmlResults& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+    if (ids.empty()) {
+        results.SetDeleteCount(0);
+        results.SetTimestamp(0);
+        return Status::OK();
+    }
+
+    std::string primary_name;
+    DataType primary_type = DataType::UNKNOWN;
+    auto status = GetPrimaryField(collection_name, primary_name, primary_type);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (primary_type != IdDataType<T>::value) {
+        return Status(StatusCode::InvalidAgument,
+                      "Type of the ids doesn't match primary key field '" + primary_name + "'!");
+    }
+
+    auto bounds = SplitIdChunks(ids, primary_name.size() + 5);
+    auto pool = connection_->WorkerPool();
+    status = DeleteInChunks(
+        *pool, bounds.size() - 1, kDeleteConcurrency,
+        [&](size_t chunk, std::string& expression) {
+            FormatIdChunk(ids, primary_name, bounds[chunk], bounds[chunk + 1], expression);
+        },
+        [&](const std::string& expression, DmlResults& chunk_results) {
+            return SendDelete(collection_name, partition_name, expression, chunk_results);
+        },
+        results);
+    // some chunks may be deleted even if others failed
+    InvalidateEntities(collection_name, ids);
+    return status;
+}
+
+Status
+MilvusClientImpl::Query(const QueryArguments& arguments, QueryResults& results) {
+    return QueryImpl(arguments, results);
+}
+
+Status
+MilvusClientImpl::Query(const QueryArguments& arguments, LazyQueryResults& results) {
+    return QueryImpl(arguments, results);
+}
+
+Status
+MilvusClientImpl::QueryByIds(const std::string& collection_name, const std::vector<int64_t>& ids,
+                             const std::vector<std::string>& output_fields, QueryResults& results) {
+    return QueryByIdsImpl(collection_name, ids, output_fields, results);
+}
+
+Status
+MilvusClientImpl::QueryByIds(const std::string& collection_name, const std::vector<std::string>& ids,
+                             const std::vector<std::string>& output_fields, QueryResults& results) {
+    return QueryByIdsImpl(collection_name, ids, output_fields, results);
+}
+
+Status
+MilvusClientImpl::Search(const SearchArguments& arguments, SearchResults& results) {
+    if (arguments.RefineFactor() > 1) {
+        return SearchRefined(arguments, results);
+    }
+    return SearchImpl(arguments, results);
+}
+
+Status
+MilvusClientImpl::Search(const SearchArguments& arguments, LazySearchResults& results) {
+    if (arguments.RefineFactor() > 1) {
+        return Status(StatusCode::NotSupported, "Refined search doesn't support lazy results!");
+    }
+    return SearchImpl(arguments, results);
+}
+
+Status
+MilvusClientImpl::PrepareSearch(const SearchArguments& arguments, PreparedSearch& prepared) {
+    if (arguments.RefineFactor() > 1) {
+        return Status(StatusCode::NotSupported, "Refined search cannot be prepared!");
+    }
+
+    CollectionDesc collection_desc;
+    auto status = GetCachedCollectionDesc(arguments.CollectionName(), collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    std::shared_ptr<const SearchTemplate> search_template;
+    status = SearchTemplate::Create(arguments, collection_desc.Schema(), search_template);
+    if (!status.IsOk()) {
+        return status;
+    }
+    prepared = PreparedSearch(std::move(search_template));
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::Search(const PreparedSearch& prepared, const Field& target_vectors, uint64_t guarantee_timestamp,
+                         SearchResults& results) {
+    return SearchImpl(prepared, target_vectors, guarantee_timestamp, results);
+}
+
+Status
+MilvusClientImpl::Search(const PreparedSearch& prepared, const Field& target_vectors, uint64_t guarantee_timestamp,
+                         LazySearchResults& results) {
+    return SearchImpl(prepared, target_vectors, guarantee_timestamp, results);
+}
+
+Status
+MilvusClientImpl::ValidateInsert(const std::string& collection_name, const std::vector<FieldDataPtr>& fields,
+                                 ValidationResults& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    CollectionDesc collection_desc;
+    auto status = GetCachedCollectionDesc(collection_name, collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+    return ValidateInsertFields(collection_desc.Schema(), fields, results);
+}
+
+Status
+MilvusClientImpl::ValidateSearch(const SearchArguments& arguments, ValidationResults& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    CollectionDesc collection_desc;
+    auto status = GetCachedCollectionDesc(arguments.CollectionName(), collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+    return ValidateSearchArguments(collection_desc.Schema(), arguments, results);
+}
+
+Status
+MilvusClientImpl::TuneSearchParams(const SearchTuneArguments& arguments, SearchTuneResults& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    const auto& search = arguments.Search();
+    if (search.TargetVectors() == nullptr || search.TargetVectors()->Count() == 0) {
+        return Status(StatusCode::InvalidAgument, "Sample queries are empty!");
+    }
+    if (search.TopK() <= 0) {
+        return Status(StatusCode::InvalidAgument, "TopK must be positive!");
+    }
+    if (arguments.ParamName().empty()) {
+        return Status(StatusCode::InvalidAgument, "Parameter to be tuned is not set!");
+    }
+    std::vector<int64_t> candidates = arguments.Candidates();
+    if (candidates.empty()) {
+        auto status = DefaultTuneCandidates(arguments.ParamName(), search.TopK(), candidates);
+        if (!status.IsOk()) {
+            return status;
+        }
+    }
+
+    CollectionDesc collection_desc;
+    auto status = GetCachedCollectionDesc(search.CollectionName(), collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+    const FieldSchema* anns_field = nullptr;
+    const FieldSchema* primary_field = nullptr;
+    for (const auto& field : collection_desc.Schema().Fields()) {
+        if (field.Name() == search.AnnsField()) {
+            anns_field = &field;
+        }
+        if (field.IsPrimaryKey()) {
+            primary_field = &field;
+        }
+    }
+    if (anns_field == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Vector field '" + search.AnnsField() + "' is not found!");
+    }
+    if (primary_field == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Primary key field is not found!");
+    }
+    if (search.TargetVectors()->Type() != anns_field->FieldDataType()) {
+        return Status(StatusCode::InvalidAgument, "Sample queries don't match the vector field!");
+    }
+
+    DistanceMetric metric;
+    status = GetDistanceMetric(search.MetricType(), anns_field->FieldDataType(), metric);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    IDArray base_ids = arguments.BaseIds();
+    FieldDataPtr base_vectors = arguments.BaseVectors();
+    if (base_vectors == nullptr) {
+        status = FetchBaseVectors(search, *primary_field, arguments.MaxBaseVectors(), base_ids, base_vectors);
+        if (!status.IsOk()) {
+            return status;
+        }
+    }
+    if (base_vectors->Type() != anns_field->FieldDataType()) {
+        return Status(StatusCode::InvalidAgument, "Base vectors don't match the vector field!");
+    }
+    const size_t id_count = base_ids.IsIntegerID() ? base_ids.IntIDArray().size() : base_ids.StrIDArray().size();
+    if (id_count != base_vectors->Count()) {
+        return Status(StatusCode::InvalidAgument, "Base ids don't match the base vectors!");
+    }
+
+    std::vector<const void*> base_rows;
+    std::vector<const void*> target_rows;
+    uint32_t base_dimension = 0;
+    uint32_t target_dimension = 0;
+    VectorRows(*base_vectors, base_rows, base_dimension);
+    VectorRows(*search.TargetVectors(), target_rows, target_dimension);
+    if (base_dimension != target_dimension) {
+        return Status(StatusCode::InvalidAgument, "Dimension of the sample queries doesn't match the base vectors!");
+    }
+    std::vector<std::vector<size_t>> truth;
+    ComputeGroundTruth(base_rows, target_rows, target_dimension, metric, search.TopK(), truth);
+
+    std::vector<FieldDataPtr> queries;
+    SplitVectors(*search.TargetVectors(), queries);
+
+    // the tuned search returns no output fields, their transfer would be counted as search latency
+    SearchArguments tuned;
+    tuned.SetCollectionName(search.CollectionName());
+    for (const auto& partition_name : search.PartitionNames()) {
+        tuned.AddPartitionName(partition_name);
+    }
+    if (arguments.BaseVectors() == nullptr) {
+        tuned.SetExpression(search.Expression());
+    } else {
+        // a provided sample may be a part of the collection, the ground truth only holds the entities of the sample
+        std::string expression;
+        status = SampleExpression(search.Expression(), primary_field->Name(), primary_field->FieldDataType(), base_ids,
+                                  expression);
+        if (!status.IsOk()) {
+            return status;
+        }
+        tuned.SetExpression(expression);
+    }
+    tuned.SetAnnsField(search.AnnsField());
+    tuned.SetTopK(search.TopK());
+    tuned.SetMetricType(search.MetricType());
+    for (const auto& param : search.ExtraParams()) {
+        tuned.AddExtraParam(param.first, param.second);
+    }
+    tuned.SetTravelTimestamp(search.TravelTimestamp());
+    tuned.SetGuaranteeTimestamp(search.GuaranteeTimestamp());
+
+    const uint32_t rounds = std::max<uint32_t>(arguments.Rounds(), 1);
+    std::vector<SearchTunePoint> points;
+    size_t recommended = 0;
+    bool target_met = false;
+    std::vector<double> latencies;
+    for (auto value : candidates) {
+        tuned.AddExtraParam(arguments.ParamName(), value);
+        double recall = 0;
+        latencies.clear();
+        for (uint32_t round = 0; round < rounds; ++round) {
+            for (size_t i = 0; i < queries.size(); ++i) {
+                tuned.SetTargetVectors(queries[i]);
+                SearchResults search_results;
+                const auto start = std::chrono::steady_clock::now();
+                status = SearchImpl(tuned, search_results);
+                const auto elapsed = std::chrono::steady_clock::now() - start;
+                if (!status.IsOk()) {
+                    return status;
+                }
+                latencies.push_back(std::chrono::duration<double, std::milli>(elapsed).count());
+                if (round == 0 && !search_results.Results().empty()) {
+                    recall += RecallAtK(base_ids, truth[i], search_results.Results().front());
+                }
+            }
+        }
+        recall /= static_cast<double>(queries.size());
+
+        std::sort(latencies.begin(), latencies.end());
+        double total = 0;
+        for (auto latency : latencies) {
+            total += latency;
+        }
+        points.emplace_back(value, recall, total / static_cast<double>(latencies.size()), Percentile(latencies, 50),
+                            Percentile(latencies, 90), Percentile(latencies, 99));
+
+        if (!target_met && recall >= arguments.TargetRecall()) {
+            recommended = points.size() - 1;
+            target_met = true;
+            if (!arguments.SweepAll()) {
+                break;
+            }
+        } else if (!target_met && recall > points[recommended].Recall()) {
+            recommended = points.size() - 1;
+        }
+    }
+
+    results = SearchTuneResults(std::move(points), recommended, target_met);
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::FetchBaseVectors(const SearchArguments& arguments, const FieldSchema& primary_field,
+                                   int64_t max_count, IDArray& ids, FieldDataPtr& vectors) {
+    const auto& pk_name = primary_field.Name();
+    const bool int_pk = primary_field.FieldDataType() == DataType::INT64;
+    QueryArguments query_arguments;
+    query_arguments.SetCollectionName(arguments.CollectionName());
+    for (const auto& partition_name : arguments.PartitionNames()) {
+        query_arguments.AddPartitionName(partition_name);
+    }
+    // a query needs an expression, the one matching all entities is a condition on the primary key
+    const std::string& filter = arguments.Expression();
+    std::string expression = filter;
+    if (expression.empty()) {
+        expression = int_pk ? pk_name + " >= 0 || " + pk_name + " < 0" : pk_name + " >= \"\"";
+    }
+    query_arguments.SetExpression(expression);
+    query_arguments.AddOutputField(pk_name);
+    query_arguments.SetTravelTimestamp(arguments.TravelTimestamp());
+    query_arguments.SetGuaranteeTimestamp(arguments.GuaranteeTimestamp());
+
+    // the keys are much smaller than the vectors, count them before fetching any vector
+    QueryResults query_results;
+    auto status = QueryImpl(query_arguments, query_results);
+    if (!status.IsOk()) {
+        return status;
+    }
+    auto id_field = query_results.GetFieldByName(pk_name);
+    if (id_field == nullptr) {
+        return Status(StatusCode::ServerFailed, "Primary keys of the collection are not returned!");
+    }
+    const size_t key_count = id_field->Count();
+    if (key_count == 0) {
+        return Status(StatusCode::InvalidAgument, "No entity matches the search, the ground truth is empty!");
+    }
+    if (key_count > static_cast<size_t>(std::max<int64_t>(max_count, 0))) {
+        return Status(StatusCode::InvalidAgument, std::to_string(key_count) + " entities match the search, more than " +
+                                                      std::to_string(max_count) +
+                                                      " base vectors, set a sample by SetBaseVectors()!");
+    }
+
+    std::vector<int64_t> int_keys;
+    std::vector<std::string> str_keys;
+    if (int_pk) {
+        int_keys = std::static_pointer_cast<Int64FieldData>(id_field)->Data();
+        std::sort(int_keys.begin(), int_keys.end());
+    } else {
+        str_keys = std::static_pointer_cast<StringFieldData>(id_field)->Data();
+        std::sort(str_keys.begin(), str_keys.end());
+    }
+
+    std::vector<int64_t> int_ids;
+    std::vector<std::string> str_ids;
+    vectors = nullptr;
+    query_arguments.AddOutputField(arguments.AnnsField());
+    std::string range;
+    for (size_t begin = 0; begin < key_count; begin += kTuneFetchRows) {
+        const size_t end = std::min(key_count, begin + kTuneFetchRows);
+        if (int_pk) {
+            FormatIdRange(int_keys, pk_name, begin, end, range);
+        } else {
+            FormatIdRange(str_keys, pk_name, begin, end, range);
+        }
+        query_arguments.SetExpression(filter.empty() ? range : "(" + filter + ") && (" + range + ")");
+
+        QueryResults chunk_results;
+        status = QueryImpl(query_arguments, chunk_results);
+        if (!status.IsOk()) {
+            return status;
+        }
+        auto chunk_vectors = chunk_results.GetFieldByName(arguments.AnnsField());
+        auto chunk_ids = chunk_results.GetFieldByName(pk_name);
+        if (chunk_vectors == nullptr || chunk_ids == nullptr) {
+            return Status(StatusCode::ServerFailed, "Vectors of the collection are not returned!");
+        }
+        if (vectors == nullptr) {
+            vectors = chunk_vectors;
+        } else {
+            status = AppendVectors(*vectors, *chunk_vectors);
+            if (!status.IsOk()) {
+                return status;
+            }
+        }
+        if (int_pk) {
+            const auto& data = std::static_pointer_cast<Int64FieldData>(chunk_ids)->Data();
+            int_ids.insert(int_ids.end(), data.begin(), data.end());
+        } else {
+            const auto& data = std::static_pointer_cast<StringFieldData>(chunk_ids)->Data();
+            str_ids.insert(str_ids.end(), data.begin(), data.end());
+        }
+    }
+    ids = int_pk ? IDArray(int_ids) : IDArray(str_ids);
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::PrepareExpression(const std::string& collection_name, const Expr& expr, PreparedExpr& prepared) {
+    CollectionDesc collection_desc;
+    auto status = GetCachedCollectionDesc(collection_name, collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+    return PreparedExpr::Prepare(expr, collection_desc.Schema(), prepared);
+}
+
+Status
+MilvusClientImpl::GetMemoryBudgetStat(MemoryBudgetStat& stat) {
+    if (memory_budget_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    stat = memory_budget_->Stat();
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::GetEntityCacheStat(EntityCacheStat& stat) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    auto entity_cache = entity_cache_;
+    stat = entity_cache == nullptr ? EntityCacheStat() : entity_cache->Stat();
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::GetPersistentSegmentInfo(const std::string& collection_name, std::vector<SegmentInfo>& segments) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::GetPersistentSegmentInfoRequest rpc_request;
+    rpc_request.set_collectionname(collection_name);
+
+    proto::milvus::GetPersistentSegmentInfoResponse response;
+    auto status = connection_->GetPersistentSegmentInfo(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (response.status().error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.status().reason());
+    }
+
+    segments.clear();
+    segments.reserve(response.infos_size());
+    for (const auto& info : response.infos()) {
+        segments.emplace_back(info.collectionid(), info.partitionid(), info.segmentid(), info.num_rows(),
+                              static_cast<SegmentState>(info.state()));
+    }
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::ManualCompaction(const std::string& collection_name, int64_t& compaction_id) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    CollectionDesc collection_desc;
+    auto status = GetCachedCollectionDesc(collection_name, collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    proto::milvus::ManualCompactionRequest rpc_request;
+    rpc_request.set_collectionid(collection_desc.ID());
+
+    proto::milvus::ManualCompactionResponse response;
+    status = connection_->ManualCompaction(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (response.status().error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.status().reason());
+    }
+
+    compaction_id = response.compactionid();
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::GetCompactionState(int64_t compaction_id, CompactionProgress& progress) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::GetCompactionStateRequest rpc_request;
+    rpc_request.set_compactionid(compaction_id);
+
+    proto::milvus::GetCompactionStateResponse response;
+    auto status = connection_->GetCompactionState(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (response.status().error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.status().reason());
+    }
+
+    progress = CompactionProgress(static_cast<CompactionState>(response.state()), response.executingplanno(),
+                                  response.timeoutplanno(), response.completedplanno());
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::GetCompactionReports(std::vector<CompactionReport>& reports) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    reports.clear();
+    auto compaction_scheduler = compaction_scheduler_;
+    if (compaction_scheduler != nullptr) {
+        reports = compaction_scheduler->Reports();
+    }
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::GetQuerySegmentInfo(const std::string& collection_name, std::vector<QuerySegmentInfo>& segments) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::GetQuerySegmentInfoRequest rpc_request;
+    rpc_request.set_collectionname(collection_name);
+
+    proto::milvus::GetQuerySegmentInfoResponse response;
+    auto status = connection_->GetQuerySegmentInfo(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (response.status().error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.status().reason());
+    }
+
+    segments.clear();
+    segments.reserve(response.infos_size());
+    for (const auto& info : response.infos()) {
+        segments.emplace_back(info.collectionid(), info.partitionid(), info.segmentid(), info.nodeid(),
+                              info.mem_size(), info.num_rows(), info.index_name(), info.indexid(),
+                              static_cast<SegmentState>(info.state()));
+    }
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::LoadBalance(int64_t src_node, const std::vector<int64_t>& dst_nodes,
+                              const std::vector<int64_t>& segment_ids) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::LoadBalanceRequest rpc_request;
+    rpc_request.set_src_nodeid(src_node);
+    for (auto node_id : dst_nodes) {
+        rpc_request.add_dst_nodeids(node_id);
+    }
+    for (auto segment_id : segment_ids) {
+        rpc_request.add_sealed_segmentids(segment_id);
+    }
+
+    proto::common::Status response;
+    auto status = connection_->LoadBalance(rpc_request, response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (response.error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, response.reason());
+    }
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::BalanceQueryNodes(const BalanceArguments& arguments, BalanceResults& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+    if (arguments.Collections().empty()) {
+        return Status(StatusCode::InvalidAgument, "No collection to balance!");
+    }
+    if (arguments.SkewThreshold() < 1.0) {
+        return Status(StatusCode::InvalidAgument, "Skew threshold must not be less than 1!");
+    }
+
+    std::vector<QuerySegmentInfo> segments;
+    for (const auto& collection_name : arguments.Collections()) {
+        std::vector<QuerySegmentInfo> collection_segments;
+        auto status = GetQuerySegmentInfo(collection_name, collection_segments);
+        if (!status.IsOk()) {
+            return status;
+        }
+        segments.insert(segments.end(), collection_segments.begin(), collection_segments.end());
+    }
+
+    auto plan = PlanBalance(segments, arguments.QueryNodes(), arguments.SkewThreshold(), arguments.MaxMoves());
+    const bool executed = arguments.Execute() && !plan.moves_.empty();
+    if (executed) {
+        for (const auto& move : plan.moves_) {
+            auto status = LoadBalance(move.source_node_, {move.target_node_}, move.segment_ids_);
+            if (!status.IsOk()) {
+                return status;
+            }
+        }
+    }
+
+    results = BalanceResults(std::move(plan.node_loads_), plan.skew_, plan.projected_skew_, std::move(plan.moves_),
+                             executed);
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::GetMetrics(const std::string& request, std::string& response, std::string& component_name) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::GetMetricsRequest rpc_request;
+    rpc_request.set_request(request);
+
+    proto::milvus::GetMetricsResponse rpc_response;
+    auto status = connection_->GetMetrics(rpc_request, rpc_response);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (rpc_response.status().error_code() != proto::common::ErrorCode::Success) {
+        return Status(StatusCode::ServerFailed, rpc_response.status().reason());
+    }
+
+    response = rpc_response.response();
+    component_name = rpc_response.component_name();
+    return Status::OK();
+}
+
+Status
+MilvusClientImpl::GetServerMetrics(ServerMetrics& metrics) {
+    std::string response;
+    std::string component_name;
+    auto status = GetMetrics(kSystemInfoMetricsRequest, response, component_name);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
+    return ParseSystemInfo(response, component_name, now.count(), metrics);
+}
+
+Status
+MilvusClientImpl::GetMetricsHistory(std::vector<ServerMetrics>& history) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    history.clear();
+    auto metrics_collector = metrics_collector_;
+    if (metrics_collector != nullptr) {
+        history = metrics_collector->History();
+    }
+    return Status::OK();
+}
+
+std::shared_ptr<AsyncHandle>
+MilvusClientImpl::DescribeCollectionAsync(const std::string& collection_name, const std::shared_ptr<Executor>& executor,
+                                          AsyncCallback<CollectionDesc> callback) {
+    if (connection_ == nullptr) {
+        PostResult(executor, callback, Status(StatusCode::NotConnected, "Connection is not ready!"),
+                   std::make_shared<CollectionDesc>());
+        return nullptr;
+    }
+
+    proto::milvus::DescribeCollectionRequest rpc_request;
+    rpc_request.set_collection_name(collection_name);
+
+    auto done = [this, collection_name, executor, callback](const Status& status,
+                                                            proto::milvus::DescribeCollectionResponse& response) {
+        auto collection_desc = std::make_shared<CollectionDesc>();
+        auto result = status;
+        if (result.IsOk()) {
+            result = DecodeResponse(response, *collection_desc);
+        }
+        if (result.IsOk()) {
+            std::lock_guard<std::mutex> lock(collection_cache_mutex_);
+            collection_cache_[collection_name] = *collection_desc;
+        }
+        PostResult(executor, callback, result, collection_desc);
+    };
+
+    std::shared_ptr<AsyncHandle> handle;
+    auto status = connection_->DescribeCollectionAsync(rpc_request, done, handle);
+    if (!status.IsOk()) {
+        PostResult(executor, callback, status, std::make_shared<CollectionDesc>());
+    }
+    return handle;
+}
+
+std::shared_ptr<AsyncHandle>
+MilvusClientImpl::SearchAsync(const SearchArguments& arguments, const std::shared_ptr<Executor>& executor,
+                              AsyncCallback<SearchResults> callback) {
+    if (connection_ == nullptr) {
+        PostResult(executor, callback, Status(StatusCode::NotConnected, "Connection is not ready!"),
+                   std::make_shared<SearchResults>());
+        return nullptr;
+    }
+
+    if (arguments.RefineFactor() > 1) {
+        PostResult(executor, callback, Status(StatusCode::NotSupported, "Refined search is not asynchronous!"),
+                   std::make_shared<SearchResults>());
+        return nullptr;
+    }
+
+    proto::milvus::SearchRequest rpc_request;
+    uint64_t request_bytes = 0;
+    auto status = BuildSearchRequest(arguments, rpc_request, request_bytes);
+    if (!status.IsOk()) {
+        PostResult(executor, callback, status, std::make_shared<SearchResults>());
+        return nullptr;
+    }
+    return SendReadRequestAsync(rpc_request, request_bytes, executor, callback);
+}
+
+std::shared_ptr<AsyncHandle>
+MilvusClientImpl::QueryAsync(const QueryArguments& arguments, const std::shared_ptr<Executor>& executor,
+                             AsyncCallback<QueryResults> callback) {
+    if (connection_ == nullptr) {
+        PostResult(executor, callback, Status(StatusCode::NotConnected, "Connection is not ready!"),
+                   std::make_shared<QueryResults>());
+        return nullptr;
+    }
+
+    proto::milvus::QueryRequest rpc_request;
+    BuildQueryRequest(arguments, rpc_request);
+    return SendReadRequestAsync(rpc_request, rpc_request.ByteSizeLong(), executor, callback);
+}
+
+template <typename Results>
+Status
+MilvusClientImpl::QueryImpl(const QueryArguments& arguments, Results& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::QueryRequest rpc_request;
+    BuildQueryRequest(arguments, rpc_request);
+    return SendReadRequest(rpc_request, rpc_request.ByteSizeLong(), results);
+}
+
+template <typename T>
+void
+MilvusClientImpl::InvalidateEntities(const std::string& collection_name, const std::vector<T>& ids) {
+    auto entity_cache = entity_cache_;
+    if (entity_cache == nullptr) {
+        return;
+    }
+    for (const auto& id : ids) {
+        entity_cache->Invalidate(EntityCache::Key(collection_name, id));
+    }
+}
+
+template <typename T>
+Status
+MilvusClientImpl::QueryByIdsImpl(const std::string& collection_name, const std::vector<T>& ids,
+                                 const std::vector<std::string>& output_fields, QueryResults& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    std::string primary_name;
+    DataType primary_type = DataType::UNKNOWN;
+    auto status = GetPrimaryField(collection_name, primary_name, primary_type);
+    if (!status.IsOk()) {
+        return status;
+    }
+    std::vector<std::string> fields(output_fields);
+    if (std::find(fields.begin(), fields.end(), primary_name) == fields.end()) {
+        fields.push_back(primary_name);
+    }
+
+    auto entity_cache = entity_cache_;
+    // taken before the query, entities fetched while this client deletes or inserts are not cached
+    const uint64_t epoch = entity_cache == nullptr ? 0 : entity_cache->Epoch();
+    std::unordered_map<T, EntityRow> rows;
+    std::vector<T> misses;
+    for (const auto& id : ids) {
+        if (rows.find(id) != rows.end()) {
+            continue;
+        }
+        auto& row = rows[id];
+        if (entity_cache == nullptr || !entity_cache->Get(EntityCache::Key(collection_name, id), fields, row)) {
+            misses.push_back(id);
+        }
+    }
+
+    auto bounds = SplitIdChunks(misses, primary_name.size() + 5);
+    for (size_t chunk = 0; chunk + 1 < bounds.size(); ++chunk) {
+        QueryArguments query_arguments;
+        query_arguments.SetCollectionName(collection_name);
+        std::string expression;
+        FormatIdChunk(misses, primary_name, bounds[chunk], bounds[chunk + 1], expression);
+        query_arguments.SetExpression(expression);
+        for (const auto& field : fields) {
+            query_arguments.AddOutputField(field);
+        }
+
+        QueryResults chunk_results;
+        status = QueryImpl(query_arguments, chunk_results);
+        if (!status.IsOk()) {
+            return status;
+        }
+        auto layout = std::make_shared<EntityLayout>();
+        status = MakeEntityLayout(chunk_results.OutputFields(), *layout);
+        if (!status.IsOk()) {
+            return status;
+        }
+        auto primary_column =
+            std::dynamic_pointer_cast<FieldData<T, IdDataType<T>::value>>(chunk_results.GetFieldByName(primary_name));
+        if (primary_column == nullptr) {
+            return Status(StatusCode::ServerFailed, "Primary key field is not returned!");
+        }
+        for (size_t i = 0; i < primary_column->Count(); ++i) {
+            const auto& id = primary_column->Data()[i];
+            auto& row = rows[id];
+            row.layout_ = layout;
+            EncodeEntity(chunk_results.OutputFields(), i, row.data_);
+            if (entity_cache != nullptr) {
+                entity_cache->Put(EntityCache::Key(collection_name, id), EntityRow(row), epoch);
+            }
+        }
+    }
+
+    // the columns are created from the first entity found, each entity is appended in the order of ids
+    std::vector<FieldDataPtr> columns;
+    std::vector<FieldDataPtr> targets;
+    for (const auto& id : ids) {
+        auto& row = rows[id];
+        if (row.layout_ == nullptr) {
+            continue;
+        }
+        const auto& layout = *row.layout_;
+        if (columns.empty()) {
+            for (const auto& name : fields) {
+                for (const auto& field : layout) {
+                    if (field.name_ == name) {
+                        columns.push_back(CreateEntityColumn(field));
+                    }
+                }
+            }
+        }
+        targets.assign(layout.size(), nullptr);
+        for (size_t i = 0; i < layout.size(); ++i) {
+            for (const auto& column : columns) {
+                if (column->Name() == layout[i].name_) {
+                    targets[i] = column;
+                }
+            }
+        }
+        DecodeEntity(row, targets);
+        // a duplicated id is returned once
+        row.layout_ = nullptr;
+    }
+    results = QueryResults(std::move(columns));
+    return Status::OK();
+}
+
+template <typename Results>
+Status
+MilvusClientImpl::SearchImpl(const SearchArguments& arguments, Results& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    proto::milvus::SearchRequest rpc_request;
+    uint64_t request_bytes = 0;
+    auto status = BuildSearchRequest(arguments, rpc_request, request_bytes);
+    if (!status.IsOk()) {
+        return status;
+    }
+    return SendReadRequest(rpc_request, request_bytes, results);
+}
+
+Status
+MilvusClientImpl::SearchRefined(const SearchArguments& arguments, SearchResults& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    CollectionDesc collection_desc;
+    auto status = GetCachedCollectionDesc(arguments.CollectionName(), collection_desc);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    const FieldSchema* anns_field = nullptr;
+    const FieldSchema* primary_field = nullptr;
+    for (const auto& field : collection_desc.Schema().Fields()) {
+        if (field.Name() == arguments.AnnsField()) {
+            anns_field = &field;
+        }
+        if (field.IsPrimaryKey()) {
+            primary_field = &field;
+        }
+    }
+    if (anns_field == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Vector field '" + arguments.AnnsField() + "' is not found!");
+    }
+    if (primary_field == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Primary key field is not found!");
+    }
+    const auto& target_vectors = arguments.TargetVectors();
+    if (target_vectors == nullptr || target_vectors->Type() != anns_field->FieldDataType()) {
+        return Status(StatusCode::InvalidAgument, "Target vectors don't match the vector field!");
+    }
+
+    DistanceMetric metric;
+    status = GetDistanceMetric(arguments.MetricType(), anns_field->FieldDataType(), metric);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    if (anns_field->FieldDataType() == DataType::FLOAT_VECTOR) {
+        return RefineCandidates<FloatVecFieldData>(arguments, *primary_field, metric, results);
+    }
+    return RefineCandidates<BinaryVecFieldData>(arguments, *primary_field, metric, results);
+}
+
+template <typename VectorData>
+Status
+MilvusClientImpl::RefineCandidates(const SearchArguments& arguments, const FieldSchema& primary_field,
+                                   const DistanceMetric& metric, SearchResults& results) {
+    using T = typename VectorData::ElementType;
+    const auto& anns_name = arguments.AnnsField();
+    const auto& targets = static_cast<const VectorData&>(*arguments.TargetVectors());
+    const auto& output_names = arguments.OutputFields();
+    const bool anns_requested = std::find(output_names.begin(), output_names.end(), anns_name) != output_names.end();
+    // the cache is keyed by integer primary keys, the vectors of other collections come with the response
+    const auto& cache = arguments.RefineCache();
+    const bool use_cache = cache != nullptr && !anns_requested && primary_field.FieldDataType() == DataType::INT64;
+
+    SearchArguments candidate_arguments(arguments);
+    candidate_arguments.SetTopK(arguments.TopK() * arguments.RefineFactor());
+    candidate_arguments.SetRoundDecimal(-1);
+    candidate_arguments.SetRefineFactor(0);
+    if (!use_cache && !anns_requested) {
+        candidate_arguments.AddOutputField(anns_name);
+    }
+
+    SearchResults candidates;
+    auto status = SearchImpl(candidate_arguments, candidates);
+    if (!status.IsOk()) {
+        return status;
+    }
+    if (candidates.Results().size() != targets.Count()) {
+        return Status(StatusCode::ServerFailed, "Result count doesn't match the target vectors!");
+    }
+
+    // vectors of all candidates taken from the cache or fetched by one query, keyed by primary key
+    std::unordered_map<int64_t, std::vector<T>> cached_vectors;
+    if (use_cache) {
+        std::vector<int64_t> misses;
+        for (const auto& candidate : candidates.Results()) {
+            for (auto id : candidate.Ids().IntIDArray()) {
+                if (cached_vectors.find(id) != cached_vectors.end()) {
+                    continue;
+                }
+                auto& vector = cached_vectors[id];
+                if (!cache->Get(id, vector) || vector.size() != targets.RowWidth()) {
+                    vector.clear();
+                    misses.push_back(id);
+                }
+            }
+        }
+
+        auto bounds = SplitIdChunks(misses, primary_field.Name().size() + 5);
+        for (size_t chunk = 0; chunk + 1 < bounds.size(); ++chunk) {
+            QueryArguments query_arguments;
+            query_arguments.SetCollectionName(arguments.CollectionName());
+            std::string expression;
+            FormatIdChunk(misses, primary_field.Name(), bounds[chunk], bounds[chunk + 1], expression);
+            query_arguments.SetExpression(expression);
+            query_arguments.AddOutputField(primary_field.Name());
+            query_arguments.AddOutputField(anns_name);
+            query_arguments.SetTravelTimestamp(arguments.TravelTimestamp());
+            query_arguments.SetGuaranteeTimestamp(arguments.GuaranteeTimestamp());
+
+            QueryResults query_results;
+            status = QueryImpl(query_arguments, query_results);
+            if (!status.IsOk()) {
+                return status;
+            }
+            auto ids = std::dynamic_pointer_cast<Int64FieldData>(query_results.GetFieldByName(primary_field.Name()));
+            auto vectors = std::dynamic_pointer_cast<VectorData>(query_results.GetFieldByName(anns_name));
+            if (ids == nullptr || vectors == nullptr) {
+                continue;
+            }
+            for (size_t i = 0; i < ids->Count() && i < vectors->Count(); ++i) {
+                const T* row = vectors->Row(i);
+                cached_vectors[ids->Data()[i]].assign(row, row + vectors->RowWidth());
+            }
+        }
+    }
+
+    std::vector<SingleResult> refined(candidates.Results().size());
+    std::vector<const void*> rows;
+    for (size_t i = 0; i < refined.size(); ++i) {
+        const auto& candidate = candidates.Results()[i];
+        rows.clear();
+        if (use_cache) {
+            for (auto id : candidate.Ids().IntIDArray()) {
+                const auto& vector = cached_vectors[id];
+                rows.push_back(vector.empty() ? nullptr : vector.data());
+            }
+        } else {
+            auto vectors = std::dynamic_pointer_cast<VectorData>(candidate.GetFieldByName(anns_name));
+            if (vectors == nullptr || vectors->Count() != candidate.Scores().size()) {
+                return Status(StatusCode::ServerFailed, "Vector field '" + anns_name + "' is not returned!");
+            }
+            for (size_t row = 0; row < vectors->Count(); ++row) {
+                rows.push_back(vectors->Row(row));
+            }
+        }
+        // an entity deleted between the search and the query has no vector and is dropped
+        RerankResult(candidate, rows, targets.Row(i), targets.Dimension(), metric, arguments.TopK(),
+                     arguments.RoundDecimal(), anns_requested ? std::string() : anns_name, refined[i]);
+    }
+    results = SearchResults(std::move(refined));
+    return Status::OK();
+}
+
+template <typename Results>
+Status
+MilvusClientImpl::SearchImpl(const PreparedSearch& prepared, const Field& target_vectors, uint64_t guarantee_timestamp,
+                             Results& results) {
+    if (connection_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+    if (prepared.Template() == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Search is not prepared!");
+    }
+    if (target_vectors.Count() == 0) {
+        return Status(StatusCode::InvalidAgument, "Target vectors are empty!");
+    }
+
+    ::grpc::ByteBuffer rpc_request;
+    auto status = prepared.Template()->Serialize(target_vectors, guarantee_timestamp, rpc_request);
+    if (!status.IsOk()) {
+        return status;
+    }
+    return SendReadRequest(rpc_request, rpc_request.Length(), results);
+}
+
+template <typename Request, typename Results>
+Status
+MilvusClientImpl::SendReadRequest(const Request& rpc_request, uint64_t request_bytes, Results& results) {
+    const uint64_t response_bytes = memory_budget_->Config().QueryResponseBytes();
+    MemoryReservation reservation(memory_budget_.get(), request_bytes + response_bytes);
+    if (!reservation.Result().IsOk()) {
+        return reservation.Result();
+    }
+
+    typename ResponseOf<Results>::Type response;
+    auto status = Invoke(*connection_, rpc_request, response);
+    // the response is held until it is converted into results
+    reservation.Resize(request_bytes + ResponseBytes(response));
+    if (!status.IsOk()) {
+        return status;
+    }
+    return DecodeResponse(response, results);
+}
+
+template <typename Results, typename Request>
+std::shared_ptr<AsyncHandle>
+MilvusClientImpl::SendReadRequestAsync(const Request& rpc_request, uint64_t request_bytes,
+                                       const std::shared_ptr<Executor>& executor,
+                                       const AsyncCallback<Results>& callback) {
+    const uint64_t response_bytes = memory_budget_->Config().QueryResponseBytes();
+    auto reservation = std::make_shared<MemoryReservation>(memory_budget_.get(), request_bytes + response_bytes, false);
+    if (!reservation->Result().IsOk()) {
+        PostResult(executor, callback, reservation->Result(), std::make_shared<Results>());
+        return nullptr;
+    }
+
+    using Response = typename ResponseOf<Results>::Type;
+    // the reservation is released with the done function, after the response is decoded
+    auto done = [reservation, request_bytes, executor, callback](const Status& status, Response& response) {
+        reservation->Resize(request_bytes + ResponseBytes(response));
+        auto results = std::make_shared<Results>();
+        auto result = status;
+        if (result.IsOk()) {
+            result = DecodeResponse(response, *results);
+        }
+        PostResult(executor, callback, result, results);
+    };
+
+    std::shared_ptr<AsyncHandle> handle;
+    auto status = InvokeAsync(*connection_, rpc_request, done, handle);
+    if (!status.IsOk()) {
+        PostResult(executor, callback, status, std::make_shared<Results>());
+    }
+    return handle;
+}
+
 }  // namespace milvus
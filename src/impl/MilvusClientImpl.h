@@ -16,9 +16,20 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #include "MilvusClient.h"
+#include "CompactionScheduler.h"
+#include "Distance.h"
+#include "DuplicateFilter.h"
+#include "EntityCache.h"
+#include "InsertCoalescer.h"
+#include "MemoryBudget.h"
+#include "MetricsCollector.h"
 #include "MilvusConnection.h"
 
 /**
@@ -89,8 +100,265 @@ class MilvusClientImpl : public MilvusClient {
     ShowPartitions(const std::string& collection_name, const std::vector<std::string>& partition_names,
                    PartitionsInfo& partitions_info) final;
 
+    Status
+    Insert(const std::string& collection_name, const std::string& partition_name,
+           const std::vector<FieldDataPtr>& fields, DmlResults& results) final;
+
+    Status
+    Insert(const std::string& collection_name, const std::string& partition_name,
+           const std::vector<FieldDataPtr>& fields, const InsertOptions& options, DmlResults& results) final;
+
+    Status
+    InsertRows(const std::string& collection_name, const std::string& partition_name, const RowLayout& layout,
+               const void* rows, size_t row_count, DmlResults& results) final;
+
+    Status
+    Delete(const std::string& collection_name, const std::string& partition_name, const std::string& expression,
+           DmlResults& results) final;
+
+    Status
+    DeleteByIds(const std::string& collection_name, const std::string& partition_name,
+                const std::vector<int64_t>& ids, DmlResults& results) final;
+
+    Status
+    DeleteByIds(const std::string& collection_name, const std::string& partition_name,
+                const std::vector<std::string>& ids, DmlResults& results) final;
+
+    Status
+    Query(const QueryArguments& arguments, QueryResults& results) final;
+
+    Status
+    Query(const QueryArguments& arguments, LazyQueryResults& results) final;
+
+    Status
+    QueryByIds(const std::string& collection_name, const std::vector<int64_t>& ids,
+               const std::vector<std::string>& output_fields, QueryResults& results) final;
+
+    Status
+    QueryByIds(const std::string& collection_name, const std::vector<std::string>& ids,
+               const std::vector<std::string>& output_fields, QueryResults& results) final;
+
+    Status
+    Search(const SearchArguments& arguments, SearchResults& results) final;
+
+    Status
+    Search(const SearchArguments& arguments, LazySearchResults& results) final;
+
+    Status
+    PrepareSearch(const SearchArguments& arguments, PreparedSearch& prepared) final;
+
+    Status
+    Search(const PreparedSearch& prepared, const Field& target_vectors, uint64_t guarantee_timestamp,
+           SearchResults& results) final;
+
+    Status
+    Search(const PreparedSearch& prepared, const Field& target_vectors, uint64_t guarantee_timestamp,
+           LazySearchResults& results) final;
+
+    Status
+    ValidateInsert(const std::string& collection_name, const std::vector<FieldDataPtr>& fields,
+                   ValidationResults& results) final;
+
+    Status
+    ValidateSearch(const SearchArguments& arguments, ValidationResults& results) final;
+
+    Status
+    TuneSearchParams(const SearchTuneArguments& arguments, SearchTuneResults& results) final;
+
+    Status
+    PrepareExpression(const std::string& collection_name, const Expr& expr, PreparedExpr& prepared) final;
+
+    Status
+    GetMemoryBudgetStat(MemoryBudgetStat& stat) final;
+
+    Status
+    GetEntityCacheStat(EntityCacheStat& stat) final;
+
+    Status
+    SaveDuplicateFilters() final;
+
+    Status
+    GetPersistentSegmentInfo(const std::string& collection_name, std::vector<SegmentInfo>& segments) final;
+
+    Status
+    ManualCompaction(const std::string& collection_name, int64_t& compaction_id) final;
+
+    Status
+    GetCompactionState(int64_t compaction_id, CompactionProgress& progress) final;
+
+    Status
+    GetCompactionReports(std::vector<CompactionReport>& reports) final;
+
+    Status
+    GetQuerySegmentInfo(const std::string& collection_name, std::vector<QuerySegmentInfo>& segments) final;
+
+    Status
+    LoadBalance(int64_t src_node, const std::vector<int64_t>& dst_nodes, const std::vector<int64_t>& segment_ids) final;
+
+    Status
+    BalanceQueryNodes(const BalanceArguments& arguments, BalanceResults& results) final;
+
+    Status
+    GetMetrics(const std::string& request, std::string& response, std::string& component_name) final;
+
+    Status
+    GetServerMetrics(ServerMetrics& metrics) final;
+
+    Status
+    GetMetricsHistory(std::vector<ServerMetrics>& history) final;
+
+    std::shared_ptr<AsyncHandle>
+    DescribeCollectionAsync(const std::string& collection_name, const std::shared_ptr<Executor>& executor,
+                            AsyncCallback<CollectionDesc> callback) final;
+
+    std::shared_ptr<AsyncHandle>
+    SearchAsync(const SearchArguments& arguments, const std::shared_ptr<Executor>& executor,
+                AsyncCallback<SearchResults> callback) final;
+
+    std::shared_ptr<AsyncHandle>
+    QueryAsync(const QueryArguments& arguments, const std::shared_ptr<Executor>& executor,
+               AsyncCallback<QueryResults> callback) final;
+
+ private:
+    /**
+     * @brief Get collection description from cache, call DescribeCollection() if it is not cached.
+     */
+    Status
+    GetCachedCollectionDesc(const std::string& collection_name, CollectionDesc& collection_desc);
+
+    Status
+    GetPrimaryField(const std::string& collection_name, std::string& primary_name, DataType& primary_type);
+
+    /**
+     * @brief Delete by primary keys in chunks sent concurrently, the type of the ids must match the primary key.
+     */
+    template <typename T>
+    Status
+    DeleteByIdsImpl(const std::string& collection_name, const std::string& partition_name, const std::vector<T>& ids,
+                    DmlResults& results);
+
+    Status
+    SendInsert(const proto::milvus::InsertRequest& rpc_request, DmlResults& results);
+
+    /**
+     * @brief Send an insert request charged to the memory budget and invalidate the cached entities of the returned
+     * primary keys, the error code of the response is not checked.
+     */
+    Status
+    SendInsertRequest(const proto::milvus::InsertRequest& rpc_request, proto::milvus::MutationResult& response);
+
+    /**
+     * @brief Insert with client hashing and shard grouping of options, without duplicate check.
+     */
+    Status
+    InsertRouted(const std::string& collection_name, const std::string& partition_name,
+                 const std::vector<FieldDataPtr>& fields, const InsertOptions& options, DmlResults& results);
+
+    /**
+     * @brief Report or drop the rows whose primary key is in the duplicate filter, insert the others and add their
+     * keys to the filter once inserted.
+     */
+    template <typename T>
+    Status
+    InsertUnique(const std::string& collection_name, const std::string& partition_name,
+                 const std::vector<FieldDataPtr>& fields, const std::vector<T>& keys, const InsertOptions& options,
+                 DmlResults& results);
+
+    /**
+     * @brief Get the duplicate filter of a collection, it is loaded from the filter directory on first use.
+     */
+    Status
+    GetDuplicateFilter(const std::string& collection_name, std::shared_ptr<DuplicateFilter>& filter);
+
+    Status
+    SendDelete(const std::string& collection_name, const std::string& partition_name, const std::string& expression,
+               DmlResults& results);
+
+    /**
+     * @brief Drop the cached entities of ids, called after they are deleted or inserted again.
+     */
+    template <typename T>
+    void
+    InvalidateEntities(const std::string& collection_name, const std::vector<T>& ids);
+
+    /**
+     * @brief Take the entities from the entity cache and fetch the others by one query for each chunk of ids.
+     */
+    template <typename T>
+    Status
+    QueryByIdsImpl(const std::string& collection_name, const std::vector<T>& ids,
+                   const std::vector<std::string>& output_fields, QueryResults& results);
+
+    template <typename Results>
+    Status
+    QueryImpl(const QueryArguments& arguments, Results& results);
+
+    template <typename Results>
+    Status
+    SearchImpl(const SearchArguments& arguments, Results& results);
+
+    /**
+     * @brief Search TopK() * RefineFactor() candidates and re-rank them by exact distances.
+     */
+    Status
+    SearchRefined(const SearchArguments& arguments, SearchResults& results);
+
+    /**
+     * @brief Fetch the vectors of the candidates from the response or the refine cache and re-rank them,
+     * VectorData is the column type of the vector field.
+     */
+    template <typename VectorData>
+    Status
+    RefineCandidates(const SearchArguments& arguments, const FieldSchema& primary_field, const DistanceMetric& metric,
+                     SearchResults& results);
+
+    /**
+     * @brief Fetch the primary keys and the vectors of all entities matching the filter expression of arguments,
+     * the ground truth of TuneSearchParams(). The keys are queried first and checked against max_count, the vectors
+     * are then queried by ranges of kTuneFetchRows keys.
+     */
+    Status
+    FetchBaseVectors(const SearchArguments& arguments, const FieldSchema& primary_field, int64_t max_count,
+                     IDArray& ids, FieldDataPtr& vectors);
+
+    template <typename Results>
+    Status
+    SearchImpl(const PreparedSearch& prepared, const Field& target_vectors, uint64_t guarantee_timestamp,
+               Results& results);
+
+    /**
+     * @brief Send a search or query request and decode the response into results, request_bytes and the response
+     * size are charged to the memory budget.
+     */
+    template <typename Request, typename Results>
+    Status
+    SendReadRequest(const Request& rpc_request, uint64_t request_bytes, Results& results);
+
+    /**
+     * @brief Async version of SendReadRequest(), the memory budget is reserved without waiting and held until the
+     * response is decoded.
+     */
+    template <typename Results, typename Request>
+    std::shared_ptr<AsyncHandle>
+    SendReadRequestAsync(const Request& rpc_request, uint64_t request_bytes, const std::shared_ptr<Executor>& executor,
+                         const AsyncCallback<Results>& callback);
+
  private:
     std::shared_ptr<MilvusConnection> connection_;
+    std::shared_ptr<MemoryBudget> memory_budget_;
+    std::shared_ptr<EntityCache> entity_cache_;
+    std::shared_ptr<InsertCoalescer> insert_coalescer_;
+
+    DuplicateFilterConfig duplicate_filter_config_;
+    std::mutex duplicate_filters_mutex_;
+    std::unordered_map<std::string, std::shared_ptr<DuplicateFilter>> duplicate_filters_;
+
+    std::mutex collection_cache_mutex_;
+    std::unordered_map<std::string, CollectionDesc> collection_cache_;
+
+    // its thread calls this client, so it is declared last and destroyed first
+    std::shared_ptr<CompactionScheduler> compaction_scheduler_;
+    std::shared_ptr<MetricsCollector> metrics_collector_;
 };
 
 }  // namespace milvus
@@ -16,6 +16,11 @@
 
 #include "MilvusConnection.h"
 
+#include <grpcpp/impl/codegen/client_unary_call.h>
+
+#include "Endpoint.h"
+#include "ThreadAffinity.h"
+
 using grpc::Channel;
 using grpc::ClientContext;
 using grpc::ClientReader;
@@ -24,18 +29,61 @@ using grpc::ClientWriter;
 using grpc::Status;
 
 namespace milvus {
+namespace {
+const char* const kCreateCollectionMethod = "/milvus.proto.milvus.MilvusService/CreateCollection";
+const char* const kDescribeCollectionMethod = "/milvus.proto.milvus.MilvusService/DescribeCollection";
+const char* const kLoadCollectionMethod = "/milvus.proto.milvus.MilvusService/LoadCollection";
+const char* const kReleaseCollectionMethod = "/milvus.proto.milvus.MilvusService/ReleaseCollection";
+const char* const kShowCollectionsMethod = "/milvus.proto.milvus.MilvusService/ShowCollections";
+const char* const kInsertMethod = "/milvus.proto.milvus.MilvusService/Insert";
+const char* const kDeleteMethod = "/milvus.proto.milvus.MilvusService/Delete";
+const char* const kSearchMethod = "/milvus.proto.milvus.MilvusService/Search";
+const char* const kQueryMethod = "/milvus.proto.milvus.MilvusService/Query";
+const char* const kGetPersistentSegmentInfoMethod = "/milvus.proto.milvus.MilvusService/GetPersistentSegmentInfo";
+const char* const kManualCompactionMethod = "/milvus.proto.milvus.MilvusService/ManualCompaction";
+const char* const kGetCompactionStateMethod = "/milvus.proto.milvus.MilvusService/GetCompactionState";
+const char* const kGetQuerySegmentInfoMethod = "/milvus.proto.milvus.MilvusService/GetQuerySegmentInfo";
+const char* const kLoadBalanceMethod = "/milvus.proto.milvus.MilvusService/LoadBalance";
+const char* const kGetMetricsMethod = "/milvus.proto.milvus.MilvusService/GetMetrics";
+}  // namespace
+
 MilvusConnection::~MilvusConnection() {
     Disconnect();
 }
 
 Status
-MilvusConnection::Connect(const std::string& uri) {
-    ::grpc::ChannelArguments args;
-    args.SetMaxSendMessageSize(-1);     // max send message size: 2GB
-    args.SetMaxReceiveMessageSize(-1);  // max receive message size: 2GB
-    channel_ = ::grpc::CreateCustomChannel(uri, ::grpc::InsecureChannelCredentials(), args);
+MilvusConnection::Connect(const std::string& uri, bool shared_channel, std::chrono::milliseconds idle_timeout) {
+    Endpoint endpoint;
+    auto status = ResolveEndpoint(uri, endpoint);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    ChannelArgs args;
+    args.SetInt(GRPC_ARG_MAX_SEND_MESSAGE_LENGTH, -1);     // max send message size: 2GB
+    args.SetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, -1);  // max receive message size: 2GB
+    args.SetResourceQuota(threading_.QuotaMaxThreads(), threading_.QuotaMemoryBytes());
+    if (endpoint.transport_ == Transport::UNIX) {
+        // same-host IPC: a proxy never applies, the bandwidth-delay product is meaningless and the server is
+        // expected back quickly after a restart
+        args.SetInt(GRPC_ARG_ENABLE_HTTP_PROXY, 0);
+        args.SetInt(GRPC_ARG_HTTP2_BDP_PROBE, 0);
+        args.SetInt(GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES, 4 * 1024 * 1024);
+        args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, 100);
+        args.SetInt(GRPC_ARG_MIN_RECONNECT_BACKOFF_MS, 100);
+        args.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, 1000);
+    }
+    if (shared_channel) {
+        channel_ = ChannelRegistry::Instance().Acquire(endpoint.target_, args, idle_timeout);
+    } else {
+        channel_ = CreateChannel(endpoint.target_, args);
+    }
     if (channel_ != nullptr) {
         stub_ = proto::milvus::MilvusService::NewStub(channel_);
+        search_method_.reset(new ::grpc::internal::RpcMethod(kSearchMethod, ::grpc::internal::RpcMethod::NORMAL_RPC,
+                                                             channel_));
+        query_method_.reset(new ::grpc::internal::RpcMethod(kQueryMethod, ::grpc::internal::RpcMethod::NORMAL_RPC,
+                                                            channel_));
         return Status::OK();
     }
 
@@ -45,11 +93,63 @@ MilvusConnection::Connect(const std::string& uri) {
 
 Status
 MilvusConnection::Disconnect() {
-    stub_.release();
+    std::vector<std::shared_ptr<AsyncQueue>> async_queues;
+    {
+        std::lock_guard<std::mutex> lock(async_mutex_);
+        async_queues.swap(async_queues_);
+    }
+    for (auto& async_queue : async_queues) {
+        async_queue->Shutdown();
+    }
+    {
+        // the pool is joined by the last caller still using it
+        std::lock_guard<std::mutex> lock(worker_mutex_);
+        worker_pool_ = nullptr;
+    }
+
+    stub_.reset();
+    search_method_.reset();
+    query_method_.reset();
     channel_.reset();
     return Status::OK();
 }
 
+void
+MilvusConnection::SetAdmissionController(std::shared_ptr<AdmissionController> admission) {
+    admission_ = std::move(admission);
+}
+
+void
+MilvusConnection::SetCaptureWriter(std::shared_ptr<CaptureWriter> capture) {
+    capture_ = std::move(capture);
+}
+
+Status
+MilvusConnection::SetThreading(const ThreadingConfig& threading) {
+    if (threading.CompletionQueueCount() == 0 || threading.ThreadsPerQueue() == 0) {
+        return Status(StatusCode::InvalidAgument, "Completion queue count and threads per queue must be positive");
+    }
+    auto status = ResolveCpuAffinity(threading, cpus_);
+    if (!status.IsOk()) {
+        return status;
+    }
+    threading_ = threading;
+    return Status::OK();
+}
+
+std::shared_ptr<ThreadPool>
+MilvusConnection::WorkerPool() {
+    std::lock_guard<std::mutex> lock(worker_mutex_);
+    if (worker_pool_ == nullptr) {
+        size_t thread_num = threading_.WorkerThreads();
+        if (thread_num == 0) {
+            thread_num = std::thread::hardware_concurrency();
+        }
+        worker_pool_ = std::make_shared<ThreadPool>(thread_num, cpus_);
+    }
+    return worker_pool_;
+}
+
 Status
 MilvusConnection::CreateCollection(const proto::milvus::CreateCollectionRequest& request,
                                    proto::common::Status& response) {
@@ -57,8 +157,15 @@ MilvusConnection::CreateCollection(const proto::milvus::CreateCollectionRequest&
         return Status(StatusCode::NotConnected, "Connection is not ready!");
     }
 
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kCreateCollectionMethod, request);
     ClientContext context;
     ::grpc::Status grpc_status = stub_->CreateCollection(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
 
     if (!grpc_status.ok()) {
         std::cerr << "CreateCollection failed!" << std::endl;
@@ -81,18 +188,75 @@ MilvusConnection::HasCollection(const proto::milvus::HasCollectionRequest& reque
 
 Status
 MilvusConnection::LoadCollection(const proto::milvus::LoadCollectionRequest& request, proto::common::Status& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kLoadCollectionMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->LoadCollection(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "LoadCollection failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
     return Status::OK();
 }
 
 Status
 MilvusConnection::ReleaseCollection(const proto::milvus::ReleaseCollectionRequest& request,
                                     proto::common::Status& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kReleaseCollectionMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->ReleaseCollection(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "ReleaseCollection failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
     return Status::OK();
 }
 
 Status
 MilvusConnection::DescribeCollection(const proto::milvus::DescribeCollectionRequest& request,
                                      proto::milvus::DescribeCollectionResponse& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kDescribeCollectionMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->DescribeCollection(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "DescribeCollection failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
     return Status::OK();
 }
 
@@ -105,6 +269,391 @@ MilvusConnection::GetCollectionStats(const proto::milvus::GetCollectionStatistic
 Status
 MilvusConnection::ShowCollections(const proto::milvus::ShowCollectionsRequest& request,
                                   proto::milvus::ShowCollectionsResponse& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kShowCollectionsMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->ShowCollections(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "ShowCollections failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::Insert(const proto::milvus::InsertRequest& request, proto::milvus::MutationResult& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::INSERT);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kInsertMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->Insert(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "Insert failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::Delete(const proto::milvus::DeleteRequest& request, proto::milvus::MutationResult& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::INSERT);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kDeleteMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->Delete(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "Delete failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::Query(const proto::milvus::QueryRequest& request, proto::milvus::QueryResults& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::QUERY);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kQueryMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->Query(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "Query failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::Search(const proto::milvus::SearchRequest& request, proto::milvus::SearchResults& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::SEARCH);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kSearchMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->Search(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "Search failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::Search(const ::grpc::ByteBuffer& request, proto::milvus::SearchResults& response) {
+    return RawCall(search_method_.get(), "Search", RequestClass::SEARCH, request, response);
+}
+
+Status
+MilvusConnection::Search(const proto::milvus::SearchRequest& request, ::grpc::ByteBuffer& response) {
+    return RawCall(search_method_.get(), "Search", RequestClass::SEARCH, request, response);
+}
+
+Status
+MilvusConnection::Search(const ::grpc::ByteBuffer& request, ::grpc::ByteBuffer& response) {
+    return RawCall(search_method_.get(), "Search", RequestClass::SEARCH, request, response);
+}
+
+Status
+MilvusConnection::Query(const proto::milvus::QueryRequest& request, ::grpc::ByteBuffer& response) {
+    return RawCall(query_method_.get(), "Query", RequestClass::QUERY, request, response);
+}
+
+Status
+MilvusConnection::GetPersistentSegmentInfo(const proto::milvus::GetPersistentSegmentInfoRequest& request,
+                                           proto::milvus::GetPersistentSegmentInfoResponse& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kGetPersistentSegmentInfoMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->GetPersistentSegmentInfo(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "GetPersistentSegmentInfo failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::ManualCompaction(const proto::milvus::ManualCompactionRequest& request,
+                                   proto::milvus::ManualCompactionResponse& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kManualCompactionMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->ManualCompaction(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "ManualCompaction failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::GetCompactionState(const proto::milvus::GetCompactionStateRequest& request,
+                                     proto::milvus::GetCompactionStateResponse& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kGetCompactionStateMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->GetCompactionState(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "GetCompactionState failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::GetQuerySegmentInfo(const proto::milvus::GetQuerySegmentInfoRequest& request,
+                                      proto::milvus::GetQuerySegmentInfoResponse& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kGetQuerySegmentInfoMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->GetQuerySegmentInfo(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "GetQuerySegmentInfo failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::LoadBalance(const proto::milvus::LoadBalanceRequest& request, proto::common::Status& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kLoadBalanceMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->LoadBalance(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "LoadBalance failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::GetMetrics(const proto::milvus::GetMetricsRequest& request,
+                             proto::milvus::GetMetricsResponse& response) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), RequestClass::ADMIN);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(kGetMetricsMethod, request);
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->GetMetrics(&context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << "GetMetrics failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
+    return Status::OK();
+}
+
+Status
+MilvusConnection::DescribeCollectionAsync(const proto::milvus::DescribeCollectionRequest& request,
+                                          TypedAsyncCall<proto::milvus::DescribeCollectionResponse>::Done done,
+                                          std::shared_ptr<AsyncHandle>& handle) {
+    auto stub = stub_.get();
+    auto prepare = [stub, &request](ClientContext* context, ::grpc::CompletionQueue* queue) {
+        return stub->PrepareAsyncDescribeCollection(context, request, queue);
+    };
+    auto status =
+        StartAsync<proto::milvus::DescribeCollectionResponse>(prepare, RequestClass::ADMIN, std::move(done), handle);
+    if (status.IsOk()) {
+        Capture(kDescribeCollectionMethod, request);
+    }
+    return status;
+}
+
+Status
+MilvusConnection::SearchAsync(const proto::milvus::SearchRequest& request,
+                              TypedAsyncCall<proto::milvus::SearchResults>::Done done,
+                              std::shared_ptr<AsyncHandle>& handle) {
+    auto stub = stub_.get();
+    auto prepare = [stub, &request](ClientContext* context, ::grpc::CompletionQueue* queue) {
+        return stub->PrepareAsyncSearch(context, request, queue);
+    };
+    auto status = StartAsync<proto::milvus::SearchResults>(prepare, RequestClass::SEARCH, std::move(done), handle);
+    if (status.IsOk()) {
+        Capture(kSearchMethod, request);
+    }
+    return status;
+}
+
+Status
+MilvusConnection::QueryAsync(const proto::milvus::QueryRequest& request,
+                             TypedAsyncCall<proto::milvus::QueryResults>::Done done,
+                             std::shared_ptr<AsyncHandle>& handle) {
+    auto stub = stub_.get();
+    auto prepare = [stub, &request](ClientContext* context, ::grpc::CompletionQueue* queue) {
+        return stub->PrepareAsyncQuery(context, request, queue);
+    };
+    auto status = StartAsync<proto::milvus::QueryResults>(prepare, RequestClass::QUERY, std::move(done), handle);
+    if (status.IsOk()) {
+        Capture(kQueryMethod, request);
+    }
+    return status;
+}
+
+template <typename Response>
+Status
+MilvusConnection::StartAsync(typename TypedAsyncCall<Response>::Prepare&& prepare, RequestClass request_class,
+                             typename TypedAsyncCall<Response>::Done&& done, std::shared_ptr<AsyncHandle>& handle) {
+    if (stub_ == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    std::unique_ptr<AdmissionGuard> admission(new AdmissionGuard(admission_.get(), request_class, false));
+    if (!admission->Result().IsOk()) {
+        return admission->Result();
+    }
+
+    std::shared_ptr<AsyncQueue> async_queue;
+    {
+        std::lock_guard<std::mutex> lock(async_mutex_);
+        if (async_queues_.empty()) {
+            for (uint32_t i = 0; i < threading_.CompletionQueueCount(); ++i) {
+                async_queues_.push_back(AsyncQueue::Create(threading_.ThreadsPerQueue(), cpus_));
+            }
+        }
+        async_queue = async_queues_[next_queue_++ % async_queues_.size()];
+    }
+
+    auto call = std::make_shared<TypedAsyncCall<Response>>(std::move(prepare), std::move(done), std::move(admission));
+    return async_queue->Start(call, handle);
+}
+
+template <typename Request, typename Response>
+Status
+MilvusConnection::RawCall(const ::grpc::internal::RpcMethod* method, const char* name, RequestClass request_class,
+                          const Request& request, Response& response) {
+    if (stub_ == nullptr || method == nullptr) {
+        return Status(StatusCode::NotConnected, "Connection is not ready!");
+    }
+
+    AdmissionGuard admission(admission_.get(), request_class);
+    if (!admission.Result().IsOk()) {
+        return admission.Result();
+    }
+
+    Capture(method->name(), request);
+    ClientContext context;
+    ::grpc::Status grpc_status = ::grpc::internal::BlockingUnaryCall<Request, Response>(
+        channel_.get(), *method, &context, request, &response);
+    admission.SetSucceeded(grpc_status.ok());
+
+    if (!grpc_status.ok()) {
+        std::cerr << name << " failed!" << std::endl;
+        return Status(StatusCode::ServerFailed, grpc_status.error_message());
+    }
+
     return Status::OK();
 }
 
@@ -20,16 +20,28 @@
 #include <grpcpp/channel.h>
 #include <grpcpp/client_context.h>
 #include <grpcpp/create_channel.h>
+#include <grpcpp/impl/codegen/rpc_method.h>
 #include <grpcpp/security/credentials.h>
+#include <grpcpp/support/byte_buffer.h>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
+#include "AdmissionController.h"
+#include "AsyncQueue.h"
+#include "CaptureLog.h"
+#include "ChannelRegistry.h"
 #include "Status.h"
+#include "ThreadPool.h"
 #include "common.pb.h"
 #include "milvus.grpc.pb.h"
 #include "milvus.pb.h"
 #include "schema.pb.h"
+#include "types/ThreadingConfig.h"
 
 namespace milvus {
 class MilvusConnection {
@@ -38,12 +50,43 @@ class MilvusConnection {
 
     virtual ~MilvusConnection();
 
+    /**
+     * @brief Connect to uri, with shared_channel the channel is taken from the process-wide ChannelRegistry and
+     * is closed after idle_timeout once no connection uses it.
+     */
     Status
-    Connect(const std::string& uri);
+    Connect(const std::string& uri, bool shared_channel, std::chrono::milliseconds idle_timeout);
 
     Status
     Disconnect();
 
+    /**
+     * @brief Gate every RPC by the admission controller, null to disable admission control.
+     */
+    void
+    SetAdmissionController(std::shared_ptr<AdmissionController> admission);
+
+    /**
+     * @brief Record every request into the capture log, null to disable capture.
+     */
+    void
+    SetCaptureWriter(std::shared_ptr<CaptureWriter> capture);
+
+    /**
+     * @brief Completion queues, polling threads and their cpu affinity, and the resource quota of the channel.
+     * Must be set before Connect().
+     */
+    Status
+    SetThreading(const ThreadingConfig& threading);
+
+    /**
+     * @brief Pool for cpu-bound work and the parallel requests of a chunked delete of the client, sized by
+     * ThreadingConfig::WorkerThreads() and pinned like the polling threads. Created by the first call, released by
+     * Disconnect().
+     */
+    std::shared_ptr<ThreadPool>
+    WorkerPool();
+
     Status
     CreateCollection(const proto::milvus::CreateCollectionRequest& request, proto::common::Status& response);
 
@@ -71,9 +114,121 @@ class MilvusConnection {
     ShowCollections(const proto::milvus::ShowCollectionsRequest& request,
                     proto::milvus::ShowCollectionsResponse& response);
 
+    Status
+    Insert(const proto::milvus::InsertRequest& request, proto::milvus::MutationResult& response);
+
+    Status
+    Delete(const proto::milvus::DeleteRequest& request, proto::milvus::MutationResult& response);
+
+    Status
+    Query(const proto::milvus::QueryRequest& request, proto::milvus::QueryResults& response);
+
+    Status
+    Search(const proto::milvus::SearchRequest& request, proto::milvus::SearchResults& response);
+
+    /**
+     * @brief Send a serialized SearchRequest as it is, used by prepared search.
+     */
+    Status
+    Search(const ::grpc::ByteBuffer& request, proto::milvus::SearchResults& response);
+
+    /**
+     * @brief Receive the serialized SearchResults without parsing, used by lazy results.
+     */
+    Status
+    Search(const proto::milvus::SearchRequest& request, ::grpc::ByteBuffer& response);
+
+    Status
+    Search(const ::grpc::ByteBuffer& request, ::grpc::ByteBuffer& response);
+
+    /**
+     * @brief Receive the serialized QueryResults without parsing, used by lazy results.
+     */
+    Status
+    Query(const proto::milvus::QueryRequest& request, ::grpc::ByteBuffer& response);
+
+    Status
+    GetPersistentSegmentInfo(const proto::milvus::GetPersistentSegmentInfoRequest& request,
+                             proto::milvus::GetPersistentSegmentInfoResponse& response);
+
+    Status
+    ManualCompaction(const proto::milvus::ManualCompactionRequest& request,
+                     proto::milvus::ManualCompactionResponse& response);
+
+    Status
+    GetCompactionState(const proto::milvus::GetCompactionStateRequest& request,
+                       proto::milvus::GetCompactionStateResponse& response);
+
+    Status
+    GetQuerySegmentInfo(const proto::milvus::GetQuerySegmentInfoRequest& request,
+                        proto::milvus::GetQuerySegmentInfoResponse& response);
+
+    Status
+    LoadBalance(const proto::milvus::LoadBalanceRequest& request, proto::common::Status& response);
+
+    Status
+    GetMetrics(const proto::milvus::GetMetricsRequest& request, proto::milvus::GetMetricsResponse& response);
+
+    /**
+     * @brief Send the request without blocking, done is invoked on the completion thread of the connection when the
+     * call completes. Admission is not waited for, a throttled call fails at once. done is not invoked if the call
+     * fails to start.
+     */
+    Status
+    DescribeCollectionAsync(const proto::milvus::DescribeCollectionRequest& request,
+                            TypedAsyncCall<proto::milvus::DescribeCollectionResponse>::Done done,
+                            std::shared_ptr<AsyncHandle>& handle);
+
+    Status
+    SearchAsync(const proto::milvus::SearchRequest& request, TypedAsyncCall<proto::milvus::SearchResults>::Done done,
+                std::shared_ptr<AsyncHandle>& handle);
+
+    Status
+    QueryAsync(const proto::milvus::QueryRequest& request, TypedAsyncCall<proto::milvus::QueryResults>::Done done,
+               std::shared_ptr<AsyncHandle>& handle);
+
+ private:
+    /**
+     * @brief Unary call through a method registered on the channel, request and response can be messages or
+     * serialized byte buffers.
+     */
+    template <typename Request, typename Response>
+    Status
+    RawCall(const ::grpc::internal::RpcMethod* method, const char* name, RequestClass request_class,
+            const Request& request, Response& response);
+
+    template <typename Request>
+    void
+    Capture(const char* method, const Request& request) {
+        if (capture_ != nullptr) {
+            capture_->Record(method, request);
+        }
+    }
+
+    template <typename Response>
+    Status
+    StartAsync(typename TypedAsyncCall<Response>::Prepare&& prepare, RequestClass request_class,
+               typename TypedAsyncCall<Response>::Done&& done, std::shared_ptr<AsyncHandle>& handle);
+
  private:
     std::unique_ptr<proto::milvus::MilvusService::Stub> stub_;
     std::shared_ptr<grpc::Channel> channel_;
+    std::unique_ptr<::grpc::internal::RpcMethod> search_method_;
+    std::unique_ptr<::grpc::internal::RpcMethod> query_method_;
+    std::shared_ptr<AdmissionController> admission_;
+    std::shared_ptr<CaptureWriter> capture_;
+
+    ThreadingConfig threading_;
+    std::vector<int> cpus_;
+
+    // created by the first async call
+    std::mutex async_mutex_;
+    std::vector<std::shared_ptr<AsyncQueue>> async_queues_;
+    std::atomic<size_t> next_queue_{0};
+
+    // created by the first call of WorkerPool()
+    std::mutex worker_mutex_;
+    std::shared_ptr<ThreadPool> worker_pool_;
 };
 
 }  // namespace milvus
@@ -0,0 +1,127 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "QueryNodeBalancer.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <utility>
+
+namespace milvus {
+
+namespace {
+
+double
+Skew(const std::map<int64_t, int64_t>& loads) {
+    int64_t total = 0;
+    int64_t largest = 0;
+    for (const auto& pair : loads) {
+        total += pair.second;
+        largest = std::max(largest, pair.second);
+    }
+    if (loads.size() < 2 || total == 0) {
+        return 1.0;
+    }
+    const double mean = static_cast<double>(total) / static_cast<double>(loads.size());
+    return static_cast<double>(largest) / mean;
+}
+
+}  // namespace
+
+BalancePlan
+PlanBalance(const std::vector<QuerySegmentInfo>& segments, const std::vector<int64_t>& query_nodes,
+            double skew_threshold, uint32_t max_moves) {
+    // memory is the load unless the server doesn't report it
+    bool by_rows = true;
+    for (const auto& segment : segments) {
+        by_rows = by_rows && segment.MemSize() == 0;
+    }
+    auto weight = [by_rows](const QuerySegmentInfo& segment) {
+        return by_rows ? segment.RowCount() : segment.MemSize();
+    };
+
+    std::map<int64_t, NodeLoad> node_loads;
+    std::map<int64_t, int64_t> loads;
+    // movable segments of each node as (weight, segment id), largest first
+    std::map<int64_t, std::vector<std::pair<int64_t, int64_t>>> movable;
+    for (auto node_id : query_nodes) {
+        node_loads[node_id].node_id_ = node_id;
+        loads[node_id] = 0;
+    }
+    for (const auto& segment : segments) {
+        auto& node_load = node_loads[segment.NodeID()];
+        node_load.node_id_ = segment.NodeID();
+        ++node_load.segment_count_;
+        node_load.row_count_ += segment.RowCount();
+        node_load.mem_size_ += segment.MemSize();
+        loads[segment.NodeID()] += weight(segment);
+        // growing segments are served from the stream and can't be moved
+        if (segment.State() != SegmentState::GROWING && weight(segment) > 0) {
+            movable[segment.NodeID()].emplace_back(weight(segment), segment.SegmentID());
+        }
+    }
+    for (auto& pair : movable) {
+        std::sort(pair.second.begin(), pair.second.end(), std::greater<std::pair<int64_t, int64_t>>());
+    }
+
+    BalancePlan plan;
+    for (const auto& pair : node_loads) {
+        plan.node_loads_.push_back(pair.second);
+    }
+    plan.skew_ = Skew(loads);
+
+    for (uint32_t moved = 0; moved < max_moves && Skew(loads) > skew_threshold; ++moved) {
+        auto heavy = std::max_element(loads.begin(), loads.end(), [](const std::pair<const int64_t, int64_t>& lhs,
+                                                                      const std::pair<const int64_t, int64_t>& rhs) {
+            return lhs.second < rhs.second;
+        });
+        auto light = std::min_element(loads.begin(), loads.end(), [](const std::pair<const int64_t, int64_t>& lhs,
+                                                                      const std::pair<const int64_t, int64_t>& rhs) {
+            return lhs.second < rhs.second;
+        });
+        // moving a segment of weight w changes the gap to |gap - 2w|, it narrows only if w < gap
+        const int64_t gap = heavy->second - light->second;
+        auto& candidates = movable[heavy->first];
+        auto candidate = std::find_if(candidates.begin(), candidates.end(),
+                                      [gap](const std::pair<int64_t, int64_t>& item) { return item.first < gap; });
+        if (candidate == candidates.end()) {
+            break;
+        }
+
+        const int64_t segment_weight = candidate->first;
+        const int64_t segment_id = candidate->second;
+        candidates.erase(candidate);
+        heavy->second -= segment_weight;
+        light->second += segment_weight;
+
+        auto move = std::find_if(plan.moves_.begin(), plan.moves_.end(), [&](const BalanceMove& item) {
+            return item.source_node_ == heavy->first && item.target_node_ == light->first;
+        });
+        if (move == plan.moves_.end()) {
+            plan.moves_.emplace_back();
+            move = plan.moves_.end() - 1;
+            move->source_node_ = heavy->first;
+            move->target_node_ = light->first;
+        }
+        move->segment_ids_.push_back(segment_id);
+        move->load_ += segment_weight;
+    }
+    plan.projected_skew_ = Skew(loads);
+    return plan;
+}
+
+}  // namespace milvus
@@ -0,0 +1,49 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types/BalanceResults.h"
+#include "types/QuerySegmentInfo.h"
+
+namespace milvus {
+
+/**
+ * @brief Node loads and the segment moves proposed to balance them.
+ */
+struct BalancePlan {
+    std::vector<NodeLoad> node_loads_;
+    double skew_ = 1.0;
+    double projected_skew_ = 1.0;
+    std::vector<BalanceMove> moves_;
+};
+
+/**
+ * @brief Aggregate the segments by query node and plan the moves of sealed segments, see BalanceArguments.
+ *
+ * @param [in] segments segments loaded by the query nodes
+ * @param [in] query_nodes nodes to balance onto even if they hold no segment
+ * @param [in] skew_threshold largest load to mean load ratio tolerated
+ * @param [in] max_moves segments moved at most
+ */
+BalancePlan
+PlanBalance(const std::vector<QuerySegmentInfo>& segments, const std::vector<int64_t>& query_nodes,
+            double skew_threshold, uint32_t max_moves);
+
+}  // namespace milvus
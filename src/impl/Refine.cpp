@@ -0,0 +1,92 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Refine.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "TypeUtils.h"
+
+namespace milvus {
+
+namespace {
+
+float
+RoundScore(float score, int round_decimal) {
+    if (round_decimal < 0) {
+        return score;
+    }
+    const double scale = std::pow(10.0, round_decimal);
+    return static_cast<float>(std::round(score * scale) / scale);
+}
+
+template <typename T>
+std::vector<T>
+GatherIds(const std::vector<T>& ids, const std::vector<uint32_t>& rows) {
+    std::vector<T> gathered;
+    gathered.reserve(rows.size());
+    for (auto row : rows) {
+        gathered.push_back(ids[row]);
+    }
+    return gathered;
+}
+
+}  // namespace
+
+void
+RerankResult(const SingleResult& candidates, const std::vector<const void*>& vectors, const void* target,
+             size_t dimension, const DistanceMetric& metric, int64_t topk, int round_decimal,
+             const std::string& drop_field, SingleResult& refined) {
+    std::vector<uint32_t> rows;
+    std::vector<float> distances(vectors.size());
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        if (vectors[i] != nullptr) {
+            distances[i] = metric.Distance(target, vectors[i], dimension);
+            rows.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    // ties keep the order of the index
+    const size_t keep = std::min(rows.size(), static_cast<size_t>(std::max<int64_t>(topk, 0)));
+    std::partial_sort(rows.begin(), rows.begin() + keep, rows.end(), [&](uint32_t lhs, uint32_t rhs) {
+        if (distances[lhs] != distances[rhs]) {
+            return metric.Closer(distances[lhs], distances[rhs]);
+        }
+        return lhs < rhs;
+    });
+    rows.resize(keep);
+
+    std::vector<float> scores;
+    scores.reserve(keep);
+    for (auto row : rows) {
+        scores.push_back(RoundScore(distances[row], round_decimal));
+    }
+
+    const auto& ids = candidates.Ids();
+    IDArray refined_ids = ids.IsIntegerID() ? IDArray(GatherIds(ids.IntIDArray(), rows))
+                                            : IDArray(GatherIds(ids.StrIDArray(), rows));
+
+    std::vector<FieldDataPtr> output_fields;
+    for (const auto& field : candidates.OutputFields()) {
+        if (field->Name() != drop_field) {
+            output_fields.push_back(GatherRows(*field, rows));
+        }
+    }
+    refined = SingleResult(std::move(refined_ids), std::move(scores), std::move(output_fields));
+}
+
+}  // namespace milvus
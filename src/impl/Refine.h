@@ -0,0 +1,46 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Distance.h"
+#include "types/SearchResults.h"
+
+namespace milvus {
+
+/**
+ * @brief Re-rank the candidates of one target vector by their exact distances and keep the closest topk.
+ *
+ * @param [in] candidates hits returned by the index, more than topk
+ * @param [in] vectors vector of each hit, nullptr if the vector is unknown and the hit is dropped
+ * @param [in] target target vector
+ * @param [in] dimension dimension of the vector field
+ * @param [in] metric exact distance function
+ * @param [in] topk number of hits to keep
+ * @param [in] round_decimal decimal places of the scores, -1 means no rounding
+ * @param [in] drop_field name of an output field to remove from the result, empty to keep all
+ * @param [out] refined re-ranked hits, ordered by exact distance
+ */
+void
+RerankResult(const SingleResult& candidates, const std::vector<const void*>& vectors, const void* target,
+             size_t dimension, const DistanceMetric& metric, int64_t topk, int round_decimal,
+             const std::string& drop_field, SingleResult& refined);
+
+}  // namespace milvus
@@ -0,0 +1,260 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RowTransposer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "types/FieldData.h"
+
+namespace milvus {
+
+namespace {
+
+/**
+ * @brief Output column prepared before the copy, all pointers refer to the request buffers.
+ */
+struct ColumnSink {
+    DataType data_type = DataType::UNKNOWN;
+    size_t offset = 0;
+    size_t row_bytes = 0;  // bytes per row of a vector field
+    void* dest = nullptr;
+    google::protobuf::RepeatedPtrField<std::string>* strings = nullptr;
+};
+
+size_t
+ElementSize(DataType data_type) {
+    switch (data_type) {
+        case DataType::BOOL:
+            return sizeof(bool);
+        case DataType::INT8:
+            return sizeof(int8_t);
+        case DataType::INT16:
+            return sizeof(int16_t);
+        case DataType::INT32:
+            return sizeof(int32_t);
+        case DataType::INT64:
+            return sizeof(int64_t);
+        case DataType::FLOAT:
+            return sizeof(float);
+        case DataType::DOUBLE:
+            return sizeof(double);
+        case DataType::STRING:
+            return sizeof(std::string);
+        default:
+            return 0;
+    }
+}
+
+template <typename Src, typename Dst>
+void
+CopyScalars(const char* rows, size_t row_size, size_t offset, size_t begin, size_t end, void* dest) {
+    Dst* out = static_cast<Dst*>(dest);
+    const char* src = rows + begin * row_size + offset;
+    for (size_t i = begin; i < end; ++i, src += row_size) {
+        Src value;
+        std::memcpy(&value, src, sizeof(Src));
+        out[i] = static_cast<Dst>(value);
+    }
+}
+
+void
+CopyVectors(const char* rows, size_t row_size, size_t offset, size_t row_bytes, size_t begin, size_t end,
+            void* dest) {
+    char* out = static_cast<char*>(dest) + begin * row_bytes;
+    const char* src = rows + begin * row_size + offset;
+    for (size_t i = begin; i < end; ++i, src += row_size, out += row_bytes) {
+        std::memcpy(out, src, row_bytes);
+    }
+}
+
+void
+CopyBlock(const std::vector<ColumnSink>& sinks, const char* rows, size_t row_size, size_t begin, size_t end) {
+    for (const auto& sink : sinks) {
+        switch (sink.data_type) {
+            case DataType::BOOL:
+                CopyScalars<bool, bool>(rows, row_size, sink.offset, begin, end, sink.dest);
+                break;
+            case DataType::INT8:
+                CopyScalars<int8_t, int32_t>(rows, row_size, sink.offset, begin, end, sink.dest);
+                break;
+            case DataType::INT16:
+                CopyScalars<int16_t, int32_t>(rows, row_size, sink.offset, begin, end, sink.dest);
+                break;
+            case DataType::INT32:
+                CopyScalars<int32_t, int32_t>(rows, row_size, sink.offset, begin, end, sink.dest);
+                break;
+            case DataType::INT64:
+                CopyScalars<int64_t, int64_t>(rows, row_size, sink.offset, begin, end, sink.dest);
+                break;
+            case DataType::FLOAT:
+                CopyScalars<float, float>(rows, row_size, sink.offset, begin, end, sink.dest);
+                break;
+            case DataType::DOUBLE:
+                CopyScalars<double, double>(rows, row_size, sink.offset, begin, end, sink.dest);
+                break;
+            case DataType::STRING:
+                for (size_t i = begin; i < end; ++i) {
+                    const auto* src = reinterpret_cast<const std::string*>(rows + i * row_size + sink.offset);
+                    *sink.strings->Mutable(static_cast<int>(i)) = *src;
+                }
+                break;
+            case DataType::BINARY_VECTOR:
+            case DataType::FLOAT_VECTOR:
+                CopyVectors(rows, row_size, sink.offset, sink.row_bytes, begin, end, sink.dest);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+template <typename T>
+void*
+ResizeRepeated(google::protobuf::RepeatedField<T>* repeated, size_t count) {
+    repeated->Resize(static_cast<int>(count), T());
+    return repeated->mutable_data();
+}
+
+Status
+PrepareSink(const RowFieldLayout& field, size_t row_size, size_t row_count, proto::schema::FieldData& proto_field,
+            ColumnSink& sink) {
+    sink.data_type = field.data_type_;
+    sink.offset = field.offset_;
+
+    size_t field_bytes = ElementSize(field.data_type_);
+    if (field.data_type_ == DataType::FLOAT_VECTOR) {
+        field_bytes = sizeof(float) * field.dimension_;
+    } else if (field.data_type_ == DataType::BINARY_VECTOR) {
+        if (field.dimension_ % 8 != 0) {
+            return Status(StatusCode::InvalidAgument, "Binary vector dimension of field '" + field.name_ +
+                                                          "' must be divisible by 8");
+        }
+        field_bytes = field.dimension_ / 8;
+    }
+    if (field_bytes == 0) {
+        return Status(StatusCode::InvalidAgument, "Invalid data type or dimension of field '" + field.name_ + "'");
+    }
+    if (field.offset_ + field_bytes > row_size) {
+        return Status(StatusCode::InvalidAgument, "Field '" + field.name_ + "' exceeds the row size");
+    }
+
+    proto_field.set_field_name(field.name_);
+    proto_field.set_type(static_cast<proto::schema::DataType>(field.data_type_));
+    auto scalars = proto_field.mutable_scalars();
+    switch (field.data_type_) {
+        case DataType::BOOL:
+            sink.dest = ResizeRepeated(scalars->mutable_bool_data()->mutable_data(), row_count);
+            break;
+        case DataType::INT8:
+        case DataType::INT16:
+        case DataType::INT32:
+            sink.dest = ResizeRepeated(scalars->mutable_int_data()->mutable_data(), row_count);
+            break;
+        case DataType::INT64:
+            sink.dest = ResizeRepeated(scalars->mutable_long_data()->mutable_data(), row_count);
+            break;
+        case DataType::FLOAT:
+            sink.dest = ResizeRepeated(scalars->mutable_float_data()->mutable_data(), row_count);
+            break;
+        case DataType::DOUBLE:
+            sink.dest = ResizeRepeated(scalars->mutable_double_data()->mutable_data(), row_count);
+            break;
+        case DataType::STRING:
+            sink.strings = scalars->mutable_string_data()->mutable_data();
+            sink.strings->Reserve(static_cast<int>(row_count));
+            for (size_t i = 0; i < row_count; ++i) {
+                sink.strings->Add();
+            }
+            break;
+        case DataType::FLOAT_VECTOR: {
+            auto vectors = proto_field.mutable_vectors();
+            vectors->set_dim(field.dimension_);
+            sink.row_bytes = field_bytes;
+            sink.dest = ResizeRepeated(vectors->mutable_float_vector()->mutable_data(), row_count * field.dimension_);
+            break;
+        }
+        case DataType::BINARY_VECTOR: {
+            auto vectors = proto_field.mutable_vectors();
+            vectors->set_dim(field.dimension_);
+            sink.row_bytes = field_bytes;
+            auto binary = vectors->mutable_binary_vector();
+            binary->resize(row_count * field_bytes);
+            sink.dest = &(*binary)[0];
+            break;
+        }
+        default:
+            break;
+    }
+    return Status::OK();
+}
+
+}  // namespace
+
+Status
+RowTransposer::Transpose(const RowLayout& layout, const void* rows, size_t row_count,
+                         proto::milvus::InsertRequest& request) const {
+    const size_t row_size = layout.RowSize();
+    if (rows == nullptr || row_size == 0 || layout.Fields().empty()) {
+        return Status(StatusCode::InvalidAgument, "Row layout or row data is empty");
+    }
+
+    std::vector<ColumnSink> sinks(layout.Fields().size());
+    for (size_t i = 0; i < sinks.size(); ++i) {
+        auto status = PrepareSink(layout.Fields()[i], row_size, row_count, *request.add_fields_data(), sinks[i]);
+        if (!status.IsOk()) {
+            return status;
+        }
+    }
+    request.set_num_rows(static_cast<uint32_t>(row_count));
+
+    // all fields of a block are copied while the block is still in cache
+    const size_t block_rows = std::max<size_t>(1, block_bytes_ / row_size);
+    const size_t block_count = (row_count + block_rows - 1) / block_rows;
+    const size_t task_count = std::min(block_count, pool_.Size());
+    const char* base = static_cast<const char*>(rows);
+
+    auto copy_blocks = [&](size_t first_block, size_t last_block) {
+        for (size_t block = first_block; block < last_block; ++block) {
+            size_t begin = block * block_rows;
+            size_t end = std::min(row_count, begin + block_rows);
+            CopyBlock(sinks, base, row_size, begin, end);
+        }
+    };
+
+    if (task_count <= 1) {
+        copy_blocks(0, block_count);
+        return Status::OK();
+    }
+
+    // each task takes a contiguous range of blocks, so the destination of a task is contiguous too
+    const size_t blocks_per_task = (block_count + task_count - 1) / task_count;
+    std::vector<std::future<void>> futures;
+    futures.reserve(task_count);
+    for (size_t first = 0; first < block_count; first += blocks_per_task) {
+        size_t last = std::min(block_count, first + blocks_per_task);
+        futures.emplace_back(pool_.Enqueue([&copy_blocks, first, last]() { copy_blocks(first, last); }));
+    }
+    for (auto& future : futures) {
+        future.wait();
+    }
+    return Status::OK();
+}
+
+}  // namespace milvus
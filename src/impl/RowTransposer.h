@@ -0,0 +1,61 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "Status.h"
+#include "ThreadPool.h"
+#include "milvus.pb.h"
+#include "types/RowLayout.h"
+
+namespace milvus {
+
+/**
+ * @brief Transpose row-oriented entities into the column-oriented fields_data of an InsertRequest.
+ *
+ * The output repeated fields are sized once and filled in place. Rows are processed in blocks small enough to
+ * stay in cache while every field of the block is copied, and blocks are split across the threads of a pool.
+ */
+class RowTransposer {
+ public:
+    /**
+     * @brief Default block size in bytes, about half of a typical L2 cache.
+     */
+    static constexpr size_t kDefaultBlockBytes = 256 * 1024;
+
+    explicit RowTransposer(ThreadPool& pool, size_t block_bytes = kDefaultBlockBytes)
+        : pool_(pool), block_bytes_(block_bytes) {
+    }
+
+    /**
+     * @brief Append one FieldData for each field of the layout into request and set num_rows.
+     *
+     * @param [in] layout memory layout of the rows
+     * @param [in] rows address of the first row
+     * @param [in] row_count number of rows
+     * @param [out] request insert request to be filled
+     * @return Status operation successfully or not
+     */
+    Status
+    Transpose(const RowLayout& layout, const void* rows, size_t row_count,
+              proto::milvus::InsertRequest& request) const;
+
+ private:
+    ThreadPool& pool_;
+    size_t block_bytes_;
+};
+
+}  // namespace milvus
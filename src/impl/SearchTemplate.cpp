@@ -0,0 +1,297 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SearchTemplate.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "ExprFormatter.h"
+#include "TypeUtils.h"
+
+namespace milvus {
+
+namespace {
+
+// wire format tags, (field_number << 3) | wire_type
+constexpr uint8_t kPlaceholderGroupTag = (6 << 3) | 2;
+constexpr uint8_t kGuaranteeTimestampTag = (11 << 3) | 0;
+constexpr uint8_t kPlaceholdersTag = (1 << 3) | 2;
+constexpr uint8_t kPlaceholderTagTag = (1 << 3) | 2;
+constexpr uint8_t kPlaceholderTypeTag = (2 << 3) | 0;
+constexpr uint8_t kPlaceholderValuesTag = (3 << 3) | 2;
+
+const char* const kPlaceholderTag = "$0";
+
+size_t
+VarintLength(uint64_t value) {
+    size_t length = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++length;
+    }
+    return length;
+}
+
+void
+AppendVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void
+AddSearchParam(proto::milvus::SearchRequest& request, const std::string& key, const std::string& value) {
+    auto kv = request.add_search_params();
+    kv->set_key(key);
+    kv->set_value(value);
+}
+
+/**
+ * @brief Raw bytes of the rows, float vectors are sent in host byte order which is little-endian on supported
+ * platforms.
+ */
+void
+VectorBytes(const Field& target_vectors, const char*& data, size_t& row_bytes) {
+    if (target_vectors.Type() == DataType::FLOAT_VECTOR) {
+        const auto& vectors = static_cast<const FloatVecFieldData&>(target_vectors);
+        data = reinterpret_cast<const char*>(vectors.Data().data());
+        row_bytes = vectors.RowWidth() * sizeof(float);
+    } else {
+        const auto& vectors = static_cast<const BinaryVecFieldData&>(target_vectors);
+        data = reinterpret_cast<const char*>(vectors.Data().data());
+        row_bytes = vectors.RowWidth();
+    }
+}
+
+size_t
+PlaceholderValueLength(const Field& target_vectors, size_t row_bytes) {
+    const auto type = target_vectors.Type() == DataType::FLOAT_VECTOR ? proto::milvus::PlaceholderType::FloatVector
+                                                                      : proto::milvus::PlaceholderType::BinaryVector;
+    return 2 + std::strlen(kPlaceholderTag) + 1 + VarintLength(type) +
+           target_vectors.Count() * (1 + VarintLength(row_bytes) + row_bytes);
+}
+
+size_t
+PlaceholderGroupLength(const Field& target_vectors) {
+    const char* data = nullptr;
+    size_t row_bytes = 0;
+    VectorBytes(target_vectors, data, row_bytes);
+    size_t value_length = PlaceholderValueLength(target_vectors, row_bytes);
+    return 1 + VarintLength(value_length) + value_length;
+}
+
+uint32_t
+FieldDimension(const FieldSchema& field) {
+    auto iter = field.TypeParams().find("dim");
+    if (iter == field.TypeParams().end()) {
+        return 0;
+    }
+    return static_cast<uint32_t>(std::strtoul(iter->second.c_str(), nullptr, 10));
+}
+
+void
+DeleteString(void* user_data) {
+    delete static_cast<std::string*>(user_data);
+}
+
+}  // namespace
+
+void
+BuildSearchRequest(const SearchArguments& arguments, proto::milvus::SearchRequest& request) {
+    request.set_collection_name(arguments.CollectionName());
+    for (const auto& partition_name : arguments.PartitionNames()) {
+        request.add_partition_names(partition_name);
+    }
+    for (const auto& field_name : arguments.OutputFields()) {
+        request.add_output_fields(field_name);
+    }
+    request.set_dsl(arguments.Expression());
+    request.set_dsl_type(proto::common::DslType::BoolExprV1);
+
+    std::string params = "{";
+    for (const auto& pair : arguments.ExtraParams()) {
+        if (params.size() > 1) {
+            params.push_back(',');
+        }
+        AppendQuoted(params, pair.first);
+        params.push_back(':');
+        AppendInt64(params, pair.second);
+    }
+    params.push_back('}');
+
+    AddSearchParam(request, "anns_field", arguments.AnnsField());
+    AddSearchParam(request, "topk", std::to_string(arguments.TopK()));
+    AddSearchParam(request, "metric_type", arguments.MetricType());
+    AddSearchParam(request, "params", params);
+    AddSearchParam(request, "round_decimal", std::to_string(arguments.RoundDecimal()));
+    request.set_travel_timestamp(arguments.TravelTimestamp());
+}
+
+Status
+CheckTargetVectors(const FieldDataPtr& target_vectors) {
+    if (target_vectors == nullptr || target_vectors->Count() == 0) {
+        return Status(StatusCode::InvalidAgument, "Target vectors are empty!");
+    }
+    if (target_vectors->Type() != DataType::FLOAT_VECTOR && target_vectors->Type() != DataType::BINARY_VECTOR) {
+        return Status(StatusCode::InvalidAgument, "Target vectors must be float vectors or binary vectors!");
+    }
+    return Status::OK();
+}
+
+void
+EncodePlaceholderGroup(const Field& target_vectors, std::string& out) {
+    const char* data = nullptr;
+    size_t row_bytes = 0;
+    VectorBytes(target_vectors, data, row_bytes);
+    const auto type = target_vectors.Type() == DataType::FLOAT_VECTOR ? proto::milvus::PlaceholderType::FloatVector
+                                                                      : proto::milvus::PlaceholderType::BinaryVector;
+
+    const size_t count = target_vectors.Count();
+    out.reserve(out.size() + PlaceholderGroupLength(target_vectors));
+    out.push_back(static_cast<char>(kPlaceholdersTag));
+    AppendVarint(out, PlaceholderValueLength(target_vectors, row_bytes));
+    out.push_back(static_cast<char>(kPlaceholderTagTag));
+    AppendVarint(out, std::strlen(kPlaceholderTag));
+    out.append(kPlaceholderTag);
+    out.push_back(static_cast<char>(kPlaceholderTypeTag));
+    AppendVarint(out, type);
+    for (size_t i = 0; i < count; ++i) {
+        out.push_back(static_cast<char>(kPlaceholderValuesTag));
+        AppendVarint(out, row_bytes);
+        out.append(data + i * row_bytes, row_bytes);
+    }
+}
+
+SearchResults
+ConvertSearchResults(const proto::schema::SearchResultData& data) {
+    std::vector<FieldDataPtr> fields;
+    fields.reserve(data.fields_data_size());
+    for (const auto& proto_field : data.fields_data()) {
+        auto field = CreateFieldData(proto_field);
+        if (field != nullptr) {
+            fields.emplace_back(std::move(field));
+        }
+    }
+
+    const auto& ids = data.ids();
+    std::vector<SingleResult> results;
+    results.reserve(data.topks_size());
+    int offset = 0;
+    for (auto topk : data.topks()) {
+        const int begin = offset;
+        const int end = offset + static_cast<int>(topk);
+        offset = end;
+
+        IDArray id_array;
+        if (ids.has_str_id()) {
+            const auto& str_ids = ids.str_id().data();
+            id_array = IDArray(std::vector<std::string>(str_ids.begin() + begin, str_ids.begin() + end));
+        } else {
+            const auto& int_ids = ids.int_id().data();
+            id_array = IDArray(std::vector<int64_t>(int_ids.begin() + begin, int_ids.begin() + end));
+        }
+        std::vector<float> scores(data.scores().begin() + begin, data.scores().begin() + end);
+
+        std::vector<uint32_t> rows;
+        rows.reserve(topk);
+        for (int row = begin; row < end; ++row) {
+            rows.push_back(static_cast<uint32_t>(row));
+        }
+        std::vector<FieldDataPtr> output_fields;
+        output_fields.reserve(fields.size());
+        for (const auto& field : fields) {
+            output_fields.emplace_back(GatherRows(*field, rows));
+        }
+        results.emplace_back(std::move(id_array), std::move(scores), std::move(output_fields));
+    }
+    return SearchResults(std::move(results));
+}
+
+Status
+SearchTemplate::Create(const SearchArguments& arguments, const CollectionSchema& schema,
+                       std::shared_ptr<const SearchTemplate>& search_template) {
+    const FieldSchema* anns_field = nullptr;
+    for (const auto& field : schema.Fields()) {
+        if (field.Name() == arguments.AnnsField()) {
+            anns_field = &field;
+        }
+    }
+    if (anns_field == nullptr) {
+        return Status(StatusCode::InvalidAgument, "Field '" + arguments.AnnsField() + "' doesn't exist");
+    }
+    const auto vector_type = anns_field->FieldDataType();
+    if (vector_type != DataType::FLOAT_VECTOR && vector_type != DataType::BINARY_VECTOR) {
+        return Status(StatusCode::InvalidAgument, "Field '" + arguments.AnnsField() + "' is not a vector field");
+    }
+    for (const auto& output_field : arguments.OutputFields()) {
+        bool found = false;
+        for (const auto& field : schema.Fields()) {
+            found = found || field.Name() == output_field;
+        }
+        if (!found) {
+            return Status(StatusCode::InvalidAgument, "Output field '" + output_field + "' doesn't exist");
+        }
+    }
+    if (arguments.TopK() <= 0) {
+        return Status(StatusCode::InvalidAgument, "TopK must be larger than zero");
+    }
+
+    proto::milvus::SearchRequest request;
+    BuildSearchRequest(arguments, request);
+
+    auto created = std::make_shared<SearchTemplate>();
+    created->collection_name_ = arguments.CollectionName();
+    created->vector_type_ = vector_type;
+    created->dimension_ = FieldDimension(*anns_field);
+    created->constant_ = ::grpc::Slice(request.SerializeAsString());
+    search_template = std::move(created);
+    return Status::OK();
+}
+
+Status
+SearchTemplate::Serialize(const Field& target_vectors, uint64_t guarantee_timestamp,
+                          ::grpc::ByteBuffer& buffer) const {
+    if (target_vectors.Type() != vector_type_) {
+        return Status(StatusCode::InvalidAgument, "Target vectors type doesn't match the anns field");
+    }
+    const uint32_t dimension = vector_type_ == DataType::FLOAT_VECTOR
+                                   ? static_cast<const FloatVecFieldData&>(target_vectors).Dimension()
+                                   : static_cast<const BinaryVecFieldData&>(target_vectors).Dimension();
+    if (dimension_ != 0 && dimension != dimension_) {
+        return Status(StatusCode::InvalidAgument, "Target vectors dimension doesn't match the anns field");
+    }
+
+    // the variable part is written into a heap string that is handed to the slice without copying
+    const size_t group_length = PlaceholderGroupLength(target_vectors);
+    auto tail = new std::string;
+    tail->reserve(1 + VarintLength(group_length) + group_length + 1 + VarintLength(guarantee_timestamp));
+    tail->push_back(static_cast<char>(kPlaceholderGroupTag));
+    AppendVarint(*tail, group_length);
+    EncodePlaceholderGroup(target_vectors, *tail);
+    if (guarantee_timestamp != 0) {
+        tail->push_back(static_cast<char>(kGuaranteeTimestampTag));
+        AppendVarint(*tail, guarantee_timestamp);
+    }
+
+    ::grpc::Slice slices[2] = {constant_, ::grpc::Slice(&(*tail)[0], tail->size(), DeleteString, tail)};
+    buffer = ::grpc::ByteBuffer(slices, 2);
+    return Status::OK();
+}
+
+}  // namespace milvus
@@ -0,0 +1,103 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+
+#include <memory>
+#include <string>
+
+#include "Status.h"
+#include "milvus.pb.h"
+#include "schema.pb.h"
+#include "types/CollectionSchema.h"
+#include "types/SearchArguments.h"
+#include "types/SearchResults.h"
+
+namespace milvus {
+
+/**
+ * @brief Fill the part of the request that doesn't depend on the target vectors: collection, partitions, filter,
+ * output fields, search parameters and travel timestamp.
+ */
+void
+BuildSearchRequest(const SearchArguments& arguments, proto::milvus::SearchRequest& request);
+
+/**
+ * @brief Check the target vectors are a non-empty vector column.
+ */
+Status
+CheckTargetVectors(const FieldDataPtr& target_vectors);
+
+/**
+ * @brief Append the serialized PlaceholderGroup of the target vectors, vectors are copied without intermediate
+ * messages.
+ */
+void
+EncodePlaceholderGroup(const Field& target_vectors, std::string& out);
+
+/**
+ * @brief Split the flat search results into one SingleResult for each target vector.
+ */
+SearchResults
+ConvertSearchResults(const proto::schema::SearchResultData& data);
+
+/**
+ * @brief Serialized constant part of a SearchRequest, created by PrepareSearch().
+ *
+ * Protobuf messages are concatenable on the wire, so a request is the constant bytes followed by the
+ * placeholder_group and guarantee_timestamp fields encoded for each execution. The constant bytes are held in a
+ * reference counted slice that is shared by all requests sent.
+ */
+class SearchTemplate {
+ public:
+    /**
+     * @brief Validate the arguments against the schema: the anns field must be a vector field, output fields must
+     * exist. Target vectors and guarantee timestamp of the arguments are ignored.
+     */
+    static Status
+    Create(const SearchArguments& arguments, const CollectionSchema& schema,
+           std::shared_ptr<const SearchTemplate>& search_template);
+
+    const std::string&
+    CollectionName() const {
+        return collection_name_;
+    }
+
+    /**
+     * @brief Serialize a request of the target vectors, the vectors must match type and dimension of the anns field.
+     */
+    Status
+    Serialize(const Field& target_vectors, uint64_t guarantee_timestamp, ::grpc::ByteBuffer& buffer) const;
+
+    /**
+     * @brief Size of the serialized constant part.
+     */
+    size_t
+    ConstantSize() const {
+        return constant_.size();
+    }
+
+ private:
+    std::string collection_name_;
+    DataType vector_type_ = DataType::FLOAT_VECTOR;
+    uint32_t dimension_ = 0;
+    ::grpc::Slice constant_;
+};
+
+}  // namespace milvus
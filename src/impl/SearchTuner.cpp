@@ -0,0 +1,206 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SearchTuner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+#include <utility>
+
+#include "IdChunks.h"
+
+namespace milvus {
+
+namespace {
+
+template <typename VectorData>
+void
+AppendRows(const VectorData& vectors, std::vector<const void*>& rows, uint32_t& dimension) {
+    dimension = vectors.Dimension();
+    for (size_t i = 0; i < vectors.Count(); ++i) {
+        rows.push_back(vectors.Row(i));
+    }
+}
+
+template <typename VectorData>
+Status
+AppendData(VectorData& vectors, const VectorData& more) {
+    if (vectors.Dimension() != more.Dimension()) {
+        return Status(StatusCode::InvalidAgument, "Dimension of field '" + more.Name() + "' is mismatched!");
+    }
+    vectors.Data().insert(vectors.Data().end(), more.Data().begin(), more.Data().end());
+    return Status::OK();
+}
+
+template <typename VectorData>
+void
+AppendSingles(const VectorData& vectors, std::vector<FieldDataPtr>& singles) {
+    using T = typename VectorData::ElementType;
+    for (size_t i = 0; i < vectors.Count(); ++i) {
+        const T* row = vectors.Row(i);
+        singles.push_back(std::make_shared<VectorData>(vectors.Name(), vectors.Dimension(),
+                                                       std::vector<T>(row, row + vectors.RowWidth())));
+    }
+}
+
+template <typename T>
+double
+CountFound(const std::vector<T>& base_ids, const std::vector<size_t>& truth, const std::vector<T>& result_ids) {
+    std::unordered_set<T> found(result_ids.begin(), result_ids.end());
+    size_t hits = 0;
+    for (auto index : truth) {
+        if (index < base_ids.size() && found.count(base_ids[index]) > 0) {
+            ++hits;
+        }
+    }
+    return static_cast<double>(hits);
+}
+
+}  // namespace
+
+Status
+DefaultTuneCandidates(const std::string& param_name, int64_t topk, std::vector<int64_t>& candidates) {
+    candidates.clear();
+    if (param_name == "nprobe") {
+        for (int64_t value = 1; value <= 2048; value *= 2) {
+            candidates.push_back(value);
+        }
+    } else if (param_name == "ef") {
+        // ef below topk is rejected by the server
+        candidates.push_back(topk);
+        for (int64_t value = 16; value <= 4096; value *= 2) {
+            if (value > topk) {
+                candidates.push_back(value);
+            }
+        }
+    } else if (param_name == "search_k") {
+        for (int64_t factor = 8; factor <= 8192; factor *= 2) {
+            candidates.push_back(topk * factor);
+        }
+    } else {
+        return Status(StatusCode::NotSupported, "No default candidates of parameter '" + param_name + "'!");
+    }
+    return Status::OK();
+}
+
+Status
+VectorRows(const Field& vectors, std::vector<const void*>& rows, uint32_t& dimension) {
+    rows.clear();
+    if (vectors.Type() == DataType::FLOAT_VECTOR) {
+        AppendRows(static_cast<const FloatVecFieldData&>(vectors), rows, dimension);
+    } else if (vectors.Type() == DataType::BINARY_VECTOR) {
+        AppendRows(static_cast<const BinaryVecFieldData&>(vectors), rows, dimension);
+    } else {
+        return Status(StatusCode::InvalidAgument, "Field '" + vectors.Name() + "' is not a vector field!");
+    }
+    return Status::OK();
+}
+
+Status
+AppendVectors(Field& vectors, const Field& more) {
+    if (vectors.Type() != more.Type()) {
+        return Status(StatusCode::InvalidAgument, "Type of field '" + more.Name() + "' is mismatched!");
+    }
+    if (vectors.Type() == DataType::FLOAT_VECTOR) {
+        return AppendData(static_cast<FloatVecFieldData&>(vectors), static_cast<const FloatVecFieldData&>(more));
+    }
+    if (vectors.Type() == DataType::BINARY_VECTOR) {
+        return AppendData(static_cast<BinaryVecFieldData&>(vectors), static_cast<const BinaryVecFieldData&>(more));
+    }
+    return Status(StatusCode::InvalidAgument, "Field '" + vectors.Name() + "' is not a vector field!");
+}
+
+Status
+SplitVectors(const Field& vectors, std::vector<FieldDataPtr>& singles) {
+    singles.clear();
+    if (vectors.Type() == DataType::FLOAT_VECTOR) {
+        AppendSingles(static_cast<const FloatVecFieldData&>(vectors), singles);
+    } else if (vectors.Type() == DataType::BINARY_VECTOR) {
+        AppendSingles(static_cast<const BinaryVecFieldData&>(vectors), singles);
+    } else {
+        return Status(StatusCode::InvalidAgument, "Field '" + vectors.Name() + "' is not a vector field!");
+    }
+    return Status::OK();
+}
+
+void
+ComputeGroundTruth(const std::vector<const void*>& base, const std::vector<const void*>& targets, size_t dimension,
+                   const DistanceMetric& metric, int64_t topk, std::vector<std::vector<size_t>>& truth) {
+    const size_t k = std::min(base.size(), static_cast<size_t>(std::max<int64_t>(topk, 0)));
+    truth.assign(targets.size(), std::vector<size_t>());
+
+    std::vector<std::pair<float, size_t>> distances(base.size());
+    auto closer = [&metric](const std::pair<float, size_t>& lhs, const std::pair<float, size_t>& rhs) {
+        if (lhs.first != rhs.first) {
+            return metric.Closer(lhs.first, rhs.first);
+        }
+        return lhs.second < rhs.second;
+    };
+    for (size_t t = 0; t < targets.size(); ++t) {
+        for (size_t i = 0; i < base.size(); ++i) {
+            distances[i] = std::make_pair(metric.Distance(targets[t], base[i], dimension), i);
+        }
+        std::partial_sort(distances.begin(), distances.begin() + k, distances.end(), closer);
+        auto& neighbors = truth[t];
+        neighbors.reserve(k);
+        for (size_t i = 0; i < k; ++i) {
+            neighbors.push_back(distances[i].second);
+        }
+    }
+}
+
+Status
+SampleExpression(const std::string& filter, const std::string& primary_name, DataType primary_type, const IDArray& ids,
+                 std::string& expression) {
+    if (ids.IsIntegerID() != (primary_type == DataType::INT64)) {
+        return Status(StatusCode::InvalidAgument, "Base ids don't match the type of the primary key!");
+    }
+    std::string id_expression;
+    if (ids.IsIntegerID()) {
+        FormatIdChunk(ids.IntIDArray(), primary_name, 0, ids.IntIDArray().size(), id_expression);
+    } else {
+        FormatIdChunk(ids.StrIDArray(), primary_name, 0, ids.StrIDArray().size(), id_expression);
+    }
+    expression = filter.empty() ? id_expression : "(" + filter + ") && (" + id_expression + ")";
+    return Status::OK();
+}
+
+double
+RecallAtK(const IDArray& base_ids, const std::vector<size_t>& truth, const SingleResult& result) {
+    if (truth.empty()) {
+        return 1.0;
+    }
+    double hits = 0;
+    if (base_ids.IsIntegerID()) {
+        hits = CountFound(base_ids.IntIDArray(), truth, result.Ids().IntIDArray());
+    } else {
+        hits = CountFound(base_ids.StrIDArray(), truth, result.Ids().StrIDArray());
+    }
+    return hits / static_cast<double>(truth.size());
+}
+
+double
+Percentile(const std::vector<double>& sorted, double percentile) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sorted.size())));
+    rank = std::min(std::max<size_t>(rank, 1), sorted.size());
+    return sorted[rank - 1];
+}
+
+}  // namespace milvus
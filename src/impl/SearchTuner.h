@@ -0,0 +1,93 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Distance.h"
+#include "Status.h"
+#include "types/FieldData.h"
+#include "types/SearchResults.h"
+
+namespace milvus {
+
+/**
+ * @brief Max number of entities fetched by each query when TuneSearchParams() reads the base vectors.
+ */
+constexpr size_t kTuneFetchRows = 8192;
+
+/**
+ * @brief Power of two sweep of a known search parameter: "nprobe", "ef" (never below topk) or "search_k".
+ */
+Status
+DefaultTuneCandidates(const std::string& param_name, int64_t topk, std::vector<int64_t>& candidates);
+
+/**
+ * @brief Row pointers and dimension of a FloatVecFieldData or a BinaryVecFieldData.
+ */
+Status
+VectorRows(const Field& vectors, std::vector<const void*>& rows, uint32_t& dimension);
+
+/**
+ * @brief Append the rows of more to vectors, both must be FloatVecFieldData or BinaryVecFieldData of one dimension.
+ */
+Status
+AppendVectors(Field& vectors, const Field& more);
+
+/**
+ * @brief Split a vector column into one single-row column for each vector.
+ */
+Status
+SplitVectors(const Field& vectors, std::vector<FieldDataPtr>& singles);
+
+/**
+ * @brief Exact top-k of each target by brute force.
+ *
+ * @param [in] base rows of the base vectors
+ * @param [in] targets rows of the target vectors
+ * @param [in] dimension dimension of the vector field
+ * @param [in] metric exact distance function
+ * @param [in] topk number of neighbors of each target
+ * @param [out] truth indexes into base of the neighbors of each target, closest first
+ */
+void
+ComputeGroundTruth(const std::vector<const void*>& base, const std::vector<const void*>& targets, size_t dimension,
+                   const DistanceMetric& metric, int64_t topk, std::vector<std::vector<size_t>>& truth);
+
+/**
+ * @brief Expression of a tuned search limited to the base sample: "(filter) && (primary_name in [ids])". Without it
+ * the search returns entities outside of the sample and the measured recall is lower than the true recall.
+ */
+Status
+SampleExpression(const std::string& filter, const std::string& primary_name, DataType primary_type, const IDArray& ids,
+                 std::string& expression);
+
+/**
+ * @brief Fraction of the true neighbors, rows of base_ids indexed by truth, found in result.
+ */
+double
+RecallAtK(const IDArray& base_ids, const std::vector<size_t>& truth, const SingleResult& result);
+
+/**
+ * @brief Nearest-rank percentile of sorted values, percentile in (0, 100].
+ */
+double
+Percentile(const std::vector<double>& sorted, double percentile);
+
+}  // namespace milvus
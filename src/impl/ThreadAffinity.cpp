@@ -0,0 +1,122 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ThreadAffinity.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace milvus {
+
+namespace {
+
+bool
+ParseCpu(const std::string& text, int& cpu) {
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+        return false;
+    }
+    cpu = std::atoi(text.c_str());
+    return true;
+}
+
+}  // namespace
+
+bool
+ParseCpuList(const std::string& text, std::vector<int>& cpus) {
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        item.erase(std::remove_if(item.begin(), item.end(), ::isspace), item.end());
+        if (item.empty()) {
+            continue;
+        }
+        auto dash = item.find('-');
+        int first = 0;
+        int last = 0;
+        if (dash == std::string::npos) {
+            if (!ParseCpu(item, first)) {
+                return false;
+            }
+            last = first;
+        } else if (!ParseCpu(item.substr(0, dash), first) || !ParseCpu(item.substr(dash + 1), last) || last < first) {
+            return false;
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return true;
+}
+
+Status
+ResolveCpuAffinity(const ThreadingConfig& config, std::vector<int>& cpus) {
+    cpus = config.CpuAffinity();
+    if (config.NumaNode() >= 0) {
+        std::string path = "/sys/devices/system/node/node" + std::to_string(config.NumaNode()) + "/cpulist";
+        std::ifstream file(path);
+        std::string text;
+        if (!file || !std::getline(file, text)) {
+            return Status(StatusCode::InvalidAgument, "NUMA node " + std::to_string(config.NumaNode()) + " not found");
+        }
+        if (!ParseCpuList(text, cpus)) {
+            return Status(StatusCode::UnknownError, "Failed to parse " + path);
+        }
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+#ifdef __linux__
+    if (!cpus.empty() && (cpus.front() < 0 || cpus.back() >= CPU_SETSIZE)) {
+        return Status(StatusCode::InvalidAgument, "Invalid cpu in cpu affinity");
+    }
+#else
+    if (!cpus.empty()) {
+        return Status(StatusCode::NotSupported, "Cpu affinity is only supported on Linux");
+    }
+#endif
+    return Status::OK();
+}
+
+Status
+PinCurrentThread(const std::vector<int>& cpus) {
+    if (cpus.empty()) {
+        return Status::OK();
+    }
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (auto cpu : cpus) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    int error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (error != 0) {
+        return Status(StatusCode::UnknownError, "Failed to set thread affinity, error " + std::to_string(error));
+    }
+    return Status::OK();
+#else
+    return Status(StatusCode::NotSupported, "Cpu affinity is only supported on Linux");
+#endif
+}
+
+}  // namespace milvus
@@ -0,0 +1,46 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Status.h"
+#include "types/ThreadingConfig.h"
+
+namespace milvus {
+
+/**
+ * @brief Parse a cpu list in the format of Linux sysfs, for example "0-3,8,10-11". Return false if malformed.
+ */
+bool
+ParseCpuList(const std::string& text, std::vector<int>& cpus);
+
+/**
+ * @brief CPUs to pin the SDK threads to: CpuAffinity() plus the CPUs of NumaNode(), sorted and without duplicates.
+ * Empty means no pinning.
+ */
+Status
+ResolveCpuAffinity(const ThreadingConfig& config, std::vector<int>& cpus);
+
+/**
+ * @brief Pin the calling thread to cpus, does nothing if cpus is empty.
+ */
+Status
+PinCurrentThread(const std::vector<int>& cpus);
+
+}  // namespace milvus
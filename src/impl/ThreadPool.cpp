@@ -0,0 +1,83 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ThreadPool.h"
+
+#include <iostream>
+
+#include "ThreadAffinity.h"
+
+namespace milvus {
+
+ThreadPool::ThreadPool(size_t thread_num) : ThreadPool(thread_num, std::vector<int>()) {
+}
+
+ThreadPool::ThreadPool(size_t thread_num, const std::vector<int>& cpus) {
+    if (thread_num == 0) {
+        thread_num = 1;
+    }
+    workers_.reserve(thread_num);
+    for (size_t i = 0; i < thread_num; ++i) {
+        workers_.emplace_back(&ThreadPool::WorkerLoop, this, cpus);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+std::future<void>
+ThreadPool::Enqueue(std::function<void()> task) {
+    auto packaged = std::make_shared<std::packaged_task<void()>>(std::move(task));
+    auto future = packaged->get_future();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.emplace([packaged]() { (*packaged)(); });
+    }
+    condition_.notify_one();
+    return future;
+}
+
+void
+ThreadPool::WorkerLoop(const std::vector<int>& cpus) {
+    auto status = PinCurrentThread(cpus);
+    if (!status.IsOk()) {
+        std::cerr << status.Message() << std::endl;
+    }
+
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+            if (stop_ && tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+        task();
+    }
+}
+
+}  // namespace milvus
@@ -0,0 +1,68 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Fixed size thread pool for cpu-bound work inside the sdk.
+ */
+class ThreadPool {
+ public:
+    explicit ThreadPool(size_t thread_num);
+
+    /**
+     * @brief Pool whose threads are pinned to cpus, no pinning if cpus is empty.
+     */
+    ThreadPool(size_t thread_num, const std::vector<int>& cpus);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool&
+    operator=(const ThreadPool&) = delete;
+
+    size_t
+    Size() const {
+        return workers_.size();
+    }
+
+    std::future<void>
+    Enqueue(std::function<void()> task);
+
+ private:
+    void
+    WorkerLoop(const std::vector<int>& cpus);
+
+ private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+};
+
+}  // namespace milvus
@@ -0,0 +1,308 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "TypeUtils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+namespace milvus {
+
+namespace {
+
+template <typename Column, typename Repeated>
+void
+CopyColumn(const Field& field, Repeated* repeated) {
+    const auto& data = static_cast<const Column&>(field).Data();
+    repeated->Reserve(static_cast<int>(data.size()));
+    for (const auto& element : data) {
+        repeated->Add(element);
+    }
+}
+
+template <typename Column, typename Repeated>
+FieldDataPtr
+CreateColumn(const std::string& name, const Repeated& repeated) {
+    using T = typename Column::ElementType;
+    return std::make_shared<Column>(name, std::vector<T>(repeated.begin(), repeated.end()));
+}
+
+template <typename Column>
+FieldDataPtr
+GatherScalars(const Field& field, const std::vector<uint32_t>& rows) {
+    const auto& data = static_cast<const Column&>(field).Data();
+    std::vector<typename Column::ElementType> gathered;
+    gathered.reserve(rows.size());
+    for (auto row : rows) {
+        gathered.push_back(data[row]);
+    }
+    return std::make_shared<Column>(field.Name(), std::move(gathered));
+}
+
+template <typename Column>
+FieldDataPtr
+GatherVectors(const Field& field, const std::vector<uint32_t>& rows) {
+    const auto& column = static_cast<const Column&>(field);
+    const size_t width = column.RowWidth();
+    std::vector<typename Column::ElementType> gathered(rows.size() * width);
+    auto dest = gathered.begin();
+    for (auto row : rows) {
+        dest = std::copy(column.Row(row), column.Row(row) + width, dest);
+    }
+    return std::make_shared<Column>(field.Name(), column.Dimension(), std::move(gathered));
+}
+
+template <typename Column>
+void
+AppendColumn(const Field& source, Field& target) {
+    const auto& data = static_cast<const Column&>(source).Data();
+    auto& dest = static_cast<Column&>(target).Data();
+    dest.insert(dest.end(), data.begin(), data.end());
+}
+
+template <typename Column>
+bool
+AppendVectors(const Field& source, Field& target) {
+    if (static_cast<const Column&>(source).Dimension() != static_cast<const Column&>(target).Dimension()) {
+        return false;
+    }
+    AppendColumn<Column>(source, target);
+    return true;
+}
+
+template <typename Column>
+uint64_t
+ColumnBytes(const Field& field) {
+    return static_cast<const Column&>(field).Data().size() * sizeof(typename Column::ElementType);
+}
+
+}  // namespace
+
+void
+ConvertFieldData(const Field& field, proto::schema::FieldData& proto_field) {
+    proto_field.set_field_name(field.Name());
+    proto_field.set_type(static_cast<proto::schema::DataType>(field.Type()));
+
+    switch (field.Type()) {
+        case DataType::BOOL:
+            CopyColumn<BoolFieldData>(field, proto_field.mutable_scalars()->mutable_bool_data()->mutable_data());
+            break;
+        case DataType::INT8:
+            CopyColumn<Int8FieldData>(field, proto_field.mutable_scalars()->mutable_int_data()->mutable_data());
+            break;
+        case DataType::INT16:
+            CopyColumn<Int16FieldData>(field, proto_field.mutable_scalars()->mutable_int_data()->mutable_data());
+            break;
+        case DataType::INT32: {
+            const auto& data = static_cast<const Int32FieldData&>(field).Data();
+            proto_field.mutable_scalars()->mutable_int_data()->mutable_data()->Add(data.begin(), data.end());
+            break;
+        }
+        case DataType::INT64: {
+            const auto& data = static_cast<const Int64FieldData&>(field).Data();
+            proto_field.mutable_scalars()->mutable_long_data()->mutable_data()->Add(data.begin(), data.end());
+            break;
+        }
+        case DataType::FLOAT: {
+            const auto& data = static_cast<const FloatFieldData&>(field).Data();
+            proto_field.mutable_scalars()->mutable_float_data()->mutable_data()->Add(data.begin(), data.end());
+            break;
+        }
+        case DataType::DOUBLE: {
+            const auto& data = static_cast<const DoubleFieldData&>(field).Data();
+            proto_field.mutable_scalars()->mutable_double_data()->mutable_data()->Add(data.begin(), data.end());
+            break;
+        }
+        case DataType::STRING: {
+            const auto& data = static_cast<const StringFieldData&>(field).Data();
+            proto_field.mutable_scalars()->mutable_string_data()->mutable_data()->Add(data.begin(), data.end());
+            break;
+        }
+        case DataType::BINARY_VECTOR: {
+            const auto& column = static_cast<const BinaryVecFieldData&>(field);
+            auto vectors = proto_field.mutable_vectors();
+            vectors->set_dim(column.Dimension());
+            vectors->set_binary_vector(reinterpret_cast<const char*>(column.Data().data()), column.Data().size());
+            break;
+        }
+        case DataType::FLOAT_VECTOR: {
+            const auto& column = static_cast<const FloatVecFieldData&>(field);
+            auto vectors = proto_field.mutable_vectors();
+            vectors->set_dim(column.Dimension());
+            vectors->mutable_float_vector()->mutable_data()->Add(column.Data().begin(), column.Data().end());
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+FieldDataPtr
+CreateFieldData(const proto::schema::FieldData& proto_field) {
+    const auto& name = proto_field.field_name();
+    const auto& scalars = proto_field.scalars();
+    switch (static_cast<DataType>(proto_field.type())) {
+        case DataType::BOOL:
+            return CreateColumn<BoolFieldData>(name, scalars.bool_data().data());
+        case DataType::INT8:
+            return CreateColumn<Int8FieldData>(name, scalars.int_data().data());
+        case DataType::INT16:
+            return CreateColumn<Int16FieldData>(name, scalars.int_data().data());
+        case DataType::INT32:
+            return CreateColumn<Int32FieldData>(name, scalars.int_data().data());
+        case DataType::INT64:
+            return CreateColumn<Int64FieldData>(name, scalars.long_data().data());
+        case DataType::FLOAT:
+            return CreateColumn<FloatFieldData>(name, scalars.float_data().data());
+        case DataType::DOUBLE:
+            return CreateColumn<DoubleFieldData>(name, scalars.double_data().data());
+        case DataType::STRING:
+            return CreateColumn<StringFieldData>(name, scalars.string_data().data());
+        case DataType::BINARY_VECTOR: {
+            const auto& vectors = proto_field.vectors();
+            const auto& bytes = vectors.binary_vector();
+            return std::make_shared<BinaryVecFieldData>(name, static_cast<uint32_t>(vectors.dim()),
+                                                        std::vector<uint8_t>(bytes.begin(), bytes.end()));
+        }
+        case DataType::FLOAT_VECTOR: {
+            const auto& vectors = proto_field.vectors();
+            const auto& data = vectors.float_vector().data();
+            return std::make_shared<FloatVecFieldData>(name, static_cast<uint32_t>(vectors.dim()),
+                                                       std::vector<float>(data.begin(), data.end()));
+        }
+        default:
+            return nullptr;
+    }
+}
+
+FieldDataPtr
+GatherRows(const Field& field, const std::vector<uint32_t>& rows) {
+    switch (field.Type()) {
+        case DataType::BOOL:
+            return GatherScalars<BoolFieldData>(field, rows);
+        case DataType::INT8:
+            return GatherScalars<Int8FieldData>(field, rows);
+        case DataType::INT16:
+            return GatherScalars<Int16FieldData>(field, rows);
+        case DataType::INT32:
+            return GatherScalars<Int32FieldData>(field, rows);
+        case DataType::INT64:
+            return GatherScalars<Int64FieldData>(field, rows);
+        case DataType::FLOAT:
+            return GatherScalars<FloatFieldData>(field, rows);
+        case DataType::DOUBLE:
+            return GatherScalars<DoubleFieldData>(field, rows);
+        case DataType::STRING:
+            return GatherScalars<StringFieldData>(field, rows);
+        case DataType::BINARY_VECTOR:
+            return GatherVectors<BinaryVecFieldData>(field, rows);
+        case DataType::FLOAT_VECTOR:
+            return GatherVectors<FloatVecFieldData>(field, rows);
+        default:
+            return nullptr;
+    }
+}
+
+bool
+AppendRows(const Field& source, Field& target) {
+    if (source.Type() != target.Type()) {
+        return false;
+    }
+    switch (source.Type()) {
+        case DataType::BOOL:
+            AppendColumn<BoolFieldData>(source, target);
+            return true;
+        case DataType::INT8:
+            AppendColumn<Int8FieldData>(source, target);
+            return true;
+        case DataType::INT16:
+            AppendColumn<Int16FieldData>(source, target);
+            return true;
+        case DataType::INT32:
+            AppendColumn<Int32FieldData>(source, target);
+            return true;
+        case DataType::INT64:
+            AppendColumn<Int64FieldData>(source, target);
+            return true;
+        case DataType::FLOAT:
+            AppendColumn<FloatFieldData>(source, target);
+            return true;
+        case DataType::DOUBLE:
+            AppendColumn<DoubleFieldData>(source, target);
+            return true;
+        case DataType::STRING:
+            AppendColumn<StringFieldData>(source, target);
+            return true;
+        case DataType::BINARY_VECTOR:
+            return AppendVectors<BinaryVecFieldData>(source, target);
+        case DataType::FLOAT_VECTOR:
+            return AppendVectors<FloatVecFieldData>(source, target);
+        default:
+            return false;
+    }
+}
+
+uint64_t
+FieldDataBytes(const Field& field) {
+    switch (field.Type()) {
+        case DataType::BOOL:
+            return field.Count();
+        case DataType::INT8:
+            return ColumnBytes<Int8FieldData>(field);
+        case DataType::INT16:
+            return ColumnBytes<Int16FieldData>(field);
+        case DataType::INT32:
+            return ColumnBytes<Int32FieldData>(field);
+        case DataType::INT64:
+            return ColumnBytes<Int64FieldData>(field);
+        case DataType::FLOAT:
+            return ColumnBytes<FloatFieldData>(field);
+        case DataType::DOUBLE:
+            return ColumnBytes<DoubleFieldData>(field);
+        case DataType::STRING: {
+            uint64_t bytes = 0;
+            for (const auto& value : static_cast<const StringFieldData&>(field).Data()) {
+                bytes += value.size();
+            }
+            return bytes;
+        }
+        case DataType::BINARY_VECTOR:
+            return ColumnBytes<BinaryVecFieldData>(field);
+        case DataType::FLOAT_VECTOR:
+            return ColumnBytes<FloatVecFieldData>(field);
+        default:
+            return 0;
+    }
+}
+
+CollectionSchema
+ConvertCollectionSchema(const proto::schema::CollectionSchema& proto_schema, int32_t shard_num) {
+    CollectionSchema schema(proto_schema.name(), proto_schema.description(), shard_num);
+    for (const auto& proto_field : proto_schema.fields()) {
+        FieldSchema field(proto_field.name(), static_cast<DataType>(proto_field.data_type()),
+                          proto_field.description(), proto_field.is_primary_key(), proto_field.autoid());
+        for (const auto& pair : proto_field.type_params()) {
+            if (pair.key() == "dim") {
+                field.SetDimension(static_cast<uint32_t>(std::strtoul(pair.value().c_str(), nullptr, 10)));
+            }
+        }
+        schema.AddField(field);
+    }
+    return schema;
+}
+
+}  // namespace milvus
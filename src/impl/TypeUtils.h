@@ -0,0 +1,63 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "schema.pb.h"
+#include "types/CollectionSchema.h"
+#include "types/FieldData.h"
+
+namespace milvus {
+
+/**
+ * @brief Convert a column into rpc field data, each column is copied in bulk without per-row type dispatch.
+ */
+void
+ConvertFieldData(const Field& field, proto::schema::FieldData& proto_field);
+
+/**
+ * @brief Convert rpc field data into a column, return nullptr for unsupported data type.
+ */
+FieldDataPtr
+CreateFieldData(const proto::schema::FieldData& proto_field);
+
+/**
+ * @brief Create a column with the given rows of field, in the order of rows.
+ */
+FieldDataPtr
+GatherRows(const Field& field, const std::vector<uint32_t>& rows);
+
+/**
+ * @brief Append all rows of source to target, return false if their types or dimensions differ.
+ */
+bool
+AppendRows(const Field& source, Field& target);
+
+/**
+ * @brief Approximate payload bytes of a column: element bytes of scalars and vectors, characters of strings.
+ */
+uint64_t
+FieldDataBytes(const Field& field);
+
+/**
+ * @brief Convert rpc collection schema returned by DescribeCollection().
+ */
+CollectionSchema
+ConvertCollectionSchema(const proto::schema::CollectionSchema& proto_schema, int32_t shard_num);
+
+}  // namespace milvus
@@ -0,0 +1,280 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Validator.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <set>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace milvus {
+
+namespace {
+
+/**
+ * @brief Bit i of the result is set if element i of data[0, 8) is NaN or infinite, x - x is NaN exactly for them.
+ */
+uint32_t
+NonFiniteMask8(const float* data) {
+#if defined(__AVX__)
+    __m256 x = _mm256_loadu_ps(data);
+    __m256 d = _mm256_sub_ps(x, x);
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(d, d, _CMP_UNORD_Q)));
+#elif defined(__SSE2__)
+    __m128 lo = _mm_loadu_ps(data);
+    __m128 hi = _mm_loadu_ps(data + 4);
+    lo = _mm_sub_ps(lo, lo);
+    hi = _mm_sub_ps(hi, hi);
+    return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpunord_ps(lo, lo))) |
+           (static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpunord_ps(hi, hi))) << 4);
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 8; ++i) {
+        mask |= std::isfinite(data[i]) ? 0 : (1u << i);
+    }
+    return mask;
+#endif
+}
+
+uint32_t
+NonFiniteMask8(const double* data) {
+#if defined(__AVX__)
+    __m256d lo = _mm256_loadu_pd(data);
+    __m256d hi = _mm256_loadu_pd(data + 4);
+    lo = _mm256_sub_pd(lo, lo);
+    hi = _mm256_sub_pd(hi, hi);
+    return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(lo, lo, _CMP_UNORD_Q))) |
+           (static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(hi, hi, _CMP_UNORD_Q))) << 4);
+#elif defined(__SSE2__)
+    uint32_t mask = 0;
+    for (int i = 0; i < 8; i += 2) {
+        __m128d x = _mm_loadu_pd(data + i);
+        x = _mm_sub_pd(x, x);
+        mask |= static_cast<uint32_t>(_mm_movemask_pd(_mm_cmpunord_pd(x, x))) << i;
+    }
+    return mask;
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < 8; ++i) {
+        mask |= std::isfinite(data[i]) ? 0 : (1u << i);
+    }
+    return mask;
+#endif
+}
+
+template <typename T>
+void
+FindNonFiniteRowsImpl(const T* data, size_t row_count, size_t width, std::vector<uint32_t>& rows) {
+    const size_t count = row_count * width;
+    auto append = [&rows, width](size_t position) {
+        auto row = static_cast<uint32_t>(position / width);
+        if (rows.empty() || rows.back() != row) {
+            rows.push_back(row);
+        }
+    };
+    // bad values are rare, the whole block is skipped by one test of the mask
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint32_t mask = NonFiniteMask8(data + i);
+        while (mask != 0) {
+            append(i + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+    for (; i < count; ++i) {
+        if (!std::isfinite(data[i])) {
+            append(i);
+        }
+    }
+}
+
+uint32_t
+FieldDimension(const FieldSchema& field) {
+    auto iter = field.TypeParams().find("dim");
+    if (iter == field.TypeParams().end()) {
+        return 0;
+    }
+    return static_cast<uint32_t>(std::strtoul(iter->second.c_str(), nullptr, 10));
+}
+
+/**
+ * @brief Check the dimension and the values of a vector column, the rows of the issues are indexes of vectors.
+ */
+void
+ValidateVectors(const FieldSchema& field, const Field& vectors, ValidationResults& results) {
+    const uint32_t expected = FieldDimension(field);
+    if (vectors.Type() == DataType::FLOAT_VECTOR) {
+        const auto& column = static_cast<const FloatVecFieldData&>(vectors);
+        if (column.Dimension() != expected && expected != 0) {
+            results.AddIssue(ValidationIssue(field.Name(), "Dimension doesn't match the schema", {}));
+            return;
+        }
+        if (column.RowWidth() == 0 || column.Data().size() % column.RowWidth() != 0) {
+            results.AddIssue(ValidationIssue(field.Name(), "Data size is not a multiple of the dimension", {}));
+            return;
+        }
+        std::vector<uint32_t> rows;
+        FindNonFiniteRows(column.Data().data(), column.Count(), column.RowWidth(), rows);
+        if (!rows.empty()) {
+            results.AddIssue(ValidationIssue(field.Name(), "Vector has NaN or infinite elements", std::move(rows)));
+        }
+    } else if (vectors.Type() == DataType::BINARY_VECTOR) {
+        const auto& column = static_cast<const BinaryVecFieldData&>(vectors);
+        if (column.Dimension() != expected && expected != 0) {
+            results.AddIssue(ValidationIssue(field.Name(), "Dimension doesn't match the schema", {}));
+            return;
+        }
+        if (column.Dimension() % 8 != 0 || column.RowWidth() == 0 ||
+            column.Data().size() % column.RowWidth() != 0) {
+            results.AddIssue(ValidationIssue(field.Name(), "Data size is not a multiple of the dimension", {}));
+        }
+    }
+}
+
+void
+ValidateScalars(const FieldSchema& field, const Field& column, ValidationResults& results) {
+    std::vector<uint32_t> rows;
+    if (column.Type() == DataType::FLOAT) {
+        const auto& data = static_cast<const FloatFieldData&>(column).Data();
+        FindNonFiniteRows(data.data(), data.size(), 1, rows);
+    } else if (column.Type() == DataType::DOUBLE) {
+        const auto& data = static_cast<const DoubleFieldData&>(column).Data();
+        FindNonFiniteRows(data.data(), data.size(), 1, rows);
+    }
+    if (!rows.empty()) {
+        results.AddIssue(ValidationIssue(field.Name(), "Value is NaN or infinite", std::move(rows)));
+    }
+}
+
+Status
+FirstIssue(const ValidationResults& results) {
+    if (results.IsValid()) {
+        return Status::OK();
+    }
+    const auto& issue = results.Issues().front();
+    std::string reason = issue.Reason();
+    if (!issue.FieldName().empty()) {
+        reason = "Field '" + issue.FieldName() + "': " + reason;
+    }
+    if (!issue.Rows().empty()) {
+        reason += ", first row " + std::to_string(issue.Rows().front()) + " of " +
+                  std::to_string(issue.Rows().size()) + " rows";
+    }
+    return Status(StatusCode::InvalidAgument, reason);
+}
+
+}  // namespace
+
+void
+FindNonFiniteRows(const float* data, size_t row_count, size_t width, std::vector<uint32_t>& rows) {
+    FindNonFiniteRowsImpl(data, row_count, width, rows);
+}
+
+void
+FindNonFiniteRows(const double* data, size_t row_count, size_t width, std::vector<uint32_t>& rows) {
+    FindNonFiniteRowsImpl(data, row_count, width, rows);
+}
+
+Status
+ValidateInsertFields(const CollectionSchema& schema, const std::vector<FieldDataPtr>& fields,
+                     ValidationResults& results) {
+    results = ValidationResults();
+    if (fields.empty()) {
+        results.AddIssue(ValidationIssue("", "Fields cannot be empty", {}));
+        return FirstIssue(results);
+    }
+
+    const size_t row_count = fields.front()->Count();
+    std::set<std::string> names;
+    for (const auto& column : fields) {
+        if (column == nullptr) {
+            results.AddIssue(ValidationIssue("", "Field is null", {}));
+            continue;
+        }
+        const auto& name = column->Name();
+        if (!names.insert(name).second) {
+            results.AddIssue(ValidationIssue(name, "Field is provided more than once", {}));
+            continue;
+        }
+        const FieldSchema* field = nullptr;
+        for (const auto& candidate : schema.Fields()) {
+            if (candidate.Name() == name) {
+                field = &candidate;
+            }
+        }
+        if (field == nullptr) {
+            results.AddIssue(ValidationIssue(name, "Field is not defined in the schema", {}));
+            continue;
+        }
+        if (field->IsPrimaryKey() && field->AutoID()) {
+            results.AddIssue(ValidationIssue(name, "Primary key is generated by the server with auto_id", {}));
+            continue;
+        }
+        if (column->Type() != field->FieldDataType()) {
+            results.AddIssue(ValidationIssue(name, "Data type doesn't match the schema", {}));
+            continue;
+        }
+        if (column->Count() != row_count) {
+            results.AddIssue(ValidationIssue(name, "Row count is mismatched", {}));
+            continue;
+        }
+        ValidateVectors(*field, *column, results);
+        ValidateScalars(*field, *column, results);
+    }
+
+    for (const auto& field : schema.Fields()) {
+        if (!(field.IsPrimaryKey() && field.AutoID()) && names.find(field.Name()) == names.end()) {
+            results.AddIssue(ValidationIssue(field.Name(), "Field is missing", {}));
+        }
+    }
+    return FirstIssue(results);
+}
+
+Status
+ValidateSearchArguments(const CollectionSchema& schema, const SearchArguments& arguments,
+                        ValidationResults& results) {
+    results = ValidationResults();
+    if (arguments.TopK() <= 0) {
+        results.AddIssue(ValidationIssue("", "TopK must be larger than zero", {}));
+    }
+
+    const FieldSchema* anns_field = nullptr;
+    for (const auto& field : schema.Fields()) {
+        if (field.Name() == arguments.AnnsField()) {
+            anns_field = &field;
+        }
+    }
+    if (anns_field == nullptr) {
+        results.AddIssue(ValidationIssue(arguments.AnnsField(), "Field is not defined in the schema", {}));
+        return FirstIssue(results);
+    }
+
+    const auto& targets = arguments.TargetVectors();
+    if (targets == nullptr || targets->Count() == 0) {
+        results.AddIssue(ValidationIssue(anns_field->Name(), "Target vectors are empty", {}));
+    } else if (targets->Type() != anns_field->FieldDataType()) {
+        results.AddIssue(ValidationIssue(anns_field->Name(), "Target vectors type doesn't match the schema", {}));
+    } else {
+        ValidateVectors(*anns_field, *targets, results);
+    }
+    return FirstIssue(results);
+}
+
+}  // namespace milvus
@@ -0,0 +1,62 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Status.h"
+#include "types/CollectionSchema.h"
+#include "types/FieldData.h"
+#include "types/SearchArguments.h"
+#include "types/ValidationResults.h"
+
+namespace milvus {
+
+/**
+ * @brief Append the rows holding a NaN or an infinity to rows, row i occupies elements [i * width, (i + 1) * width).
+ * The scan takes 8 floats (AVX) or 4 floats (SSE) at a time.
+ */
+void
+FindNonFiniteRows(const float* data, size_t row_count, size_t width, std::vector<uint32_t>& rows);
+
+void
+FindNonFiniteRows(const double* data, size_t row_count, size_t width, std::vector<uint32_t>& rows);
+
+/**
+ * @brief Check insert columns against the collection schema: every field without auto_id is present and no
+ * unknown, repeated or auto_id field is, column types, row counts and vector dimensions match, and float values
+ * are finite.
+ *
+ * @return Status InvalidAgument with the first issue if any issue is found
+ */
+Status
+ValidateInsertFields(const CollectionSchema& schema, const std::vector<FieldDataPtr>& fields,
+                     ValidationResults& results);
+
+/**
+ * @brief Check the anns field, topk and the target vectors of a search against the collection schema, the rows of
+ * the issues are indexes of target vectors.
+ *
+ * @return Status InvalidAgument with the first issue if any issue is found
+ */
+Status
+ValidateSearchArguments(const CollectionSchema& schema, const SearchArguments& arguments,
+                        ValidationResults& results);
+
+}  // namespace milvus
@@ -0,0 +1,98 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "WireReader.h"
+
+#include <cstring>
+
+namespace milvus {
+
+bool
+WireReader::ReadTag(uint32_t& field_number, uint32_t& wire_type) {
+    uint64_t tag = 0;
+    if (!ReadVarint(tag)) {
+        return false;
+    }
+    field_number = static_cast<uint32_t>(tag >> 3);
+    wire_type = static_cast<uint32_t>(tag & 0x7);
+    return field_number != 0;
+}
+
+bool
+WireReader::ReadVarint(uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && cursor_ < end_; shift += 7) {
+        const uint8_t byte = *cursor_++;
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+WireReader::ReadFixed32(uint32_t& value) {
+    if (end_ - cursor_ < 4) {
+        return false;
+    }
+    std::memcpy(&value, cursor_, 4);
+    cursor_ += 4;
+    return true;
+}
+
+bool
+WireReader::ReadBytes(const uint8_t*& data, size_t& size) {
+    uint64_t length = 0;
+    if (!ReadVarint(length) || length > static_cast<uint64_t>(end_ - cursor_)) {
+        return false;
+    }
+    data = cursor_;
+    size = static_cast<size_t>(length);
+    cursor_ += size;
+    return true;
+}
+
+bool
+WireReader::Skip(uint32_t wire_type) {
+    switch (wire_type) {
+        case VARINT: {
+            uint64_t value = 0;
+            return ReadVarint(value);
+        }
+        case FIXED64:
+            if (end_ - cursor_ < 8) {
+                return false;
+            }
+            cursor_ += 8;
+            return true;
+        case LENGTH_DELIMITED: {
+            const uint8_t* data = nullptr;
+            size_t size = 0;
+            return ReadBytes(data, size);
+        }
+        case FIXED32:
+            if (end_ - cursor_ < 4) {
+                return false;
+            }
+            cursor_ += 4;
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace milvus
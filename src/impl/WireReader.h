@@ -0,0 +1,71 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace milvus {
+
+/**
+ * @brief Minimal reader of the protobuf wire format, used to walk a serialized response without building messages.
+ * All methods return false on malformed input.
+ */
+class WireReader {
+ public:
+    enum WireType {
+        VARINT = 0,
+        FIXED64 = 1,
+        LENGTH_DELIMITED = 2,
+        FIXED32 = 5,
+    };
+
+    WireReader(const uint8_t* data, size_t size) : cursor_(data), end_(data + size) {
+    }
+
+    bool
+    AtEnd() const {
+        return cursor_ >= end_;
+    }
+
+    /**
+     * @brief Read the tag of the next field.
+     */
+    bool
+    ReadTag(uint32_t& field_number, uint32_t& wire_type);
+
+    bool
+    ReadVarint(uint64_t& value);
+
+    bool
+    ReadFixed32(uint32_t& value);
+
+    /**
+     * @brief Read a length delimited field as a view into the input.
+     */
+    bool
+    ReadBytes(const uint8_t*& data, size_t& size);
+
+    bool
+    Skip(uint32_t wire_type);
+
+ private:
+    const uint8_t* cursor_;
+    const uint8_t* end_;
+};
+
+}  // namespace milvus
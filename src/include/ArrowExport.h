@@ -0,0 +1,99 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "Status.h"
+#include "types/QueryResults.h"
+#include "types/SearchResults.h"
+
+// Structs of the Arrow C Data Interface, https://arrow.apache.org/docs/format/CDataInterface.html
+// They are an ABI defined by Arrow and guarded by the same macro, so this header can be included with arrow/c/abi.h.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+struct ArrowSchema {
+    // Array type description
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+}  // extern "C"
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+namespace milvus {
+
+/**
+ * @brief Export query results as an Arrow struct array, one child for each output field.
+ *
+ * Numeric, float vector and binary vector columns are not copied: the Arrow buffers point into the result columns,
+ * which are kept alive until the consumer calls the release callbacks, so the results can be destroyed right after
+ * the export. Bool and string columns are converted into the Arrow bitmap and offsets layouts. Float vectors are
+ * exported as fixed_size_list<float>, binary vectors as fixed_size_binary of dimension/8 bytes.
+ *
+ * @param [in] results query results
+ * @param [out] schema Arrow type of the struct array, release it by schema->release(schema)
+ * @param [out] array Arrow struct array, release it by array->release(array)
+ * @return Status operation successfully or not, nothing needs to be released on failure
+ */
+Status
+ExportArrow(const QueryResults& results, ArrowSchema* schema, ArrowArray* array);
+
+/**
+ * @brief Export the hits of one target vector as an Arrow struct array: an "id" column (int64 or utf8), a "score"
+ * column (float32) and one child for each output field. The output fields are exported as by the QueryResults
+ * overload, the ids and scores are copied.
+ */
+Status
+ExportArrow(const SingleResult& result, ArrowSchema* schema, ArrowArray* array);
+
+}  // namespace milvus
@@ -0,0 +1,64 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "Status.h"
+
+namespace milvus {
+
+/**
+ * @brief Executor on which the callbacks of async operations run, adapt it to the event loop of the application
+ * (an asio io_context, a folly executor, ...), so the callbacks never block SDK threads.
+ */
+class Executor {
+ public:
+    virtual ~Executor() = default;
+
+    /**
+     * @brief Schedule the task, it may be called from any thread.
+     */
+    virtual void
+    Post(std::function<void()> task) = 0;
+};
+
+/**
+ * @brief Handle of an async operation in flight.
+ */
+class AsyncHandle {
+ public:
+    virtual ~AsyncHandle() = default;
+
+    /**
+     * @brief Cancel the operation, its callback receives StatusCode::Cancelled unless it has already completed.
+     * Cancelling a completed operation does nothing.
+     */
+    virtual void
+    Cancel() = 0;
+};
+
+/**
+ * @brief Completion callback of an async operation, result is valid only if status is ok.
+ *
+ * Compilers with coroutines can co_await the operations instead, see AsyncAwait.h.
+ */
+template <typename T>
+using AsyncCallback = std::function<void(const Status& status, T&& result)>;
+
+}  // namespace milvus
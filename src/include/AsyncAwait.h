@@ -0,0 +1,193 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "MilvusClient.h"
+
+#if defined(__cpp_impl_coroutine)
+
+#include <atomic>
+#include <coroutine>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace milvus {
+
+/**
+ * @brief Status and result of an awaited operation, result is valid only if status is ok.
+ */
+template <typename T>
+struct AsyncResult {
+    Status status_;
+    T result_;
+};
+
+/**
+ * @brief Awaitable of an async operation, create it by AwaitDescribeCollection(), AwaitSearch() or AwaitQuery().
+ *
+ * This header is compiled by the application, the awaitables are only declared when its compiler supports
+ * coroutines. The coroutine is resumed by Executor::Post(), or on the completion thread if the executor is null,
+ * and never before the async call has returned, so the arguments of the call may live in the coroutine frame:
+ * @code
+ *   // Task is the coroutine type of the application
+ *   Task Search(milvus::MilvusClient& client, std::shared_ptr<milvus::Executor> executor) {
+ *       milvus::SearchArguments arguments;
+ *       ...
+ *       auto search = milvus::AwaitSearch(client, arguments, executor);
+ *       auto handle = search.Handle();  // handle->Cancel() ends the await with StatusCode::Cancelled
+ *       auto result = co_await search;
+ *       if (result.status_.IsOk()) {
+ *           ...
+ *       }
+ *   }
+ * @endcode
+ */
+template <typename T>
+class AsyncAwaitable {
+ public:
+    using Start = std::function<std::shared_ptr<AsyncHandle>(AsyncCallback<T>)>;
+
+    AsyncAwaitable(std::shared_ptr<Executor> executor, Start start)
+        : executor_(std::move(executor)), start_(std::move(start)), state_(std::make_shared<State>()) {
+    }
+
+    /**
+     * @brief Handle to cancel the await, it is valid before and during the await.
+     */
+    std::shared_ptr<AsyncHandle>
+    Handle() const {
+        return state_;
+    }
+
+    bool
+    await_ready() const noexcept {
+        return false;
+    }
+
+    bool
+    await_suspend(std::coroutine_handle<> coroutine) {
+        auto state = state_;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex_);
+            if (state->cancelled_) {
+                state->status_ = Status(StatusCode::Cancelled, "Operation is cancelled!");
+                return false;
+            }
+        }
+
+        // the callback runs on the completion thread, or inline if the call fails at once
+        auto executor = executor_;
+        auto handle = start_([state, executor, coroutine](const Status& status, T&& result) {
+            state->status_ = status;
+            state->result_ = std::move(result);
+            // the last of the callback and await_suspend() resumes, so the call has always returned by then
+            if (state->ready_.exchange(true)) {
+                if (executor != nullptr) {
+                    executor->Post([coroutine] { coroutine.resume(); });
+                } else {
+                    coroutine.resume();
+                }
+            }
+        });
+
+        bool cancelled = false;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex_);
+            state->handle_ = handle;
+            cancelled = state->cancelled_;
+        }
+        if (cancelled && handle != nullptr) {
+            handle->Cancel();
+        }
+        return !state->ready_.exchange(true);
+    }
+
+    AsyncResult<T>
+    await_resume() {
+        return AsyncResult<T>{state_->status_, std::move(state_->result_)};
+    }
+
+ private:
+    struct State : public AsyncHandle {
+        void
+        Cancel() override {
+            std::shared_ptr<AsyncHandle> handle;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                cancelled_ = true;
+                handle = handle_;
+            }
+            if (handle != nullptr) {
+                handle->Cancel();
+            }
+        }
+
+        std::mutex mutex_;
+        std::shared_ptr<AsyncHandle> handle_;
+        bool cancelled_ = false;
+        std::atomic<bool> ready_{false};
+        Status status_;
+        T result_;
+    };
+
+ private:
+    std::shared_ptr<Executor> executor_;
+    Start start_;
+    std::shared_ptr<State> state_;
+};
+
+/**
+ * @brief Awaitable of MilvusClient::DescribeCollectionAsync(), the client must outlive the await.
+ */
+inline AsyncAwaitable<CollectionDesc>
+AwaitDescribeCollection(MilvusClient& client, const std::string& collection_name,
+                        std::shared_ptr<Executor> executor) {
+    // the callback runs on the completion thread and resumes the coroutine through the executor of the awaitable
+    auto start = [&client, collection_name](AsyncCallback<CollectionDesc> callback) {
+        return client.DescribeCollectionAsync(collection_name, nullptr, std::move(callback));
+    };
+    return AsyncAwaitable<CollectionDesc>(std::move(executor), std::move(start));
+}
+
+/**
+ * @brief Awaitable of MilvusClient::SearchAsync(), the arguments are copied, the client must outlive the await.
+ */
+inline AsyncAwaitable<SearchResults>
+AwaitSearch(MilvusClient& client, const SearchArguments& arguments, std::shared_ptr<Executor> executor) {
+    auto start = [&client, arguments](AsyncCallback<SearchResults> callback) {
+        return client.SearchAsync(arguments, nullptr, std::move(callback));
+    };
+    return AsyncAwaitable<SearchResults>(std::move(executor), std::move(start));
+}
+
+/**
+ * @brief Awaitable of MilvusClient::QueryAsync(), the arguments are copied, the client must outlive the await.
+ */
+inline AsyncAwaitable<QueryResults>
+AwaitQuery(MilvusClient& client, const QueryArguments& arguments, std::shared_ptr<Executor> executor) {
+    auto start = [&client, arguments](AsyncCallback<QueryResults> callback) {
+        return client.QueryAsync(arguments, nullptr, std::move(callback));
+    };
+    return AsyncAwaitable<QueryResults>(std::move(executor), std::move(start));
+}
+
+}  // namespace milvus
+
+#endif  // __cpp_impl_coroutine
@@ -0,0 +1,212 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Status.h"
+
+namespace milvus {
+
+class CaptureLogReader;
+
+/**
+ * @brief A request read from a capture log, see CaptureConfig.
+ */
+class CaptureRecord {
+ public:
+    /**
+     * @brief Full gRPC method name, for example "/milvus.proto.milvus.MilvusService/Search".
+     */
+    const std::string&
+    Method() const {
+        return method_;
+    }
+
+    void
+    SetMethod(const std::string& method) {
+        method_ = method;
+    }
+
+    /**
+     * @brief Time the request was sent, in microseconds since the capture started.
+     */
+    uint64_t
+    OffsetUs() const {
+        return offset_us_;
+    }
+
+    void
+    SetOffsetUs(uint64_t offset_us) {
+        offset_us_ = offset_us;
+    }
+
+    /**
+     * @brief Serialized request message.
+     */
+    const std::string&
+    Payload() const {
+        return payload_;
+    }
+
+    std::string&
+    Payload() {
+        return payload_;
+    }
+
+ private:
+    std::string method_;
+    uint64_t offset_us_ = 0;
+    std::string payload_;
+};
+
+/**
+ * @brief Sequential reader of a capture log. A log appended by several sessions reads as one timeline, each
+ * session starting where the previous one ended.
+ */
+class CaptureReader {
+ public:
+    CaptureReader();
+
+    ~CaptureReader();
+
+    Status
+    Open(const std::string& path);
+
+    /**
+     * @brief Read the next record, end is set at the end of the log.
+     */
+    Status
+    Next(CaptureRecord& record, bool& end);
+
+ private:
+    std::unique_ptr<CaptureLogReader> reader_;
+};
+
+/**
+ * @brief Options of ReplayCapture().
+ */
+class ReplayOptions {
+ public:
+    /**
+     * @brief Replay speed relative to the original timing, 2 replays twice as fast. 0 sends the requests as fast
+     * as the threads allow. Default is 1.
+     */
+    double
+    Speed() const {
+        return speed_;
+    }
+
+    void
+    SetSpeed(double speed) {
+        speed_ = speed;
+    }
+
+    /**
+     * @brief Requests in flight at most. Default is 16.
+     */
+    uint32_t
+    Threads() const {
+        return threads_;
+    }
+
+    void
+    SetThreads(uint32_t threads) {
+        threads_ = threads;
+    }
+
+ private:
+    double speed_ = 1.0;
+    uint32_t threads_ = 16;
+};
+
+/**
+ * @brief Result of ReplayCapture().
+ */
+class ReplayStats {
+ public:
+    uint64_t
+    Requests() const {
+        return requests_;
+    }
+
+    void
+    SetRequests(uint64_t requests) {
+        requests_ = requests;
+    }
+
+    /**
+     * @brief Requests failed at the gRPC level, errors reported in the responses are not inspected.
+     */
+    uint64_t
+    Failures() const {
+        return failures_;
+    }
+
+    void
+    SetFailures(uint64_t failures) {
+        failures_ = failures;
+    }
+
+    uint64_t
+    ElapsedMs() const {
+        return elapsed_ms_;
+    }
+
+    void
+    SetElapsedMs(uint64_t elapsed_ms) {
+        elapsed_ms_ = elapsed_ms;
+    }
+
+    /**
+     * @brief Largest delay of a request behind its scheduled time, large values mean the target or the replay
+     * threads couldn't keep up with the original timing.
+     */
+    uint64_t
+    MaxLagMs() const {
+        return max_lag_ms_;
+    }
+
+    void
+    SetMaxLagMs(uint64_t max_lag_ms) {
+        max_lag_ms_ = max_lag_ms;
+    }
+
+ private:
+    uint64_t requests_ = 0;
+    uint64_t failures_ = 0;
+    uint64_t elapsed_ms_ = 0;
+    uint64_t max_lag_ms_ = 0;
+};
+
+/**
+ * @brief Re-issue the requests of a capture log against a server, at the original timing scaled by the speed.
+ *
+ * @param [in] path capture log
+ * @param [in] host host of the target server
+ * @param [in] port port of the target server
+ * @param [in] options replay speed and concurrency
+ * @param [out] stats request and failure counts, timing
+ * @return Status operation successfully or not, failed requests don't fail the replay
+ */
+Status
+ReplayCapture(const std::string& path, const std::string& host, uint16_t port, const ReplayOptions& options,
+              ReplayStats& stats);
+
+}  // namespace milvus
@@ -0,0 +1,344 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Status.h"
+#include "types/CollectionSchema.h"
+
+namespace milvus {
+
+class ExprNode;
+class CompiledExpr;
+
+/**
+ * @brief A literal value or a value bound to a placeholder of an expression.
+ */
+class ExprValue {
+ public:
+    enum class Kind {
+        NONE = 0,
+        BOOL,
+        INT64,
+        DOUBLE,
+        STRING,
+        INT64_LIST,
+        DOUBLE_LIST,
+        STRING_LIST,
+    };
+
+    ExprValue() = default;
+
+    explicit ExprValue(bool value) : kind_(Kind::BOOL), bool_value_(value) {
+    }
+
+    explicit ExprValue(int64_t value) : kind_(Kind::INT64), int_value_(value) {
+    }
+
+    explicit ExprValue(double value) : kind_(Kind::DOUBLE), double_value_(value) {
+    }
+
+    explicit ExprValue(const std::string& value) : kind_(Kind::STRING), string_value_(value) {
+    }
+
+    explicit ExprValue(const std::vector<int64_t>& values) : kind_(Kind::INT64_LIST), int_values_(values) {
+    }
+
+    explicit ExprValue(const std::vector<double>& values) : kind_(Kind::DOUBLE_LIST), double_values_(values) {
+    }
+
+    explicit ExprValue(const std::vector<std::string>& values) : kind_(Kind::STRING_LIST), string_values_(values) {
+    }
+
+    Kind
+    ValueKind() const {
+        return kind_;
+    }
+
+    bool
+    BoolValue() const {
+        return bool_value_;
+    }
+
+    int64_t
+    Int64Value() const {
+        return int_value_;
+    }
+
+    double
+    DoubleValue() const {
+        return double_value_;
+    }
+
+    const std::string&
+    StringValue() const {
+        return string_value_;
+    }
+
+    const std::vector<int64_t>&
+    Int64Values() const {
+        return int_values_;
+    }
+
+    const std::vector<double>&
+    DoubleValues() const {
+        return double_values_;
+    }
+
+    const std::vector<std::string>&
+    StringValues() const {
+        return string_values_;
+    }
+
+ private:
+    Kind kind_ = Kind::NONE;
+    bool bool_value_ = false;
+    int64_t int_value_ = 0;
+    double double_value_ = 0;
+    std::string string_value_;
+    std::vector<int64_t> int_values_;
+    std::vector<double> double_values_;
+    std::vector<std::string> string_values_;
+};
+
+/**
+ * @brief Filter expression builder for Query(), Delete() and search.
+ *
+ * Build the expression tree once, prepare it against the collection schema, then bind new placeholder values for
+ * each call:
+ * @code
+ *   auto expr = milvus::Expr::Field("age") >= milvus::Expr::Param("min_age") &&
+ *               milvus::Expr::Field("id").In(milvus::Expr::Param("ids"));
+ *
+ *   milvus::PreparedExpr prepared;
+ *   client->PrepareExpression("users", expr, prepared);
+ *
+ *   auto params = prepared.NewParams();
+ *   std::string expression;  // reused between calls
+ *   params.Set("min_age", int64_t{18});
+ *   params.Set("ids", std::vector<int64_t>{1, 2, 3});
+ *   prepared.Bind(params, expression);  // "(age >= 18) && (id in [1,2,3])"
+ * @endcode
+ */
+class Expr {
+ public:
+    /**
+     * @brief Reference to a scalar field of the collection.
+     */
+    static Expr
+    Field(const std::string& name);
+
+    /**
+     * @brief Named placeholder, its value type is inferred from the field it is compared with.
+     */
+    static Expr
+    Param(const std::string& name);
+
+    static Expr
+    Value(bool value);
+
+    static Expr
+    Value(int value);
+
+    static Expr
+    Value(int64_t value);
+
+    static Expr
+    Value(double value);
+
+    static Expr
+    Value(const std::string& value);
+
+    static Expr
+    Value(const char* value);
+
+    /**
+     * @brief "field in [...]" with a literal list.
+     */
+    Expr
+    In(const std::vector<int64_t>& values) const;
+
+    Expr
+    In(const std::vector<std::string>& values) const;
+
+    /**
+     * @brief "field in [...]" with a list bound later to a placeholder.
+     */
+    Expr
+    In(const Expr& param) const;
+
+    /**
+     * @brief "lower < field < upper", bounds are literals or placeholders.
+     */
+    Expr
+    Between(const Expr& lower, const Expr& upper, bool inclusive = false) const;
+
+    friend Expr
+    operator==(const Expr& lhs, const Expr& rhs);
+    friend Expr
+    operator!=(const Expr& lhs, const Expr& rhs);
+    friend Expr
+    operator<(const Expr& lhs, const Expr& rhs);
+    friend Expr
+    operator<=(const Expr& lhs, const Expr& rhs);
+    friend Expr
+    operator>(const Expr& lhs, const Expr& rhs);
+    friend Expr
+    operator>=(const Expr& lhs, const Expr& rhs);
+    friend Expr
+    operator&&(const Expr& lhs, const Expr& rhs);
+    friend Expr
+    operator||(const Expr& lhs, const Expr& rhs);
+    friend Expr
+    operator!(const Expr& expr);
+
+    const std::shared_ptr<const ExprNode>&
+    Node() const {
+        return node_;
+    }
+
+ private:
+    explicit Expr(std::shared_ptr<const ExprNode>&& node) : node_(std::move(node)) {
+    }
+
+ private:
+    std::shared_ptr<const ExprNode> node_;
+};
+
+/**
+ * @brief Values of the placeholders of a prepared expression, create it by PreparedExpr::NewParams().
+ */
+class ExprParams {
+ public:
+    ExprParams() = default;
+
+    /**
+     * @brief Set the value of a placeholder, return false if the placeholder doesn't exist.
+     */
+    bool
+    Set(const std::string& name, const ExprValue& value);
+
+    bool
+    Set(const std::string& name, bool value) {
+        return Set(name, ExprValue(value));
+    }
+
+    bool
+    Set(const std::string& name, int value) {
+        return Set(name, ExprValue(static_cast<int64_t>(value)));
+    }
+
+    bool
+    Set(const std::string& name, int64_t value) {
+        return Set(name, ExprValue(value));
+    }
+
+    bool
+    Set(const std::string& name, double value) {
+        return Set(name, ExprValue(value));
+    }
+
+    bool
+    Set(const std::string& name, const std::string& value) {
+        return Set(name, ExprValue(value));
+    }
+
+    /**
+     * @brief Without this overload a string literal would be converted to bool.
+     */
+    bool
+    Set(const std::string& name, const char* value) {
+        return Set(name, ExprValue(std::string(value)));
+    }
+
+    bool
+    Set(const std::string& name, const std::vector<int64_t>& values) {
+        return Set(name, ExprValue(values));
+    }
+
+    bool
+    Set(const std::string& name, const std::vector<double>& values) {
+        return Set(name, ExprValue(values));
+    }
+
+    bool
+    Set(const std::string& name, const std::vector<std::string>& values) {
+        return Set(name, ExprValue(values));
+    }
+
+    const std::vector<ExprValue>&
+    Values() const {
+        return values_;
+    }
+
+ private:
+    friend class PreparedExpr;
+
+    explicit ExprParams(const std::shared_ptr<const CompiledExpr>& compiled);
+
+ private:
+    std::shared_ptr<const CompiledExpr> compiled_;
+    std::vector<ExprValue> values_;
+};
+
+/**
+ * @brief Expression validated against a collection schema and compiled into text segments and placeholder slots.
+ * It is immutable after Prepare() and can be shared by threads.
+ */
+class PreparedExpr {
+ public:
+    /**
+     * @brief Validate the expression against the schema: fields must exist and must be scalar, literals and
+     * placeholders must match the field types.
+     *
+     * @param [in] expr expression to be prepared
+     * @param [in] schema collection schema
+     * @param [out] prepared compiled expression
+     * @return Status operation successfully or not
+     */
+    static Status
+    Prepare(const Expr& expr, const CollectionSchema& schema, PreparedExpr& prepared);
+
+    /**
+     * @brief Names of the placeholders, in order of first appearance.
+     */
+    const std::vector<std::string>&
+    ParamNames() const;
+
+    ExprParams
+    NewParams() const;
+
+    /**
+     * @brief Render the expression with the placeholder values into expression. The string is cleared first and
+     * its capacity is reused, so passing the same string for every call avoids allocations.
+     *
+     * @param [in] params values of all placeholders
+     * @param [out] expression rendered expression
+     * @return Status operation successfully or not
+     */
+    Status
+    Bind(const ExprParams& params, std::string& expression) const;
+
+ private:
+    std::shared_ptr<const CompiledExpr> compiled_;
+};
+
+}  // namespace milvus
@@ -18,15 +18,40 @@
 
 #include <memory>
 
+#include "Async.h"
+#include "Capture.h"
+#include "Expr.h"
 #include "Status.h"
+#include "types/BalanceArguments.h"
+#include "types/BalanceResults.h"
 #include "types/CollectionDesc.h"
 #include "types/CollectionInfo.h"
 #include "types/CollectionSchema.h"
 #include "types/CollectionStat.h"
+#include "types/CompactionProgress.h"
+#include "types/CompactionReport.h"
 #include "types/ConnectParam.h"
+#include "types/DmlResults.h"
+#include "types/EntityCacheStat.h"
+#include "types/FieldData.h"
+#include "types/InsertOptions.h"
+#include "types/LazyResults.h"
+#include "types/MemoryBudgetStat.h"
 #include "types/PartitionInfo.h"
 #include "types/PartitionStat.h"
+#include "types/PreparedSearch.h"
+#include "types/QuerySegmentInfo.h"
+#include "types/ServerMetrics.h"
+#include "types/QueryArguments.h"
+#include "types/QueryResults.h"
+#include "types/RowLayout.h"
+#include "types/SearchArguments.h"
+#include "types/SearchResults.h"
+#include "types/SearchTuneArguments.h"
+#include "types/SearchTuneResults.h"
+#include "types/SegmentInfo.h"
 #include "types/TimeoutSetting.h"
+#include "types/ValidationResults.h"
 
 /**
  *  @brief namespace milvus
@@ -94,7 +119,8 @@ class MilvusClient {
     /**
      * Load collection data into CPU memory of query node.
      * If the timeout is specified, this api will call ShowCollections() to check collection's loading state,
-     * waiting until the collection completely loaded into query node.
+     * waiting until the collection completely loaded into query node, it returns StatusCode::Timeout if the
+     * collection is not loaded in time.
      *
      * @param [in] collection_name name of the collection
      * @param [in] timeout timeout setting for loading, set to nullptr to return instantly
@@ -227,6 +253,383 @@ class MilvusClient {
     virtual Status
     ShowPartitions(const std::string& collection_name, const std::vector<std::string>& partition_names,
                    PartitionsInfo& partitions_info) = 0;
+
+    /**
+     * Insert entities into a collection, each element of fields is a column of one field.
+     * All columns must have the same row count.
+     *
+     * @param [in] collection_name name of the collection
+     * @param [in] partition_name name of the partition, set to empty string to use the default partition
+     * @param [in] fields columns of the entities
+     * @param [out] results primary keys and timestamp of the inserted entities
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    Insert(const std::string& collection_name, const std::string& partition_name,
+           const std::vector<FieldDataPtr>& fields, DmlResults& results) = 0;
+
+    /**
+     * Insert entities into a collection with client-side shard routing and duplicate suppression.
+     * Primary key hashes are computed by the client with the same algorithm as the server and filled into the
+     * request. If GroupByShard() is set, one request is sent for each shard, and a failure of one shard doesn't
+     * roll back the shards already inserted. The shard count comes from DescribeCollection() and is cached.
+     * If Duplicates() is set, primary keys probably inserted before are reported or dropped, see
+     * ConnectParam::SetDuplicateFilter().
+     *
+     * @param [in] collection_name name of the collection
+     * @param [in] partition_name name of the partition, set to empty string to use the default partition
+     * @param [in] fields columns of the entities, must contain the primary key field
+     * @param [in] options shard routing and duplicate options
+     * @param [out] results primary keys, timestamp, row count of each shard and duplicate rows
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    Insert(const std::string& collection_name, const std::string& partition_name,
+           const std::vector<FieldDataPtr>& fields, const InsertOptions& options, DmlResults& results) = 0;
+
+    /**
+     * Insert row-oriented entities into a collection.
+     * The rows are transposed into columns in parallel, directly into the rpc request buffers.
+     *
+     * @param [in] collection_name name of the collection
+     * @param [in] partition_name name of the partition, set to empty string to use the default partition
+     * @param [in] layout memory layout of each row
+     * @param [in] rows address of the first row
+     * @param [in] row_count number of rows
+     * @param [out] results primary keys and timestamp of the inserted entities
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    InsertRows(const std::string& collection_name, const std::string& partition_name, const RowLayout& layout,
+               const void* rows, size_t row_count, DmlResults& results) = 0;
+
+    /**
+     * Delete entities by a boolean filter expression, currently the server only supports "pk in [...]".
+     *
+     * @param [in] collection_name name of the collection
+     * @param [in] partition_name name of the partition, set to empty string to delete from all partitions
+     * @param [in] expression filter expression of the entities to be deleted
+     * @param [out] results deleted count and timestamp
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    Delete(const std::string& collection_name, const std::string& partition_name, const std::string& expression,
+           DmlResults& results) = 0;
+
+    /**
+     * Delete entities by primary keys.
+     * The "pk in [...]" expressions are generated in chunks of bounded size and the chunks are sent concurrently.
+     * If some chunks fail, the first error is returned and the other chunks are still deleted.
+     *
+     * @param [in] collection_name name of the collection
+     * @param [in] partition_name name of the partition, set to empty string to delete from all partitions
+     * @param [in] ids primary keys of the entities to be deleted
+     * @param [out] results total deleted count of all chunks and the latest timestamp
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    DeleteByIds(const std::string& collection_name, const std::string& partition_name,
+                const std::vector<int64_t>& ids, DmlResults& results) = 0;
+
+    /**
+     * Delete entities by string primary keys, see DeleteByIds() of int64 primary keys.
+     */
+    virtual Status
+    DeleteByIds(const std::string& collection_name, const std::string& partition_name,
+                const std::vector<std::string>& ids, DmlResults& results) = 0;
+
+    /**
+     * Retrieve entities by a boolean filter expression.
+     *
+     * @param [in] arguments query arguments including collection name, expression and output fields
+     * @param [out] results one column for each output field
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    Query(const QueryArguments& arguments, QueryResults& results) = 0;
+
+    /**
+     * Query, the response is kept serialized and each column is decoded when first accessed.
+     */
+    virtual Status
+    Query(const QueryArguments& arguments, LazyQueryResults& results) = 0;
+
+    /**
+     * Retrieve entities by primary keys. With the entity cache enabled, see ConnectParam::SetEntityCache(), the
+     * cached entities are returned without a round trip and the others are fetched by one batched query.
+     *
+     * @param [in] collection_name name of the collection
+     * @param [in] ids primary keys of the entities
+     * @param [in] output_fields fields to be returned, the primary key is always returned
+     * @param [out] results one column for each field, rows in the order of ids, entities not found are skipped
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    QueryByIds(const std::string& collection_name, const std::vector<int64_t>& ids,
+               const std::vector<std::string>& output_fields, QueryResults& results) = 0;
+
+    /**
+     * Retrieve entities by string primary keys, see QueryByIds() of int64 primary keys.
+     */
+    virtual Status
+    QueryByIds(const std::string& collection_name, const std::vector<std::string>& ids,
+               const std::vector<std::string>& output_fields, QueryResults& results) = 0;
+
+    /**
+     * Search the nearest neighbors of the target vectors.
+     *
+     * @param [in] arguments search arguments including collection name, anns field, target vectors and topk
+     * @param [out] results one SingleResult for each target vector
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    Search(const SearchArguments& arguments, SearchResults& results) = 0;
+
+    /**
+     * Search, the response is kept serialized and output fields are decoded only when accessed.
+     * Prefer it when many output fields are requested but few are read.
+     */
+    virtual Status
+    Search(const SearchArguments& arguments, LazySearchResults& results) = 0;
+
+    /**
+     * Validate search arguments against the collection schema once and serialize the constant part of the request,
+     * for an endpoint that repeats the same search with different vectors.
+     * The target vectors and the guarantee timestamp of the arguments are ignored.
+     *
+     * @param [in] arguments search arguments
+     * @param [out] prepared prepared search, pass it to Search() for each execution
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    PrepareSearch(const SearchArguments& arguments, PreparedSearch& prepared) = 0;
+
+    /**
+     * Execute a prepared search.
+     *
+     * @param [in] prepared search prepared by PrepareSearch()
+     * @param [in] target_vectors a FloatVecFieldData or BinaryVecFieldData matching the anns field
+     * @param [in] guarantee_timestamp guarantee timestamp of this execution, 0 to use the server default
+     * @param [out] results one SingleResult for each target vector
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    Search(const PreparedSearch& prepared, const Field& target_vectors, uint64_t guarantee_timestamp,
+           SearchResults& results) = 0;
+
+    /**
+     * Execute a prepared search with lazily decoded results.
+     */
+    virtual Status
+    Search(const PreparedSearch& prepared, const Field& target_vectors, uint64_t guarantee_timestamp,
+           LazySearchResults& results) = 0;
+
+    /**
+     * Check insert columns against the cached collection schema without sending them: missing, unknown or repeated
+     * fields, a provided auto_id primary key, data types, row counts, vector dimensions and NaN or infinite float
+     * values. Run it before shipping a large batch, or set InsertOptions::SetValidate() to run it inside Insert().
+     *
+     * @param [in] collection_name name of the collection
+     * @param [in] fields columns to be inserted
+     * @param [out] results issues found with the offending rows
+     * @return Status InvalidAgument describing the first issue if the batch is invalid
+     */
+    virtual Status
+    ValidateInsert(const std::string& collection_name, const std::vector<FieldDataPtr>& fields,
+                   ValidationResults& results) = 0;
+
+    /**
+     * Check the anns field, topk and target vectors of a search against the cached collection schema without
+     * sending it, the rows of the issues are indexes of target vectors.
+     *
+     * @param [in] arguments search arguments
+     * @param [out] results issues found with the offending target vectors
+     * @return Status InvalidAgument describing the first issue if the search is invalid
+     */
+    virtual Status
+    ValidateSearch(const SearchArguments& arguments, ValidationResults& results) = 0;
+
+    /**
+     * Find the cheapest value of an index search parameter meeting a target recall. The ground truth of the sample
+     * queries is computed by brute force on the client, then the search is run with each candidate value from the
+     * cheapest one, one query per request, measuring recall@k and latency. Without a base sample, the vectors are
+     * fetched from the collection in chunks, up to SearchTuneArguments::MaxBaseVectors() of them.
+     *
+     * @param [in] arguments the search to be tuned with its sample queries, the parameter and its candidates
+     * @param [out] results recall and latency of each value tried and the recommended value
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    TuneSearchParams(const SearchTuneArguments& arguments, SearchTuneResults& results) = 0;
+
+    /**
+     * Validate a filter expression against the collection schema and compile it for repeated binding.
+     * The schema is taken from the client-side collection cache.
+     *
+     * @param [in] collection_name name of the collection
+     * @param [in] expr expression built by Expr
+     * @param [out] prepared compiled expression, call Bind() to render it with placeholder values
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    PrepareExpression(const std::string& collection_name, const Expr& expr, PreparedExpr& prepared) = 0;
+
+    /**
+     * Get the memory usage of in-flight requests and responses, see ConnectParam::SetMemoryBudget().
+     *
+     * @param [out] stat budget, current and peak usage, wait and reject counts
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetMemoryBudgetStat(MemoryBudgetStat& stat) = 0;
+
+    /**
+     * Get the usage and hit rate of the entity cache, see ConnectParam::SetEntityCache().
+     *
+     * @param [out] stat capacity, used bytes, entity count, hit, miss and reject counts
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetEntityCacheStat(EntityCacheStat& stat) = 0;
+
+    /**
+     * Save the duplicate filters of all collections into the directory set by
+     * ConnectParam::SetDuplicateFilter(), nothing is saved if the directory is empty. Disconnect() saves them too.
+     *
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    SaveDuplicateFilters() = 0;
+
+    /**
+     * Get the persistent segments of a collection.
+     *
+     * @param [in] collection_name name of the collection
+     * @param [out] segments id, row count and state of each segment
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetPersistentSegmentInfo(const std::string& collection_name, std::vector<SegmentInfo>& segments) = 0;
+
+    /**
+     * Start a compaction of a collection, it merges small segments and removes deleted rows.
+     *
+     * @param [in] collection_name name of the collection
+     * @param [out] compaction_id id to follow the compaction by GetCompactionState()
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    ManualCompaction(const std::string& collection_name, int64_t& compaction_id) = 0;
+
+    /**
+     * Get the state of a compaction.
+     *
+     * @param [in] compaction_id id returned by ManualCompaction()
+     * @param [out] progress state and plan counts of the compaction
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetCompactionState(int64_t compaction_id, CompactionProgress& progress) = 0;
+
+    /**
+     * Get the compactions started by the compaction scheduler, see ConnectParam::SetCompaction().
+     *
+     * @param [out] reports running compactions and the last completed ones with their segments before and after
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetCompactionReports(std::vector<CompactionReport>& reports) = 0;
+
+    /**
+     * Get the segments of a collection loaded by the query nodes.
+     *
+     * @param [in] collection_name name of the collection
+     * @param [out] segments query node, memory size and row count of each loaded segment
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetQuerySegmentInfo(const std::string& collection_name, std::vector<QuerySegmentInfo>& segments) = 0;
+
+    /**
+     * Move sealed segments from a query node to other query nodes.
+     *
+     * @param [in] src_node query node which holds the segments
+     * @param [in] dst_nodes query nodes to load the segments
+     * @param [in] segment_ids sealed segments to be moved
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    LoadBalance(int64_t src_node, const std::vector<int64_t>& dst_nodes, const std::vector<int64_t>& segment_ids) = 0;
+
+    /**
+     * Detect the skew of the query node loads and propose or execute the segment moves to reduce it.
+     *
+     * @param [in] arguments collections to inspect, skew threshold and move cap, see BalanceArguments
+     * @param [out] results node loads, skew before and after the moves, and the moves
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    BalanceQueryNodes(const BalanceArguments& arguments, BalanceResults& results) = 0;
+
+    /**
+     * Send a raw metrics request to the server.
+     *
+     * @param [in] request jsonic request, for example {"metric_type":"system_info"}
+     * @param [out] response jsonic response of the server
+     * @param [out] component_name component which answered the request
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetMetrics(const std::string& request, std::string& response, std::string& component_name) = 0;
+
+    /**
+     * Get the system topology: cpu, memory, disk and task queues of each server component.
+     *
+     * @param [out] metrics metrics of each node
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetServerMetrics(ServerMetrics& metrics) = 0;
+
+    /**
+     * Get the snapshots taken by the background metrics poller, see ConnectParam::SetMetrics().
+     *
+     * @param [out] history snapshots oldest first, empty if the poller is disabled
+     * @return Status operation successfully or not
+     */
+    virtual Status
+    GetMetricsHistory(std::vector<ServerMetrics>& history) = 0;
+
+    /**
+     * Describe a collection without blocking the calling thread.
+     *
+     * The async operations are driven by one completion thread of the connection, a workflow of many steps needs
+     * no thread of its own. Admission control and the memory budget don't wait for async operations, a request
+     * that can't be admitted at once fails with StatusCode::Throttled.
+     *
+     * @param [in] collection_name name of the collection
+     * @param [in] executor the callback is posted to it, if null the callback runs on the completion thread and
+     * must not block
+     * @param [in] callback receives the status and the collection description, it is always invoked once
+     * @return AsyncHandle to cancel the operation, null if it failed before the request was sent
+     */
+    virtual std::shared_ptr<AsyncHandle>
+    DescribeCollectionAsync(const std::string& collection_name, const std::shared_ptr<Executor>& executor,
+                            AsyncCallback<CollectionDesc> callback) = 0;
+
+    /**
+     * Search without blocking the calling thread, see DescribeCollectionAsync().
+     */
+    virtual std::shared_ptr<AsyncHandle>
+    SearchAsync(const SearchArguments& arguments, const std::shared_ptr<Executor>& executor,
+                AsyncCallback<SearchResults> callback) = 0;
+
+    /**
+     * Query without blocking the calling thread, see DescribeCollectionAsync().
+     */
+    virtual std::shared_ptr<AsyncHandle>
+    QueryAsync(const QueryArguments& arguments, const std::shared_ptr<Executor>& executor,
+               AsyncCallback<QueryResults> callback) = 0;
 };
 
 }  // namespace milvus
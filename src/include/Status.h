@@ -38,6 +38,9 @@ enum class StatusCode {
     InvalidAgument = 1000,
     RPCFailed,
     ServerFailed,
+    Throttled,
+    Cancelled,
+    Timeout,
 };
 
 /**
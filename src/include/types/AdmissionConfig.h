@@ -0,0 +1,202 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace milvus {
+
+/**
+ * @brief Class of a request for client-side admission control, in priority order: when requests are queued, a
+ * SEARCH request is dispatched before QUERY, QUERY before INSERT, INSERT before ADMIN.
+ */
+enum class RequestClass {
+    SEARCH = 0,
+    QUERY,
+    INSERT,
+    ADMIN,
+};
+
+/**
+ * @brief Limits of one request class.
+ */
+class ClassLimit {
+ public:
+    ClassLimit() = default;
+
+    ClassLimit(uint32_t max_concurrency, double rate, double burst)
+        : max_concurrency_(max_concurrency), rate_(rate), burst_(burst) {
+    }
+
+    /**
+     * @brief Max in-flight requests of this class, 0 means no limit.
+     */
+    uint32_t
+    MaxConcurrency() const {
+        return max_concurrency_;
+    }
+
+    void
+    SetMaxConcurrency(uint32_t max_concurrency) {
+        max_concurrency_ = max_concurrency;
+    }
+
+    /**
+     * @brief Token bucket refill rate in requests per second, 0 means no rate limit.
+     */
+    double
+    Rate() const {
+        return rate_;
+    }
+
+    void
+    SetRate(double rate) {
+        rate_ = rate;
+    }
+
+    /**
+     * @brief Token bucket capacity, at least 1.
+     */
+    double
+    Burst() const {
+        return burst_;
+    }
+
+    void
+    SetBurst(double burst) {
+        burst_ = burst;
+    }
+
+ private:
+    uint32_t max_concurrency_ = 0;
+    double rate_ = 0;
+    double burst_ = 1;
+};
+
+/**
+ * @brief Client-side admission control, disabled by default.
+ *
+ * Requests wait in per-class queues until the class limits and the overall concurrency limit allow them. With
+ * adaptive concurrency, the overall limit grows by about one per round trip while requests succeed within the latency
+ * threshold, and is multiplied by the backoff ratio when a request fails or is slower than the threshold.
+ */
+class AdmissionConfig {
+ public:
+    static constexpr int CLASS_COUNT = 4;
+
+    bool
+    Enabled() const {
+        return enabled_;
+    }
+
+    void
+    SetEnabled(bool enabled) {
+        enabled_ = enabled;
+    }
+
+    const ClassLimit&
+    Limit(RequestClass request_class) const {
+        return limits_[static_cast<int>(request_class)];
+    }
+
+    void
+    SetLimit(RequestClass request_class, const ClassLimit& limit) {
+        limits_[static_cast<int>(request_class)] = limit;
+    }
+
+    /**
+     * @brief Max in-flight requests of all classes, 0 means no limit. It is the upper bound and the initial value of
+     * the adaptive limit.
+     */
+    uint32_t
+    MaxConcurrency() const {
+        return max_concurrency_;
+    }
+
+    void
+    SetMaxConcurrency(uint32_t max_concurrency) {
+        max_concurrency_ = max_concurrency;
+    }
+
+    /**
+     * @brief Max time a request waits in queue, the request fails with StatusCode::Throttled after that.
+     */
+    uint32_t
+    QueueTimeoutMs() const {
+        return queue_timeout_ms_;
+    }
+
+    void
+    SetQueueTimeoutMs(uint32_t queue_timeout_ms) {
+        queue_timeout_ms_ = queue_timeout_ms;
+    }
+
+    /**
+     * @brief Adjust the overall limit by AIMD on observed latency, requires MaxConcurrency() > 0.
+     */
+    bool
+    AdaptiveConcurrency() const {
+        return adaptive_concurrency_;
+    }
+
+    void
+    SetAdaptiveConcurrency(bool adaptive_concurrency) {
+        adaptive_concurrency_ = adaptive_concurrency;
+    }
+
+    uint32_t
+    MinConcurrency() const {
+        return min_concurrency_;
+    }
+
+    void
+    SetMinConcurrency(uint32_t min_concurrency) {
+        min_concurrency_ = min_concurrency;
+    }
+
+    uint32_t
+    LatencyThresholdMs() const {
+        return latency_threshold_ms_;
+    }
+
+    void
+    SetLatencyThresholdMs(uint32_t latency_threshold_ms) {
+        latency_threshold_ms_ = latency_threshold_ms;
+    }
+
+    double
+    BackoffRatio() const {
+        return backoff_ratio_;
+    }
+
+    void
+    SetBackoffRatio(double backoff_ratio) {
+        backoff_ratio_ = backoff_ratio;
+    }
+
+ private:
+    bool enabled_ = false;
+    ClassLimit limits_[CLASS_COUNT];
+    uint32_t max_concurrency_ = 64;
+    uint32_t queue_timeout_ms_ = 10000;
+    bool adaptive_concurrency_ = false;
+    uint32_t min_concurrency_ = 1;
+    uint32_t latency_threshold_ms_ = 1000;
+    double backoff_ratio_ = 0.5;
+};
+
+}  // namespace milvus
@@ -0,0 +1,109 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Arguments for BalanceQueryNodes().
+ *
+ * The load of a query node is the memory of the segments it holds, or their rows if the server reports no memory
+ * size. The nodes are skewed when the most loaded one carries more than SkewThreshold() times the mean load, then
+ * sealed segments are moved from the most loaded node to the least loaded one, largest first, while each move
+ * narrows the gap between them.
+ */
+class BalanceArguments {
+ public:
+    /**
+     * @brief Collections whose segments are balanced.
+     */
+    const std::vector<std::string>&
+    Collections() const {
+        return collections_;
+    }
+
+    void
+    AddCollection(const std::string& collection_name) {
+        collections_.push_back(collection_name);
+    }
+
+    /**
+     * @brief Query nodes to balance onto in addition to the ones holding segments. A node added by a scale-out
+     * holds no segment yet and is invisible in the segment info, list it here to move segments onto it.
+     */
+    const std::vector<int64_t>&
+    QueryNodes() const {
+        return query_nodes_;
+    }
+
+    void
+    AddQueryNode(int64_t node_id) {
+        query_nodes_.push_back(node_id);
+    }
+
+    /**
+     * @brief Ratio of the largest node load to the mean load above which segments are moved, default is 1.2.
+     */
+    double
+    SkewThreshold() const {
+        return skew_threshold_;
+    }
+
+    void
+    SetSkewThreshold(double skew_threshold) {
+        skew_threshold_ = skew_threshold;
+    }
+
+    /**
+     * @brief Segments moved in one call at most, default is 4.
+     */
+    uint32_t
+    MaxMoves() const {
+        return max_moves_;
+    }
+
+    void
+    SetMaxMoves(uint32_t max_moves) {
+        max_moves_ = max_moves;
+    }
+
+    /**
+     * @brief Send the moves by LoadBalance(), otherwise they are only proposed. Default is false.
+     */
+    bool
+    Execute() const {
+        return execute_;
+    }
+
+    void
+    SetExecute(bool execute) {
+        execute_ = execute;
+    }
+
+ private:
+    std::vector<std::string> collections_;
+    std::vector<int64_t> query_nodes_;
+    double skew_threshold_ = 1.2;
+    uint32_t max_moves_ = 4;
+    bool execute_ = false;
+};
+
+}  // namespace milvus
@@ -0,0 +1,106 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Segments held by one query node.
+ */
+struct NodeLoad {
+    int64_t node_id_ = 0;
+    int64_t segment_count_ = 0;
+    int64_t row_count_ = 0;
+    int64_t mem_size_ = 0;
+};
+
+/**
+ * @brief Sealed segments to be moved from one query node to another by one LoadBalance() call.
+ */
+struct BalanceMove {
+    int64_t source_node_ = 0;
+    int64_t target_node_ = 0;
+    std::vector<int64_t> segment_ids_;
+    // load carried by the segments, memory or rows as the node loads
+    int64_t load_ = 0;
+};
+
+/**
+ * @brief Results returned by BalanceQueryNodes().
+ */
+class BalanceResults {
+ public:
+    BalanceResults() = default;
+
+    BalanceResults(std::vector<NodeLoad>&& node_loads, double skew, double projected_skew,
+                   std::vector<BalanceMove>&& moves, bool executed)
+        : node_loads_(std::move(node_loads)),
+          skew_(skew),
+          projected_skew_(projected_skew),
+          moves_(std::move(moves)),
+          executed_(executed) {
+    }
+
+    /**
+     * @brief Load of each query node before the moves, ordered by node id.
+     */
+    const std::vector<NodeLoad>&
+    NodeLoads() const {
+        return node_loads_;
+    }
+
+    /**
+     * @brief Largest node load divided by the mean load, 1 means perfectly balanced.
+     */
+    double
+    Skew() const {
+        return skew_;
+    }
+
+    /**
+     * @brief Skew after the moves are applied.
+     */
+    double
+    ProjectedSkew() const {
+        return projected_skew_;
+    }
+
+    const std::vector<BalanceMove>&
+    Moves() const {
+        return moves_;
+    }
+
+    /**
+     * @brief True if the moves were sent to the server.
+     */
+    bool
+    Executed() const {
+        return executed_;
+    }
+
+ private:
+    std::vector<NodeLoad> node_loads_;
+    double skew_ = 1.0;
+    double projected_skew_ = 1.0;
+    std::vector<BalanceMove> moves_;
+    bool executed_ = false;
+};
+
+}  // namespace milvus
@@ -0,0 +1,75 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace milvus {
+
+/**
+ * @brief Recording of the requests sent by a client into a capture log, for replay by ReplayCapture().
+ */
+class CaptureConfig {
+ public:
+    /**
+     * @brief Capture log file, requests are appended to it. Empty disables capture, which is the default.
+     * Each client needs a file of its own.
+     */
+    const std::string&
+    Path() const {
+        return path_;
+    }
+
+    void
+    SetPath(const std::string& path) {
+        path_ = path;
+    }
+
+    /**
+     * @brief Fraction of the requests recorded, evenly spaced. Default is 1, every request.
+     */
+    double
+    SampleRatio() const {
+        return sample_ratio_;
+    }
+
+    void
+    SetSampleRatio(double sample_ratio) {
+        sample_ratio_ = sample_ratio;
+    }
+
+    /**
+     * @brief Recording stops when the file reaches this size, 0 means no limit.
+     */
+    uint64_t
+    MaxFileBytes() const {
+        return max_file_bytes_;
+    }
+
+    void
+    SetMaxFileBytes(uint64_t max_file_bytes) {
+        max_file_bytes_ = max_file_bytes;
+    }
+
+ private:
+    std::string path_;
+    double sample_ratio_ = 1.0;
+    uint64_t max_file_bytes_ = 0;
+};
+
+}  // namespace milvus
@@ -28,16 +28,56 @@ namespace milvus {
  */
 class CollectionDesc {
  public:
+    const CollectionSchema&
+    Schema() const {
+        return schema_;
+    }
+
+    void
+    SetSchema(const CollectionSchema& schema) {
+        schema_ = schema;
+    }
+
+    int64_t
+    ID() const {
+        return collection_id_;
+    }
+
+    void
+    SetID(int64_t collection_id) {
+        collection_id_ = collection_id;
+    }
+
+    const std::vector<std::string>&
+    Alias() const {
+        return alias_;
+    }
+
+    void
+    SetAlias(const std::vector<std::string>& alias) {
+        alias_ = alias;
+    }
+
+    uint64_t
+    CreatedTime() const {
+        return created_utc_timestamp_;
+    }
+
+    void
+    SetCreatedTime(uint64_t created_utc_timestamp) {
+        created_utc_timestamp_ = created_utc_timestamp;
+    }
+
  private:
     /**
      * @brief Collection schema defined by CreateCollection().
      */
-    CollectionSchema schema_;
+    CollectionSchema schema_{""};
 
     /**
      * @brief Internal id of this collection.
      */
-    int64_t collection_id_;
+    int64_t collection_id_ = 0;
 
     /**
      * @brief Alias of this collection.
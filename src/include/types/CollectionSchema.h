@@ -42,6 +42,11 @@ class CollectionSchema {
         return description_;
     }
 
+    int32_t
+    ShardNum() const {
+        return shard_num_;
+    }
+
     const std::vector<FieldSchema>&
     Fields() const {
         return fields_;
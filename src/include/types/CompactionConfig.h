@@ -0,0 +1,148 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Compaction scheduler of the client, see ConnectParam::SetCompaction().
+ *
+ * Every CheckIntervalMs() the segments of each watched collection are read. A compaction is started when the rows
+ * deleted through this client since the last compaction reach DeleteRatio() of the stored rows, or when
+ * SmallSegmentCount() flushed segments hold fewer than SmallSegmentRows() rows each. Compactions are only started
+ * inside the maintenance window, at most Budget() of them in each window, and one at a time for a collection.
+ */
+class CompactionConfig {
+ public:
+    /**
+     * @brief Collections watched by the scheduler, the scheduler is disabled if it is empty.
+     */
+    const std::vector<std::string>&
+    Collections() const {
+        return collections_;
+    }
+
+    void
+    AddCollection(const std::string& collection_name) {
+        collections_.push_back(collection_name);
+    }
+
+    double
+    DeleteRatio() const {
+        return delete_ratio_;
+    }
+
+    void
+    SetDeleteRatio(double delete_ratio) {
+        delete_ratio_ = delete_ratio;
+    }
+
+    int64_t
+    SmallSegmentRows() const {
+        return small_segment_rows_;
+    }
+
+    void
+    SetSmallSegmentRows(int64_t small_segment_rows) {
+        small_segment_rows_ = small_segment_rows;
+    }
+
+    uint32_t
+    SmallSegmentCount() const {
+        return small_segment_count_;
+    }
+
+    void
+    SetSmallSegmentCount(uint32_t small_segment_count) {
+        small_segment_count_ = small_segment_count;
+    }
+
+    /**
+     * @brief Compactions started in one maintenance window, or in one day if the window is the whole day.
+     */
+    uint32_t
+    Budget() const {
+        return budget_;
+    }
+
+    void
+    SetBudget(uint32_t budget) {
+        budget_ = budget;
+    }
+
+    /**
+     * @brief Maintenance window in minutes after local midnight, [start, end). The window wraps midnight if end is
+     * less than start, and it is the whole day if they are equal, which is the default.
+     */
+    uint32_t
+    WindowStartMinute() const {
+        return window_start_minute_;
+    }
+
+    uint32_t
+    WindowEndMinute() const {
+        return window_end_minute_;
+    }
+
+    void
+    SetMaintenanceWindow(uint32_t start_minute, uint32_t end_minute) {
+        window_start_minute_ = start_minute % kMinutesPerDay;
+        window_end_minute_ = end_minute % kMinutesPerDay;
+    }
+
+    uint32_t
+    CheckIntervalMs() const {
+        return check_interval_ms_;
+    }
+
+    void
+    SetCheckIntervalMs(uint32_t check_interval_ms) {
+        check_interval_ms_ = check_interval_ms;
+    }
+
+    /**
+     * @brief Interval of GetCompactionState() calls following a running compaction.
+     */
+    uint32_t
+    PollIntervalMs() const {
+        return poll_interval_ms_;
+    }
+
+    void
+    SetPollIntervalMs(uint32_t poll_interval_ms) {
+        poll_interval_ms_ = poll_interval_ms;
+    }
+
+    static constexpr uint32_t kMinutesPerDay = 24 * 60;
+
+ private:
+    std::vector<std::string> collections_;
+    double delete_ratio_ = 0.2;
+    int64_t small_segment_rows_ = 10000;
+    uint32_t small_segment_count_ = 8;
+    uint32_t budget_ = 4;
+    uint32_t window_start_minute_ = 0;
+    uint32_t window_end_minute_ = 0;
+    uint32_t check_interval_ms_ = 10 * 60 * 1000;
+    uint32_t poll_interval_ms_ = 5 * 1000;
+};
+
+}  // namespace milvus
@@ -0,0 +1,73 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace milvus {
+
+enum class CompactionState {
+    UNKNOWN = 0,
+    EXECUTING = 1,
+    COMPLETED = 2,
+};
+
+/**
+ * @brief Progress of a compaction returned by GetCompactionState().
+ */
+class CompactionProgress {
+ public:
+    CompactionProgress() = default;
+
+    CompactionProgress(CompactionState state, int64_t executing_plans, int64_t timeout_plans, int64_t completed_plans)
+        : state_(state),
+          executing_plans_(executing_plans),
+          timeout_plans_(timeout_plans),
+          completed_plans_(completed_plans) {
+    }
+
+    CompactionState
+    State() const {
+        return state_;
+    }
+
+    /**
+     * @brief Number of merge plans of the compaction being executed.
+     */
+    int64_t
+    ExecutingPlans() const {
+        return executing_plans_;
+    }
+
+    int64_t
+    TimeoutPlans() const {
+        return timeout_plans_;
+    }
+
+    int64_t
+    CompletedPlans() const {
+        return completed_plans_;
+    }
+
+ private:
+    CompactionState state_ = CompactionState::UNKNOWN;
+    int64_t executing_plans_ = 0;
+    int64_t timeout_plans_ = 0;
+    int64_t completed_plans_ = 0;
+};
+
+}  // namespace milvus
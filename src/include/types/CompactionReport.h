@@ -0,0 +1,146 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "CompactionProgress.h"
+
+namespace milvus {
+
+/**
+ * @brief Segments of a collection, counted over the flushed and sealed segments.
+ */
+struct SegmentSummary {
+    int64_t segment_count_ = 0;
+    int64_t row_count_ = 0;
+    int64_t small_segment_count_ = 0;
+};
+
+/**
+ * @brief A compaction started by the compaction scheduler, returned by GetCompactionReports().
+ */
+class CompactionReport {
+ public:
+    const std::string&
+    CollectionName() const {
+        return collection_name_;
+    }
+
+    void
+    SetCollectionName(const std::string& collection_name) {
+        collection_name_ = collection_name;
+    }
+
+    int64_t
+    CompactionID() const {
+        return compaction_id_;
+    }
+
+    void
+    SetCompactionID(int64_t compaction_id) {
+        compaction_id_ = compaction_id;
+    }
+
+    /**
+     * @brief Why the compaction was started, for example "deleted rows 25% of 1000000".
+     */
+    const std::string&
+    Reason() const {
+        return reason_;
+    }
+
+    void
+    SetReason(const std::string& reason) {
+        reason_ = reason;
+    }
+
+    /**
+     * @brief Last known state, UNKNOWN if it can't be followed.
+     */
+    CompactionState
+    State() const {
+        return state_;
+    }
+
+    void
+    SetState(CompactionState state) {
+        state_ = state;
+    }
+
+    /**
+     * @brief Segments when the compaction was started.
+     */
+    const SegmentSummary&
+    Before() const {
+        return before_;
+    }
+
+    void
+    SetBefore(const SegmentSummary& before) {
+        before_ = before;
+    }
+
+    /**
+     * @brief Segments when the compaction was completed, empty until then.
+     */
+    const SegmentSummary&
+    After() const {
+        return after_;
+    }
+
+    void
+    SetAfter(const SegmentSummary& after) {
+        after_ = after;
+    }
+
+    /**
+     * @brief Start and end time, milliseconds since epoch, the end time is 0 until the compaction is completed.
+     */
+    int64_t
+    StartTimeMs() const {
+        return start_time_ms_;
+    }
+
+    void
+    SetStartTimeMs(int64_t start_time_ms) {
+        start_time_ms_ = start_time_ms;
+    }
+
+    int64_t
+    EndTimeMs() const {
+        return end_time_ms_;
+    }
+
+    void
+    SetEndTimeMs(int64_t end_time_ms) {
+        end_time_ms_ = end_time_ms;
+    }
+
+ private:
+    std::string collection_name_;
+    int64_t compaction_id_ = 0;
+    std::string reason_;
+    CompactionState state_ = CompactionState::UNKNOWN;
+    SegmentSummary before_;
+    SegmentSummary after_;
+    int64_t start_time_ms_ = 0;
+    int64_t end_time_ms_ = 0;
+};
+
+}  // namespace milvus
@@ -16,16 +16,206 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
+#include "AdmissionConfig.h"
+#include "CaptureConfig.h"
+#include "CompactionConfig.h"
+#include "DuplicateFilterConfig.h"
+#include "EntityCacheConfig.h"
+#include "InsertCoalesceConfig.h"
+#include "MemoryBudgetConfig.h"
+#include "MetricsConfig.h"
+#include "ThreadingConfig.h"
+
 namespace milvus {
 class ConnectParam {
  public:
     ConnectParam(const std::string& host, uint16_t port) : host_(host), port_(port) {
     }
 
+    /**
+     * @brief Connect by uri, "host:port", "tcp://host:port", "unix:///path/to/socket", "unix-abstract:name" or any
+     * other gRPC target such as "dns:///host:port" and "ipv4:10.0.0.1:19530". Local unix socket channels get
+     * defaults tuned for same-host IPC: no proxy lookup, no BDP probing and a short reconnect backoff.
+     */
+    explicit ConnectParam(const std::string& uri) : uri_(uri) {
+    }
+
+    /**
+     * @brief Connect uri, host_ and port_ are used when it is empty.
+     */
+    const std::string&
+    Uri() const {
+        return uri_;
+    }
+
+    void
+    SetUri(const std::string& uri) {
+        uri_ = uri;
+    }
+
+    /**
+     * @brief Client-side admission control of the requests sent by this client.
+     */
+    const AdmissionConfig&
+    Admission() const {
+        return admission_;
+    }
+
+    void
+    SetAdmission(const AdmissionConfig& admission) {
+        admission_ = admission;
+    }
+
+    /**
+     * @brief Memory budget of in-flight requests and responses of this client.
+     */
+    const MemoryBudgetConfig&
+    MemoryBudget() const {
+        return memory_budget_;
+    }
+
+    void
+    SetMemoryBudget(const MemoryBudgetConfig& memory_budget) {
+        memory_budget_ = memory_budget;
+    }
+
+    /**
+     * @brief Share the channel with other clients connected to the same endpoint with the same settings, the
+     * channel is managed by a process-wide registry and closed when idle. Default is true.
+     */
+    bool
+    ShareChannel() const {
+        return share_channel_;
+    }
+
+    void
+    SetShareChannel(bool share_channel) {
+        share_channel_ = share_channel;
+    }
+
+    /**
+     * @brief Time a shared channel is kept open after the last client using it disconnects.
+     */
+    uint32_t
+    ChannelIdleTimeoutMs() const {
+        return channel_idle_timeout_ms_;
+    }
+
+    void
+    SetChannelIdleTimeoutMs(uint32_t channel_idle_timeout_ms) {
+        channel_idle_timeout_ms_ = channel_idle_timeout_ms;
+    }
+
+    /**
+     * @brief Threads created by the SDK for this client, their CPU affinity and the gRPC resource quota.
+     */
+    const ThreadingConfig&
+    Threading() const {
+        return threading_;
+    }
+
+    void
+    SetThreading(const ThreadingConfig& threading) {
+        threading_ = threading;
+    }
+
+    /**
+     * @brief Record the requests of this client into a capture log.
+     */
+    const CaptureConfig&
+    Capture() const {
+        return capture_;
+    }
+
+    void
+    SetCapture(const CaptureConfig& capture) {
+        capture_ = capture;
+    }
+
+    /**
+     * @brief Cache of the entities fetched by QueryByIds(), disabled by default.
+     */
+    const EntityCacheConfig&
+    EntityCache() const {
+        return entity_cache_;
+    }
+
+    void
+    SetEntityCache(const EntityCacheConfig& entity_cache) {
+        entity_cache_ = entity_cache;
+    }
+
+    /**
+     * @brief Filters of recently inserted primary keys, see InsertOptions::SetDuplicates().
+     */
+    const DuplicateFilterConfig&
+    DuplicateFilter() const {
+        return duplicate_filter_;
+    }
+
+    void
+    SetDuplicateFilter(const DuplicateFilterConfig& duplicate_filter) {
+        duplicate_filter_ = duplicate_filter;
+    }
+
+    /**
+     * @brief Group commit of small inserts, see InsertOptions::SetCoalesce().
+     */
+    const InsertCoalesceConfig&
+    InsertCoalesce() const {
+        return insert_coalesce_;
+    }
+
+    void
+    SetInsertCoalesce(const InsertCoalesceConfig& insert_coalesce) {
+        insert_coalesce_ = insert_coalesce;
+    }
+
+    /**
+     * @brief Compaction scheduler of the watched collections, disabled by default.
+     */
+    const CompactionConfig&
+    Compaction() const {
+        return compaction_;
+    }
+
+    void
+    SetCompaction(const CompactionConfig& compaction) {
+        compaction_ = compaction;
+    }
+
+    /**
+     * @brief Background poller of the server metrics, disabled by default.
+     */
+    const MetricsConfig&
+    Metrics() const {
+        return metrics_;
+    }
+
+    void
+    SetMetrics(const MetricsConfig& metrics) {
+        metrics_ = metrics;
+    }
+
     std::string host_;
     uint16_t port_ = 0;
+
+ private:
+    std::string uri_;
+    AdmissionConfig admission_;
+    MemoryBudgetConfig memory_budget_;
+    bool share_channel_ = true;
+    uint32_t channel_idle_timeout_ms_ = 60 * 1000;
+    ThreadingConfig threading_;
+    CaptureConfig capture_;
+    EntityCacheConfig entity_cache_;
+    DuplicateFilterConfig duplicate_filter_;
+    InsertCoalesceConfig insert_coalesce_;
+    CompactionConfig compaction_;
+    MetricsConfig metrics_;
 };
 
 }  // namespace milvus
@@ -18,6 +18,6 @@
 
 namespace milvus {
 
-const char* KEY_ROW_COUNT = "row_count";
+const char* const KEY_ROW_COUNT = "row_count";
 
 }  // namespace milvus
@@ -0,0 +1,177 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Primary keys returned by Insert(), either integer or string.
+ */
+class IDArray {
+ public:
+    IDArray() = default;
+
+    explicit IDArray(const std::vector<int64_t>& id_array) : int_id_array_(id_array) {
+    }
+
+    explicit IDArray(const std::vector<std::string>& id_array) : is_int_array_(false), str_id_array_(id_array) {
+    }
+
+    bool
+    IsIntegerID() const {
+        return is_int_array_;
+    }
+
+    const std::vector<int64_t>&
+    IntIDArray() const {
+        return int_id_array_;
+    }
+
+    const std::vector<std::string>&
+    StrIDArray() const {
+        return str_id_array_;
+    }
+
+ private:
+    bool is_int_array_ = true;
+    std::vector<int64_t> int_id_array_;
+    std::vector<std::string> str_id_array_;
+};
+
+/**
+ * @brief Results returned by Insert() and Delete().
+ */
+class DmlResults {
+ public:
+    const IDArray&
+    IdArray() const {
+        return id_array_;
+    }
+
+    void
+    SetIdArray(const IDArray& id_array) {
+        id_array_ = id_array;
+    }
+
+    void
+    SetIdArray(IDArray&& id_array) {
+        id_array_ = std::move(id_array);
+    }
+
+    uint64_t
+    Timestamp() const {
+        return timestamp_;
+    }
+
+    void
+    SetTimestamp(uint64_t timestamp) {
+        timestamp_ = timestamp;
+    }
+
+    int64_t
+    InsertCount() const {
+        return insert_cnt_;
+    }
+
+    void
+    SetInsertCount(int64_t insert_cnt) {
+        insert_cnt_ = insert_cnt;
+    }
+
+    int64_t
+    DeleteCount() const {
+        return delete_cnt_;
+    }
+
+    void
+    SetDeleteCount(int64_t delete_cnt) {
+        delete_cnt_ = delete_cnt;
+    }
+
+    const std::vector<int64_t>&
+    ShardRowCounts() const {
+        return shard_row_counts_;
+    }
+
+    void
+    SetShardRowCounts(std::vector<int64_t>&& shard_row_counts) {
+        shard_row_counts_ = std::move(shard_row_counts);
+    }
+
+    const std::vector<uint32_t>&
+    ErrorRows() const {
+        return error_rows_;
+    }
+
+    void
+    SetErrorRows(std::vector<uint32_t>&& error_rows) {
+        error_rows_ = std::move(error_rows);
+    }
+
+    const std::vector<uint32_t>&
+    DuplicateRows() const {
+        return duplicate_rows_;
+    }
+
+    void
+    SetDuplicateRows(std::vector<uint32_t>&& duplicate_rows) {
+        duplicate_rows_ = std::move(duplicate_rows);
+    }
+
+ private:
+    /**
+     * @brief Primary keys of the inserted entities.
+     */
+    IDArray id_array_;
+
+    /**
+     * @brief The operation timestamp marked by server.
+     */
+    uint64_t timestamp_ = 0;
+
+    /**
+     * @brief Count of inserted entities.
+     */
+    int64_t insert_cnt_ = 0;
+
+    /**
+     * @brief Count of deleted entities.
+     */
+    int64_t delete_cnt_ = 0;
+
+    /**
+     * @brief Inserted row count of each shard, only available when client hashing is enabled.
+     */
+    std::vector<int64_t> shard_row_counts_;
+
+    /**
+     * @brief Input rows the server failed to insert.
+     */
+    std::vector<uint32_t> error_rows_;
+
+    /**
+     * @brief Input rows whose primary key was probably inserted before, only available when duplicate check is
+     * enabled by InsertOptions::SetDuplicates().
+     */
+    std::vector<uint32_t> duplicate_rows_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,98 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace milvus {
+
+/**
+ * @brief Client-side filter of recently inserted primary keys, used by Insert() with
+ * InsertOptions::SetDuplicates() to find entities delivered more than once by an at-least-once pipeline.
+ *
+ * Each collection has a scalable Bloom filter: when a filter is full, a new one twice as large and with half the
+ * false positive rate is added, so the total false positive rate stays under FalsePositiveRate(). Once MaxStages()
+ * filters are kept, the oldest one is dropped for each new one, so keys age out. A false positive reports a new
+ * entity as a duplicate, a duplicate of a key still held is never missed.
+ */
+class DuplicateFilterConfig {
+ public:
+    /**
+     * @brief Upper bound of the probability that a new primary key is reported as a duplicate.
+     */
+    double
+    FalsePositiveRate() const {
+        return false_positive_rate_;
+    }
+
+    void
+    SetFalsePositiveRate(double false_positive_rate) {
+        false_positive_rate_ = false_positive_rate;
+    }
+
+    /**
+     * @brief Number of keys held by the first filter of each collection.
+     */
+    uint64_t
+    InitialCapacity() const {
+        return initial_capacity_;
+    }
+
+    void
+    SetInitialCapacity(uint64_t initial_capacity) {
+        initial_capacity_ = initial_capacity;
+    }
+
+    /**
+     * @brief Number of filters kept for each collection, default is 4, that is up to 15 times InitialCapacity() keys.
+     * When the last one is full, the oldest one and its keys are dropped and the new one has the size of the last
+     * one, which bounds the memory and the saved file. 0 means filters are never dropped.
+     */
+    uint32_t
+    MaxStages() const {
+        return max_stages_;
+    }
+
+    void
+    SetMaxStages(uint32_t max_stages) {
+        max_stages_ = max_stages;
+    }
+
+    /**
+     * @brief Directory where the filters are saved as "<collection>.dupfilter" by
+     * SaveDuplicateFilters(), Disconnect() and a reconnect by Connect(), and loaded from on first use. Empty means
+     * the filters are kept in memory only.
+     */
+    const std::string&
+    Directory() const {
+        return directory_;
+    }
+
+    void
+    SetDirectory(const std::string& directory) {
+        directory_ = directory;
+    }
+
+ private:
+    double false_positive_rate_ = 0.001;
+    uint64_t initial_capacity_ = 1 << 20;
+    uint32_t max_stages_ = 4;
+    std::string directory_;
+};
+
+}  // namespace milvus
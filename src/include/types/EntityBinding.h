@@ -0,0 +1,377 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Status.h"
+#include "types/CollectionSchema.h"
+#include "types/FieldData.h"
+
+namespace milvus {
+
+/**
+ * @brief Tells whether a struct member can hold a vector field whose elements are of type Element.
+ *
+ * std::array<Element, N> has a fixed width checked at compile time, std::vector<Element> is checked at runtime.
+ */
+template <typename Member, typename Element>
+struct VectorMemberTraits {
+    static constexpr bool Valid = false;
+    static constexpr size_t FixedWidth = 0;
+};
+
+template <typename Element, size_t N>
+struct VectorMemberTraits<std::array<Element, N>, Element> {
+    static constexpr bool Valid = true;
+    static constexpr size_t FixedWidth = N;
+
+    static size_t
+    Size(const std::array<Element, N>&) {
+        return N;
+    }
+
+    static void
+    Assign(std::array<Element, N>& member, const Element* row, size_t) {
+        std::copy(row, row + N, member.begin());
+    }
+};
+
+template <typename Element, typename Allocator>
+struct VectorMemberTraits<std::vector<Element, Allocator>, Element> {
+    static constexpr bool Valid = true;
+    static constexpr size_t FixedWidth = 0;
+
+    static size_t
+    Size(const std::vector<Element, Allocator>& member) {
+        return member.size();
+    }
+
+    static void
+    Assign(std::vector<Element, Allocator>& member, const Element* row, size_t width) {
+        member.assign(row, row + width);
+    }
+};
+
+/**
+ * @brief Type-erased accessor between one member of Entity and one column of field data.
+ *
+ * Each implementation is generated for a concrete member type, so the per-row loops contain no type dispatch.
+ */
+template <typename Entity>
+class EntityColumn {
+ public:
+    explicit EntityColumn(const FieldSchema& schema) : schema_(schema) {
+    }
+
+    virtual ~EntityColumn() = default;
+
+    const FieldSchema&
+    Schema() const {
+        return schema_;
+    }
+
+    /**
+     * @brief Gather this member of all entities into a column.
+     */
+    virtual Status
+    Write(const std::vector<Entity>& entities, FieldDataPtr& field) const = 0;
+
+    /**
+     * @brief Scatter a column into this member of all entities, entities must be sized to the row count.
+     */
+    virtual Status
+    Read(const Field& field, std::vector<Entity>& entities) const = 0;
+
+ protected:
+    Status
+    CheckColumn(const Field& field, size_t row_count) const {
+        if (field.Type() != schema_.FieldDataType()) {
+            return Status(StatusCode::InvalidAgument, "Data type of field '" + field.Name() + "' is mismatched");
+        }
+        if (field.Count() != row_count) {
+            return Status(StatusCode::InvalidAgument, "Row count of field '" + field.Name() + "' is mismatched");
+        }
+        return Status::OK();
+    }
+
+ private:
+    FieldSchema schema_;
+};
+
+template <typename Entity, DataType Dt, typename Member>
+class ScalarEntityColumn : public EntityColumn<Entity> {
+ public:
+    using ColumnType = FieldData<Member, Dt>;
+
+    ScalarEntityColumn(const FieldSchema& schema, Member Entity::*member)
+        : EntityColumn<Entity>(schema), member_(member) {
+    }
+
+    Status
+    Write(const std::vector<Entity>& entities, FieldDataPtr& field) const override {
+        std::vector<Member> data;
+        data.reserve(entities.size());
+        for (const auto& entity : entities) {
+            data.push_back(entity.*member_);
+        }
+        field = std::make_shared<ColumnType>(this->Schema().Name(), std::move(data));
+        return Status::OK();
+    }
+
+    Status
+    Read(const Field& field, std::vector<Entity>& entities) const override {
+        auto status = this->CheckColumn(field, entities.size());
+        if (!status.IsOk()) {
+            return status;
+        }
+        const auto& data = static_cast<const ColumnType&>(field).Data();
+        for (size_t i = 0; i < entities.size(); ++i) {
+            entities[i].*member_ = data[i];
+        }
+        return Status::OK();
+    }
+
+ private:
+    Member Entity::*member_;
+};
+
+template <typename Entity, DataType Dt, uint32_t Dim, typename Member>
+class VectorEntityColumn : public EntityColumn<Entity> {
+ public:
+    using Element = typename DataTypeTraits<Dt>::ElementType;
+    using ColumnType = VectorFieldData<Element, Dt>;
+    using MemberTraits = VectorMemberTraits<Member, Element>;
+
+    VectorEntityColumn(const FieldSchema& schema, Member Entity::*member)
+        : EntityColumn<Entity>(schema), member_(member) {
+    }
+
+    Status
+    Write(const std::vector<Entity>& entities, FieldDataPtr& field) const override {
+        const size_t width = DataTypeTraits<Dt>::RowWidth(Dim);
+        std::vector<Element> data(entities.size() * width);
+        auto dest = data.begin();
+        for (const auto& entity : entities) {
+            const auto& row = entity.*member_;
+            if (MemberTraits::FixedWidth == 0 && MemberTraits::Size(row) != width) {
+                return Status(StatusCode::InvalidAgument,
+                              "Vector dimension of field '" + this->Schema().Name() + "' is mismatched");
+            }
+            dest = std::copy(row.begin(), row.end(), dest);
+        }
+        field = std::make_shared<ColumnType>(this->Schema().Name(), Dim, std::move(data));
+        return Status::OK();
+    }
+
+    Status
+    Read(const Field& field, std::vector<Entity>& entities) const override {
+        auto status = this->CheckColumn(field, entities.size());
+        if (!status.IsOk()) {
+            return status;
+        }
+        const auto& column = static_cast<const ColumnType&>(field);
+        if (column.Dimension() != Dim) {
+            return Status(StatusCode::InvalidAgument,
+                          "Vector dimension of field '" + field.Name() + "' is mismatched");
+        }
+        for (size_t i = 0; i < entities.size(); ++i) {
+            MemberTraits::Assign(entities[i].*member_, column.Row(i), column.RowWidth());
+        }
+        return Status::OK();
+    }
+
+ private:
+    Member Entity::*member_;
+};
+
+/**
+ * @brief Compile-time binding between a user struct and a collection schema.
+ *
+ * Declare the binding once, then use it to create the collection and to convert between entities and columns:
+ * @code
+ *   struct Book {
+ *       int64_t id;
+ *       int32_t word_count;
+ *       std::array<float, 128> intro;
+ *   };
+ *
+ *   milvus::EntityBinding<Book> binding("books");
+ *   binding.AddPrimaryField<milvus::DataType::INT64>("id", &Book::id)
+ *       .AddField<milvus::DataType::INT32>("word_count", &Book::word_count)
+ *       .AddVectorField<milvus::DataType::FLOAT_VECTOR, 128>("intro", &Book::intro);
+ *
+ *   client->CreateCollection(binding.Schema());
+ *
+ *   std::vector<milvus::FieldDataPtr> fields;
+ *   binding.ToFields(books, fields);
+ *   client->Insert("books", "", fields, dml_results);
+ * @endcode
+ *
+ * A member whose C++ type doesn't match the declared DataType, or a std::array member whose length doesn't match
+ * the declared dimension, fails to compile.
+ */
+template <typename Entity>
+class EntityBinding {
+ public:
+    explicit EntityBinding(const std::string& collection_name, const std::string& description = "",
+                           int32_t shard_num = 2)
+        : schema_(collection_name, description, shard_num) {
+    }
+
+    /**
+     * @brief Bind the primary key field, currently only int64 type field can be primary key.
+     */
+    template <DataType Dt, typename Member>
+    EntityBinding&
+    AddPrimaryField(const std::string& name, Member Entity::*member, bool auto_id = false,
+                    const std::string& description = "") {
+        static_assert(Dt == DataType::INT64, "Only INT64 field can be primary key");
+        static_assert(std::is_same<Member, typename DataTypeTraits<Dt>::ElementType>::value,
+                      "Member type doesn't match the field data type");
+        FieldSchema field_schema(name, Dt, description, true, auto_id);
+        Add(field_schema, std::make_shared<ScalarEntityColumn<Entity, Dt, Member>>(field_schema, member));
+        return *this;
+    }
+
+    /**
+     * @brief Bind a scalar field.
+     */
+    template <DataType Dt, typename Member>
+    EntityBinding&
+    AddField(const std::string& name, Member Entity::*member, const std::string& description = "") {
+        static_assert(!DataTypeTraits<Dt>::IsVector, "Use AddVectorField() for vector field");
+        static_assert(std::is_same<Member, typename DataTypeTraits<Dt>::ElementType>::value,
+                      "Member type doesn't match the field data type");
+        FieldSchema field_schema(name, Dt, description);
+        Add(field_schema, std::make_shared<ScalarEntityColumn<Entity, Dt, Member>>(field_schema, member));
+        return *this;
+    }
+
+    /**
+     * @brief Bind a vector field, the member can be std::array or std::vector of the vector element type.
+     */
+    template <DataType Dt, uint32_t Dim, typename Member>
+    EntityBinding&
+    AddVectorField(const std::string& name, Member Entity::*member, const std::string& description = "") {
+        using Element = typename DataTypeTraits<Dt>::ElementType;
+        static_assert(DataTypeTraits<Dt>::IsVector, "Use AddField() for scalar field");
+        static_assert(Dim > 0, "Vector dimension must be larger than zero");
+        static_assert(Dt != DataType::BINARY_VECTOR || Dim % 8 == 0, "Binary vector dimension must be divisible by 8");
+        static_assert(VectorMemberTraits<Member, Element>::Valid,
+                      "Member type must be std::array or std::vector of the vector element type");
+        static_assert(VectorMemberTraits<Member, Element>::FixedWidth == 0 ||
+                          VectorMemberTraits<Member, Element>::FixedWidth == DataTypeTraits<Dt>::RowWidth(Dim),
+                      "Length of std::array member doesn't match the vector dimension");
+        FieldSchema field_schema(name, Dt, description);
+        field_schema.SetDimension(Dim);
+        Add(field_schema, std::make_shared<VectorEntityColumn<Entity, Dt, Dim, Member>>(field_schema, member));
+        return *this;
+    }
+
+    /**
+     * @brief Collection schema generated from the bound fields.
+     */
+    const CollectionSchema&
+    Schema() const {
+        return schema_;
+    }
+
+    /**
+     * @brief Names of all bound fields, can be used as output fields of Query().
+     */
+    std::vector<std::string>
+    FieldNames() const {
+        std::vector<std::string> names;
+        for (const auto& column : columns_) {
+            names.push_back(column->Schema().Name());
+        }
+        return names;
+    }
+
+    /**
+     * @brief Convert entities into columns for Insert(), the auto-id primary key field is skipped.
+     *
+     * @param [in] entities entities to be inserted
+     * @param [out] fields one column for each bound field
+     * @return Status operation successfully or not
+     */
+    Status
+    ToFields(const std::vector<Entity>& entities, std::vector<FieldDataPtr>& fields) const {
+        fields.clear();
+        fields.reserve(columns_.size());
+        for (const auto& column : columns_) {
+            if (column->Schema().AutoID()) {
+                continue;
+            }
+            FieldDataPtr field;
+            auto status = column->Write(entities, field);
+            if (!status.IsOk()) {
+                return status;
+            }
+            fields.emplace_back(std::move(field));
+        }
+        return Status::OK();
+    }
+
+    /**
+     * @brief Convert columns returned by Query() into entities.
+     * Members whose field is not in the columns keep their default value.
+     *
+     * @param [in] fields columns returned by Query()
+     * @param [out] entities converted entities
+     * @return Status operation successfully or not
+     */
+    Status
+    FromFields(const std::vector<FieldDataPtr>& fields, std::vector<Entity>& entities) const {
+        entities.clear();
+        if (fields.empty()) {
+            return Status::OK();
+        }
+        entities.resize(fields.front()->Count());
+        for (const auto& field : fields) {
+            for (const auto& column : columns_) {
+                if (column->Schema().Name() != field->Name()) {
+                    continue;
+                }
+                auto status = column->Read(*field, entities);
+                if (!status.IsOk()) {
+                    return status;
+                }
+            }
+        }
+        return Status::OK();
+    }
+
+ private:
+    void
+    Add(FieldSchema& field_schema, std::shared_ptr<EntityColumn<Entity>>&& column) {
+        schema_.AddField(field_schema);
+        columns_.emplace_back(std::move(column));
+    }
+
+ private:
+    CollectionSchema schema_;
+    std::vector<std::shared_ptr<EntityColumn<Entity>>> columns_;
+};
+
+}  // namespace milvus
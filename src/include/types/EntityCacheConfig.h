@@ -0,0 +1,63 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace milvus {
+
+/**
+ * @brief Client-side cache of entities fetched by QueryByIds(), keyed by collection and primary key.
+ *
+ * Entries are admitted by TinyLFU: when the cache is full, a new entity replaces the least recently used one only
+ * if it has been requested more often. Entities deleted or inserted through this client are invalidated, writes of
+ * other clients are not seen until the entity is evicted.
+ */
+class EntityCacheConfig {
+ public:
+    /**
+     * @brief Max bytes of the cached entities, 0 disables the cache.
+     */
+    uint64_t
+    CapacityBytes() const {
+        return capacity_bytes_;
+    }
+
+    void
+    SetCapacityBytes(uint64_t capacity_bytes) {
+        capacity_bytes_ = capacity_bytes;
+    }
+
+    /**
+     * @brief Expected average size of an entity, used to size the frequency sketch of the admission policy.
+     */
+    uint32_t
+    AverageEntityBytes() const {
+        return average_entity_bytes_;
+    }
+
+    void
+    SetAverageEntityBytes(uint32_t average_entity_bytes) {
+        average_entity_bytes_ = average_entity_bytes;
+    }
+
+ private:
+    uint64_t capacity_bytes_ = 0;
+    uint32_t average_entity_bytes_ = 512;
+};
+
+}  // namespace milvus
@@ -0,0 +1,85 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace milvus {
+
+/**
+ * @brief Usage of the entity cache of a client.
+ */
+class EntityCacheStat {
+ public:
+    EntityCacheStat() = default;
+
+    EntityCacheStat(uint64_t capacity_bytes, uint64_t used_bytes, uint64_t entity_count, uint64_t hit_count,
+                    uint64_t miss_count, uint64_t reject_count)
+        : capacity_bytes_(capacity_bytes),
+          used_bytes_(used_bytes),
+          entity_count_(entity_count),
+          hit_count_(hit_count),
+          miss_count_(miss_count),
+          reject_count_(reject_count) {
+    }
+
+    /**
+     * @brief Configured capacity, 0 means the cache is disabled.
+     */
+    uint64_t
+    CapacityBytes() const {
+        return capacity_bytes_;
+    }
+
+    uint64_t
+    UsedBytes() const {
+        return used_bytes_;
+    }
+
+    uint64_t
+    EntityCount() const {
+        return entity_count_;
+    }
+
+    uint64_t
+    HitCount() const {
+        return hit_count_;
+    }
+
+    uint64_t
+    MissCount() const {
+        return miss_count_;
+    }
+
+    /**
+     * @brief Number of fetched entities not admitted because they are requested less often than the evicted ones.
+     */
+    uint64_t
+    RejectCount() const {
+        return reject_count_;
+    }
+
+ private:
+    uint64_t capacity_bytes_ = 0;
+    uint64_t used_bytes_ = 0;
+    uint64_t entity_count_ = 0;
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+    uint64_t reject_count_ = 0;
+};
+
+}  // namespace milvus
@@ -0,0 +1,263 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types/DataType.h"
+
+namespace milvus {
+
+/**
+ * @brief Compile-time description of each data type: the C++ element type stored in a column, and whether the
+ * field is a vector field.
+ */
+template <DataType Dt>
+struct DataTypeTraits;
+
+template <>
+struct DataTypeTraits<DataType::BOOL> {
+    using ElementType = bool;
+    static constexpr bool IsVector = false;
+};
+
+template <>
+struct DataTypeTraits<DataType::INT8> {
+    using ElementType = int8_t;
+    static constexpr bool IsVector = false;
+};
+
+template <>
+struct DataTypeTraits<DataType::INT16> {
+    using ElementType = int16_t;
+    static constexpr bool IsVector = false;
+};
+
+template <>
+struct DataTypeTraits<DataType::INT32> {
+    using ElementType = int32_t;
+    static constexpr bool IsVector = false;
+};
+
+template <>
+struct DataTypeTraits<DataType::INT64> {
+    using ElementType = int64_t;
+    static constexpr bool IsVector = false;
+};
+
+template <>
+struct DataTypeTraits<DataType::FLOAT> {
+    using ElementType = float;
+    static constexpr bool IsVector = false;
+};
+
+template <>
+struct DataTypeTraits<DataType::DOUBLE> {
+    using ElementType = double;
+    static constexpr bool IsVector = false;
+};
+
+template <>
+struct DataTypeTraits<DataType::STRING> {
+    using ElementType = std::string;
+    static constexpr bool IsVector = false;
+};
+
+/**
+ * @brief Binary vector is stored as bytes, each byte holds 8 dimensions.
+ */
+template <>
+struct DataTypeTraits<DataType::BINARY_VECTOR> {
+    using ElementType = uint8_t;
+    static constexpr bool IsVector = true;
+    static constexpr uint32_t
+    RowWidth(uint32_t dimension) {
+        return dimension / 8;
+    }
+};
+
+template <>
+struct DataTypeTraits<DataType::FLOAT_VECTOR> {
+    using ElementType = float;
+    static constexpr bool IsVector = true;
+    static constexpr uint32_t
+    RowWidth(uint32_t dimension) {
+        return dimension;
+    }
+};
+
+/**
+ * @brief Base class of a column of field data, used for Insert() input and Query() output.
+ */
+class Field {
+ public:
+    Field(const std::string& name, DataType data_type) : name_(name), data_type_(data_type) {
+    }
+
+    virtual ~Field() = default;
+
+    const std::string&
+    Name() const {
+        return name_;
+    }
+
+    DataType
+    Type() const {
+        return data_type_;
+    }
+
+    /**
+     * @brief Row count of this column.
+     */
+    virtual size_t
+    Count() const = 0;
+
+ private:
+    std::string name_;
+    DataType data_type_;
+};
+
+using FieldDataPtr = std::shared_ptr<Field>;
+
+/**
+ * @brief Column of a scalar field, elements are stored contiguously.
+ */
+template <typename T, DataType Dt>
+class FieldData : public Field {
+ public:
+    using ElementType = T;
+
+    explicit FieldData(const std::string& name) : Field(name, Dt) {
+    }
+
+    FieldData(const std::string& name, const std::vector<T>& data) : Field(name, Dt), data_(data) {
+    }
+
+    FieldData(const std::string& name, std::vector<T>&& data) : Field(name, Dt), data_(std::move(data)) {
+    }
+
+    void
+    Add(const T& element) {
+        data_.push_back(element);
+    }
+
+    size_t
+    Count() const override {
+        return data_.size();
+    }
+
+    const std::vector<T>&
+    Data() const {
+        return data_;
+    }
+
+    std::vector<T>&
+    Data() {
+        return data_;
+    }
+
+ private:
+    std::vector<T> data_;
+};
+
+/**
+ * @brief Column of a vector field.
+ *
+ * All rows are stored in one flat array, row i occupies elements [i * RowWidth(), (i + 1) * RowWidth()).
+ */
+template <typename T, DataType Dt>
+class VectorFieldData : public Field {
+ public:
+    using ElementType = T;
+
+    VectorFieldData(const std::string& name, uint32_t dimension)
+        : Field(name, Dt), dimension_(dimension), row_width_(DataTypeTraits<Dt>::RowWidth(dimension)) {
+    }
+
+    VectorFieldData(const std::string& name, uint32_t dimension, std::vector<T>&& data)
+        : Field(name, Dt),
+          dimension_(dimension),
+          row_width_(DataTypeTraits<Dt>::RowWidth(dimension)),
+          data_(std::move(data)) {
+    }
+
+    /**
+     * @brief Append a vector, return false if its length doesn't match the dimension.
+     */
+    bool
+    Add(const std::vector<T>& vector) {
+        if (vector.size() != row_width_) {
+            return false;
+        }
+        data_.insert(data_.end(), vector.begin(), vector.end());
+        return true;
+    }
+
+    uint32_t
+    Dimension() const {
+        return dimension_;
+    }
+
+    /**
+     * @brief Element count of each row, equals to dimension for float vector and dimension/8 for binary vector.
+     */
+    size_t
+    RowWidth() const {
+        return row_width_;
+    }
+
+    size_t
+    Count() const override {
+        return row_width_ == 0 ? 0 : data_.size() / row_width_;
+    }
+
+    const T*
+    Row(size_t index) const {
+        return data_.data() + index * row_width_;
+    }
+
+    const std::vector<T>&
+    Data() const {
+        return data_;
+    }
+
+    std::vector<T>&
+    Data() {
+        return data_;
+    }
+
+ private:
+    uint32_t dimension_ = 0;
+    size_t row_width_ = 0;
+    std::vector<T> data_;
+};
+
+using BoolFieldData = FieldData<bool, DataType::BOOL>;
+using Int8FieldData = FieldData<int8_t, DataType::INT8>;
+using Int16FieldData = FieldData<int16_t, DataType::INT16>;
+using Int32FieldData = FieldData<int32_t, DataType::INT32>;
+using Int64FieldData = FieldData<int64_t, DataType::INT64>;
+using FloatFieldData = FieldData<float, DataType::FLOAT>;
+using DoubleFieldData = FieldData<double, DataType::DOUBLE>;
+using StringFieldData = FieldData<std::string, DataType::STRING>;
+using BinaryVecFieldData = VectorFieldData<uint8_t, DataType::BINARY_VECTOR>;
+using FloatVecFieldData = VectorFieldData<float, DataType::FLOAT_VECTOR>;
+
+}  // namespace milvus
@@ -0,0 +1,85 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace milvus {
+
+/**
+ * @brief Group commit of small concurrent inserts, see InsertOptions::SetCoalesce().
+ *
+ * The first small insert of a collection and partition opens a batch and waits up to MaxDelayUs() for other inserts
+ * with the same fields to join it. The batch is sent as one InsertRequest when the delay expires or it reaches
+ * MaxBatchRows() or MaxBatchBytes(), and each caller returns with the primary keys and errors of its own rows.
+ */
+class InsertCoalesceConfig {
+ public:
+    /**
+     * @brief Inserts with more rows are sent alone.
+     */
+    uint32_t
+    MaxCallRows() const {
+        return max_call_rows_;
+    }
+
+    void
+    SetMaxCallRows(uint32_t max_call_rows) {
+        max_call_rows_ = max_call_rows;
+    }
+
+    uint32_t
+    MaxBatchRows() const {
+        return max_batch_rows_;
+    }
+
+    void
+    SetMaxBatchRows(uint32_t max_batch_rows) {
+        max_batch_rows_ = max_batch_rows;
+    }
+
+    uint64_t
+    MaxBatchBytes() const {
+        return max_batch_bytes_;
+    }
+
+    void
+    SetMaxBatchBytes(uint64_t max_batch_bytes) {
+        max_batch_bytes_ = max_batch_bytes;
+    }
+
+    /**
+     * @brief Longest time the first insert of a batch waits for others, it bounds the latency added to an insert.
+     */
+    uint32_t
+    MaxDelayUs() const {
+        return max_delay_us_;
+    }
+
+    void
+    SetMaxDelayUs(uint32_t max_delay_us) {
+        max_delay_us_ = max_delay_us;
+    }
+
+ private:
+    uint32_t max_call_rows_ = 256;
+    uint32_t max_batch_rows_ = 8192;
+    uint64_t max_batch_bytes_ = 4 * 1024 * 1024;
+    uint32_t max_delay_us_ = 2000;
+};
+
+}  // namespace milvus
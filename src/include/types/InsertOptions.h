@@ -0,0 +1,123 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace milvus {
+
+/**
+ * @brief What Insert() does with entities whose primary key was probably inserted before.
+ */
+enum class DuplicateAction {
+    // no duplicate check
+    NONE = 0,
+    // insert all entities and report the duplicates in DmlResults::DuplicateRows()
+    REPORT,
+    // drop the duplicates before building the request and report them in DmlResults::DuplicateRows()
+    DROP,
+};
+
+/**
+ * @brief Options of Insert() for pre-flight validation, client-side shard routing, duplicate suppression and group
+ * commit.
+ */
+class InsertOptions {
+ public:
+    /**
+     * @brief Compute primary key hashes on client and fill them into the request, so the server doesn't need to.
+     * Requires the primary key field is provided by client, that is auto_id is false.
+     */
+    bool
+    ClientHashing() const {
+        return client_hashing_;
+    }
+
+    void
+    SetClientHashing(bool client_hashing) {
+        client_hashing_ = client_hashing;
+    }
+
+    /**
+     * @brief Split the entities by shard and send one request for each shard, implies ClientHashing().
+     *
+     * The insert is not atomic: if some shards fail, the other shards are still inserted, the first error is
+     * returned and DmlResults::ErrorRows() lists the rows of the failed shards, retry only those rows.
+     */
+    bool
+    GroupByShard() const {
+        return group_by_shard_;
+    }
+
+    void
+    SetGroupByShard(bool group_by_shard) {
+        group_by_shard_ = group_by_shard;
+    }
+
+    /**
+     * @brief Check the primary keys against the filter of recently inserted keys of the collection, see
+     * ConnectParam::SetDuplicateFilter(). Requires the primary key field is provided by client, that is auto_id
+     * is false. A key repeated within the same call is a duplicate too. Keys are added to the filter only after
+     * they are inserted, so a failed insert can be retried.
+     */
+    DuplicateAction
+    Duplicates() const {
+        return duplicates_;
+    }
+
+    void
+    SetDuplicates(DuplicateAction duplicates) {
+        duplicates_ = duplicates;
+    }
+
+    /**
+     * @brief Combine this insert with concurrent small inserts into the same collection and partition, see
+     * ConnectParam::SetInsertCoalesce(). The call still returns only after its rows are inserted. Ignored with
+     * ClientHashing() or GroupByShard().
+     */
+    bool
+    Coalesce() const {
+        return coalesce_;
+    }
+
+    void
+    SetCoalesce(bool coalesce) {
+        coalesce_ = coalesce;
+    }
+
+    /**
+     * @brief Validate the columns against the cached collection schema before the request is built, see
+     * MilvusClient::ValidateInsert(). An invalid batch fails with StatusCode::InvalidAgument and its offending rows
+     * in DmlResults::ErrorRows().
+     */
+    bool
+    Validate() const {
+        return validate_;
+    }
+
+    void
+    SetValidate(bool validate) {
+        validate_ = validate;
+    }
+
+ private:
+    bool validate_ = false;
+    bool client_hashing_ = false;
+    bool group_by_shard_ = false;
+    DuplicateAction duplicates_ = DuplicateAction::NONE;
+    bool coalesce_ = false;
+};
+
+}  // namespace milvus
@@ -0,0 +1,110 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DmlResults.h"
+#include "FieldData.h"
+
+namespace milvus {
+
+class LazyResponse;
+
+/**
+ * @brief Query results decoded on demand from the received buffer. Only the column names are read eagerly, a column
+ * is decoded when it is first accessed and cached after that. Safe to be read by multiple threads.
+ */
+class LazyQueryResults {
+ public:
+    LazyQueryResults() = default;
+
+    explicit LazyQueryResults(std::shared_ptr<LazyResponse> response) : response_(std::move(response)) {
+    }
+
+    /**
+     * @brief Names of the output fields in the results.
+     */
+    std::vector<std::string>
+    FieldNames() const;
+
+    /**
+     * @brief Decode a column by field name, return nullptr if the field is not in the results.
+     */
+    FieldDataPtr
+    GetFieldByName(const std::string& name) const;
+
+ private:
+    std::shared_ptr<LazyResponse> response_;
+};
+
+/**
+ * @brief Search results decoded on demand from the received buffer.
+ *
+ * Hits of all target vectors are stored back to back, hits of target i start at HitOffset(i) and the count is
+ * TopKs()[i]. Scores are read in place from the received buffer, ids and output field columns are decoded when
+ * first accessed. Safe to be read by multiple threads.
+ */
+class LazySearchResults {
+ public:
+    LazySearchResults() = default;
+
+    explicit LazySearchResults(std::shared_ptr<LazyResponse> response) : response_(std::move(response)) {
+    }
+
+    int64_t
+    NumQueries() const;
+
+    /**
+     * @brief Hit count of each target vector.
+     */
+    const std::vector<int64_t>&
+    TopKs() const;
+
+    size_t
+    HitOffset(size_t query) const;
+
+    size_t
+    ScoreCount() const;
+
+    float
+    Score(size_t index) const;
+
+    /**
+     * @brief Primary keys of all hits.
+     */
+    const IDArray&
+    Ids() const;
+
+    std::vector<std::string>
+    FieldNames() const;
+
+    /**
+     * @brief Decode a column by field name, row i belongs to hit i, return nullptr if the field is not in the
+     * results.
+     */
+    FieldDataPtr
+    GetFieldByName(const std::string& name) const;
+
+ private:
+    std::shared_ptr<LazyResponse> response_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,86 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace milvus {
+
+/**
+ * @brief Budget of the memory held by in-flight requests and responses of a client, counted in serialized bytes.
+ */
+class MemoryBudgetConfig {
+ public:
+    /**
+     * @brief Max bytes of in-flight payloads, 0 means no limit. A single request larger than the budget is still
+     * sent when nothing else is in flight.
+     */
+    uint64_t
+    BudgetBytes() const {
+        return budget_bytes_;
+    }
+
+    void
+    SetBudgetBytes(uint64_t budget_bytes) {
+        budget_bytes_ = budget_bytes;
+    }
+
+    /**
+     * @brief Fail with StatusCode::Throttled immediately when over budget, instead of waiting for WaitTimeoutMs().
+     */
+    bool
+    FailFast() const {
+        return fail_fast_;
+    }
+
+    void
+    SetFailFast(bool fail_fast) {
+        fail_fast_ = fail_fast;
+    }
+
+    uint32_t
+    WaitTimeoutMs() const {
+        return wait_timeout_ms_;
+    }
+
+    void
+    SetWaitTimeoutMs(uint32_t wait_timeout_ms) {
+        wait_timeout_ms_ = wait_timeout_ms;
+    }
+
+    /**
+     * @brief Bytes reserved for a query or search response before it arrives, the reservation is corrected to the
+     * actual size once the response is received.
+     */
+    uint64_t
+    QueryResponseBytes() const {
+        return query_response_bytes_;
+    }
+
+    void
+    SetQueryResponseBytes(uint64_t query_response_bytes) {
+        query_response_bytes_ = query_response_bytes;
+    }
+
+ private:
+    uint64_t budget_bytes_ = 0;
+    bool fail_fast_ = false;
+    uint32_t wait_timeout_ms_ = 10000;
+    uint64_t query_response_bytes_ = 4 * 1024 * 1024;
+};
+
+}  // namespace milvus
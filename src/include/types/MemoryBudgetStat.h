@@ -0,0 +1,84 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace milvus {
+
+/**
+ * @brief Memory usage of in-flight requests and responses of a client.
+ */
+class MemoryBudgetStat {
+ public:
+    MemoryBudgetStat() = default;
+
+    MemoryBudgetStat(uint64_t budget_bytes, uint64_t used_bytes, uint64_t peak_bytes, uint64_t wait_count,
+                     uint64_t reject_count)
+        : budget_bytes_(budget_bytes),
+          used_bytes_(used_bytes),
+          peak_bytes_(peak_bytes),
+          wait_count_(wait_count),
+          reject_count_(reject_count) {
+    }
+
+    /**
+     * @brief Configured budget, 0 means no limit.
+     */
+    uint64_t
+    BudgetBytes() const {
+        return budget_bytes_;
+    }
+
+    /**
+     * @brief Bytes currently reserved by in-flight requests and responses.
+     */
+    uint64_t
+    UsedBytes() const {
+        return used_bytes_;
+    }
+
+    uint64_t
+    PeakBytes() const {
+        return peak_bytes_;
+    }
+
+    /**
+     * @brief Number of requests that had to wait for budget.
+     */
+    uint64_t
+    WaitCount() const {
+        return wait_count_;
+    }
+
+    /**
+     * @brief Number of requests rejected for exceeding the budget.
+     */
+    uint64_t
+    RejectCount() const {
+        return reject_count_;
+    }
+
+ private:
+    uint64_t budget_bytes_ = 0;
+    uint64_t used_bytes_ = 0;
+    uint64_t peak_bytes_ = 0;
+    uint64_t wait_count_ = 0;
+    uint64_t reject_count_ = 0;
+};
+
+}  // namespace milvus
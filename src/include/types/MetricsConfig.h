@@ -0,0 +1,62 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace milvus {
+
+/**
+ * @brief Background metrics poller of the client, see ConnectParam::SetMetrics().
+ *
+ * Every IntervalMs() the system_info metrics are requested by GetServerMetrics() and kept in a ring of the last
+ * Capacity() snapshots, read them by GetMetricsHistory().
+ */
+class MetricsConfig {
+ public:
+    /**
+     * @brief Interval of the polls, the poller is disabled if it is 0, which is the default.
+     */
+    uint32_t
+    IntervalMs() const {
+        return interval_ms_;
+    }
+
+    void
+    SetIntervalMs(uint32_t interval_ms) {
+        interval_ms_ = interval_ms;
+    }
+
+    /**
+     * @brief Snapshots kept, the oldest one is dropped when a new one arrives at full capacity.
+     */
+    uint32_t
+    Capacity() const {
+        return capacity_;
+    }
+
+    void
+    SetCapacity(uint32_t capacity) {
+        capacity_ = capacity;
+    }
+
+ private:
+    uint32_t interval_ms_ = 0;
+    uint32_t capacity_ = 60;
+};
+
+}  // namespace milvus
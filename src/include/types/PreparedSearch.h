@@ -0,0 +1,47 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+namespace milvus {
+
+class SearchTemplate;
+
+/**
+ * @brief Search validated against the collection schema by PrepareSearch(). The constant part of the request is
+ * serialized once, each execution only encodes the target vectors and the guarantee timestamp.
+ * It is immutable and can be shared by threads.
+ */
+class PreparedSearch {
+ public:
+    PreparedSearch() = default;
+
+    explicit PreparedSearch(std::shared_ptr<const SearchTemplate> search_template)
+        : template_(std::move(search_template)) {
+    }
+
+    const std::shared_ptr<const SearchTemplate>&
+    Template() const {
+        return template_;
+    }
+
+ private:
+    std::shared_ptr<const SearchTemplate> template_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,115 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Arguments for Query().
+ */
+class QueryArguments {
+ public:
+    const std::string&
+    CollectionName() const {
+        return collection_name_;
+    }
+
+    void
+    SetCollectionName(const std::string& collection_name) {
+        collection_name_ = collection_name;
+    }
+
+    const std::vector<std::string>&
+    PartitionNames() const {
+        return partition_names_;
+    }
+
+    void
+    AddPartitionName(const std::string& partition_name) {
+        partition_names_.push_back(partition_name);
+    }
+
+    const std::vector<std::string>&
+    OutputFields() const {
+        return output_field_names_;
+    }
+
+    void
+    AddOutputField(const std::string& field_name) {
+        output_field_names_.push_back(field_name);
+    }
+
+    const std::string&
+    Expression() const {
+        return filter_expression_;
+    }
+
+    void
+    SetExpression(const std::string& expression) {
+        filter_expression_ = expression;
+    }
+
+    uint64_t
+    TravelTimestamp() const {
+        return travel_timestamp_;
+    }
+
+    void
+    SetTravelTimestamp(uint64_t timestamp) {
+        travel_timestamp_ = timestamp;
+    }
+
+    uint64_t
+    GuaranteeTimestamp() const {
+        return guarantee_timestamp_;
+    }
+
+    void
+    SetGuaranteeTimestamp(uint64_t timestamp) {
+        guarantee_timestamp_ = timestamp;
+    }
+
+ private:
+    /**
+     * @brief Name of the collection to query, cannot be empty.
+     */
+    std::string collection_name_;
+
+    /**
+     * @brief Partitions to query, empty means all partitions.
+     */
+    std::vector<std::string> partition_names_;
+
+    /**
+     * @brief Fields returned for each matched entity.
+     */
+    std::vector<std::string> output_field_names_;
+
+    /**
+     * @brief Boolean filter expression, for example "id in [1, 2, 3]".
+     */
+    std::string filter_expression_;
+
+    uint64_t travel_timestamp_ = 0;
+    uint64_t guarantee_timestamp_ = 0;
+};
+
+}  // namespace milvus
@@ -0,0 +1,110 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "SegmentInfo.h"
+
+namespace milvus {
+
+/**
+ * @brief A segment loaded by a query node, returned by GetQuerySegmentInfo().
+ */
+class QuerySegmentInfo {
+ public:
+    QuerySegmentInfo() = default;
+
+    QuerySegmentInfo(int64_t collection_id, int64_t partition_id, int64_t segment_id, int64_t node_id,
+                     int64_t mem_size, int64_t row_count, const std::string& index_name, int64_t index_id,
+                     SegmentState state)
+        : collection_id_(collection_id),
+          partition_id_(partition_id),
+          segment_id_(segment_id),
+          node_id_(node_id),
+          mem_size_(mem_size),
+          row_count_(row_count),
+          index_name_(index_name),
+          index_id_(index_id),
+          state_(state) {
+    }
+
+    int64_t
+    CollectionID() const {
+        return collection_id_;
+    }
+
+    int64_t
+    PartitionID() const {
+        return partition_id_;
+    }
+
+    int64_t
+    SegmentID() const {
+        return segment_id_;
+    }
+
+    /**
+     * @brief Query node holding the segment.
+     */
+    int64_t
+    NodeID() const {
+        return node_id_;
+    }
+
+    /**
+     * @brief Memory used by the segment on the query node, in bytes.
+     */
+    int64_t
+    MemSize() const {
+        return mem_size_;
+    }
+
+    int64_t
+    RowCount() const {
+        return row_count_;
+    }
+
+    const std::string&
+    IndexName() const {
+        return index_name_;
+    }
+
+    int64_t
+    IndexID() const {
+        return index_id_;
+    }
+
+    SegmentState
+    State() const {
+        return state_;
+    }
+
+ private:
+    int64_t collection_id_ = 0;
+    int64_t partition_id_ = 0;
+    int64_t segment_id_ = 0;
+    int64_t node_id_ = 0;
+    int64_t mem_size_ = 0;
+    int64_t row_count_ = 0;
+    std::string index_name_;
+    int64_t index_id_ = 0;
+    SegmentState state_ = SegmentState::UNKNOWN;
+};
+
+}  // namespace milvus
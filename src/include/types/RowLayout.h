@@ -0,0 +1,92 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "types/DataType.h"
+
+namespace milvus {
+
+/**
+ * @brief Location of one field inside a row.
+ */
+struct RowFieldLayout {
+    RowFieldLayout(const std::string& name, DataType data_type, size_t offset, uint32_t dimension)
+        : name_(name), data_type_(data_type), offset_(offset), dimension_(dimension) {
+    }
+
+    std::string name_;
+    DataType data_type_ = DataType::UNKNOWN;
+    size_t offset_ = 0;
+    uint32_t dimension_ = 0;
+};
+
+/**
+ * @brief Memory layout of row-oriented entities for InsertRows().
+ *
+ * Rows are stored contiguously with a fixed row size, typically an array of plain structs. A field is described by
+ * its byte offset in the row, the member type must be the C++ type of the data type: bool, int8_t, int16_t,
+ * int32_t, int64_t, float, double, std::string, a float array of dimension elements for float vector, or an
+ * uint8_t array of dimension/8 elements for binary vector.
+ * @code
+ *   struct Row {
+ *       int64_t id;
+ *       float embedding[768];
+ *   };
+ *
+ *   milvus::RowLayout layout(sizeof(Row));
+ *   layout.AddField("id", milvus::DataType::INT64, offsetof(Row, id));
+ *   layout.AddField("embedding", milvus::DataType::FLOAT_VECTOR, offsetof(Row, embedding), 768);
+ * @endcode
+ */
+class RowLayout {
+ public:
+    explicit RowLayout(size_t row_size) : row_size_(row_size) {
+    }
+
+    size_t
+    RowSize() const {
+        return row_size_;
+    }
+
+    const std::vector<RowFieldLayout>&
+    Fields() const {
+        return fields_;
+    }
+
+    /**
+     * @brief Add a field, the dimension is only required by vector field.
+     */
+    void
+    AddField(const std::string& name, DataType data_type, size_t offset, uint32_t dimension = 0) {
+        fields_.emplace_back(name, data_type, offset, dimension);
+    }
+
+ private:
+    /**
+     * @brief Distance in bytes between two adjacent rows.
+     */
+    size_t row_size_ = 0;
+
+    std::vector<RowFieldLayout> fields_;
+};
+
+}  // namespace milvus
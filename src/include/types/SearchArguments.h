@@ -0,0 +1,244 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FieldData.h"
+#include "VectorCache.h"
+
+namespace milvus {
+
+/**
+ * @brief Arguments for Search() and PrepareSearch().
+ */
+class SearchArguments {
+ public:
+    const std::string&
+    CollectionName() const {
+        return collection_name_;
+    }
+
+    void
+    SetCollectionName(const std::string& collection_name) {
+        collection_name_ = collection_name;
+    }
+
+    const std::vector<std::string>&
+    PartitionNames() const {
+        return partition_names_;
+    }
+
+    void
+    AddPartitionName(const std::string& partition_name) {
+        partition_names_.push_back(partition_name);
+    }
+
+    const std::vector<std::string>&
+    OutputFields() const {
+        return output_field_names_;
+    }
+
+    void
+    AddOutputField(const std::string& field_name) {
+        output_field_names_.push_back(field_name);
+    }
+
+    const std::string&
+    Expression() const {
+        return filter_expression_;
+    }
+
+    void
+    SetExpression(const std::string& expression) {
+        filter_expression_ = expression;
+    }
+
+    /**
+     * @brief Name of the vector field to search on.
+     */
+    const std::string&
+    AnnsField() const {
+        return anns_field_;
+    }
+
+    void
+    SetAnnsField(const std::string& anns_field) {
+        anns_field_ = anns_field;
+    }
+
+    /**
+     * @brief Target vectors, a FloatVecFieldData or a BinaryVecFieldData.
+     */
+    FieldDataPtr
+    TargetVectors() const {
+        return target_vectors_;
+    }
+
+    void
+    SetTargetVectors(const FieldDataPtr& target_vectors) {
+        target_vectors_ = target_vectors;
+    }
+
+    /**
+     * @brief Append a float vector, return false if its dimension differs from the previous ones or binary vectors
+     * were added before.
+     */
+    bool
+    AddTargetVector(const std::vector<float>& vector) {
+        return AddVector<FloatVecFieldData>(vector, static_cast<uint32_t>(vector.size()));
+    }
+
+    /**
+     * @brief Append a binary vector, each byte holds 8 dimensions.
+     */
+    bool
+    AddTargetVector(const std::vector<uint8_t>& vector) {
+        return AddVector<BinaryVecFieldData>(vector, static_cast<uint32_t>(vector.size() * 8));
+    }
+
+    int64_t
+    TopK() const {
+        return topk_;
+    }
+
+    void
+    SetTopK(int64_t topk) {
+        topk_ = topk;
+    }
+
+    const std::string&
+    MetricType() const {
+        return metric_type_;
+    }
+
+    void
+    SetMetricType(const std::string& metric_type) {
+        metric_type_ = metric_type;
+    }
+
+    /**
+     * @brief Index specific parameters, for example "nprobe" for IVF indexes and "ef" for HNSW.
+     */
+    const std::map<std::string, int64_t>&
+    ExtraParams() const {
+        return extra_params_;
+    }
+
+    void
+    AddExtraParam(const std::string& key, int64_t value) {
+        extra_params_[key] = value;
+    }
+
+    /**
+     * @brief Number of decimal places of the returned distances, -1 means no rounding.
+     */
+    int
+    RoundDecimal() const {
+        return round_decimal_;
+    }
+
+    void
+    SetRoundDecimal(int round_decimal) {
+        round_decimal_ = round_decimal;
+    }
+
+    uint64_t
+    TravelTimestamp() const {
+        return travel_timestamp_;
+    }
+
+    void
+    SetTravelTimestamp(uint64_t timestamp) {
+        travel_timestamp_ = timestamp;
+    }
+
+    uint64_t
+    GuaranteeTimestamp() const {
+        return guarantee_timestamp_;
+    }
+
+    void
+    SetGuaranteeTimestamp(uint64_t timestamp) {
+        guarantee_timestamp_ = timestamp;
+    }
+
+    /**
+     * @brief Refined search fetches TopK() * RefineFactor() candidates from the index, computes their exact
+     * distances to the target vectors and returns the true top-k. 0 or 1 disables refinement.
+     * The candidate vectors are fetched as an output field, the scores of a refined search are exact distances.
+     */
+    uint32_t
+    RefineFactor() const {
+        return refine_factor_;
+    }
+
+    void
+    SetRefineFactor(uint32_t refine_factor) {
+        refine_factor_ = refine_factor;
+    }
+
+    /**
+     * @brief Take the candidate vectors of a refined search from this cache instead of the search response,
+     * the vectors of cache misses are fetched by a query. Only integer primary keys are looked up.
+     */
+    const std::shared_ptr<VectorCache>&
+    RefineCache() const {
+        return refine_cache_;
+    }
+
+    void
+    SetRefineCache(const std::shared_ptr<VectorCache>& refine_cache) {
+        refine_cache_ = refine_cache;
+    }
+
+ private:
+    template <typename VectorData, typename T>
+    bool
+    AddVector(const std::vector<T>& vector, uint32_t dimension) {
+        if (target_vectors_ == nullptr) {
+            target_vectors_ = std::make_shared<VectorData>(anns_field_, dimension);
+        }
+        auto vectors = std::dynamic_pointer_cast<VectorData>(target_vectors_);
+        if (vectors == nullptr || vectors->Dimension() != dimension) {
+            return false;
+        }
+        return vectors->Add(vector);
+    }
+
+ private:
+    std::string collection_name_;
+    std::vector<std::string> partition_names_;
+    std::vector<std::string> output_field_names_;
+    std::string filter_expression_;
+    std::string anns_field_;
+    FieldDataPtr target_vectors_;
+    int64_t topk_ = 10;
+    std::string metric_type_ = "L2";
+    std::map<std::string, int64_t> extra_params_;
+    int round_decimal_ = -1;
+    uint64_t travel_timestamp_ = 0;
+    uint64_t guarantee_timestamp_ = 0;
+    uint32_t refine_factor_ = 0;
+    std::shared_ptr<VectorCache> refine_cache_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,94 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "DmlResults.h"
+#include "FieldData.h"
+
+namespace milvus {
+
+/**
+ * @brief Top-k hits of one target vector.
+ */
+class SingleResult {
+ public:
+    SingleResult() = default;
+
+    SingleResult(IDArray&& ids, std::vector<float>&& scores, std::vector<FieldDataPtr>&& output_fields)
+        : ids_(std::move(ids)), scores_(std::move(scores)), output_fields_(std::move(output_fields)) {
+    }
+
+    /**
+     * @brief Primary keys of the hits, ordered by score.
+     */
+    const IDArray&
+    Ids() const {
+        return ids_;
+    }
+
+    const std::vector<float>&
+    Scores() const {
+        return scores_;
+    }
+
+    /**
+     * @brief One column for each output field, row i belongs to hit i.
+     */
+    const std::vector<FieldDataPtr>&
+    OutputFields() const {
+        return output_fields_;
+    }
+
+    FieldDataPtr
+    GetFieldByName(const std::string& name) const {
+        for (const auto& field : output_fields_) {
+            if (field->Name() == name) {
+                return field;
+            }
+        }
+        return nullptr;
+    }
+
+ private:
+    IDArray ids_;
+    std::vector<float> scores_;
+    std::vector<FieldDataPtr> output_fields_;
+};
+
+/**
+ * @brief Results returned by Search(), one SingleResult for each target vector.
+ */
+class SearchResults {
+ public:
+    SearchResults() = default;
+
+    explicit SearchResults(std::vector<SingleResult>&& results) : results_(std::move(results)) {
+    }
+
+    const std::vector<SingleResult>&
+    Results() const {
+        return results_;
+    }
+
+ private:
+    std::vector<SingleResult> results_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,167 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "DmlResults.h"
+#include "FieldData.h"
+#include "SearchArguments.h"
+
+namespace milvus {
+
+/**
+ * @brief Arguments for TuneSearchParams().
+ */
+class SearchTuneArguments {
+ public:
+    /**
+     * @brief The search to be tuned: collection, partitions, anns field, metric type, topk, filter expression and the
+     * fixed extra params. Its target vectors are the sample of queries, output fields and refinement are ignored.
+     */
+    const SearchArguments&
+    Search() const {
+        return search_;
+    }
+
+    void
+    SetSearch(const SearchArguments& search) {
+        search_ = search;
+    }
+
+    /**
+     * @brief Index parameter to be tuned, for example "nprobe" for IVF indexes, "ef" for HNSW or "search_k" for
+     * ANNOY.
+     */
+    const std::string&
+    ParamName() const {
+        return param_name_;
+    }
+
+    void
+    SetParamName(const std::string& param_name) {
+        param_name_ = param_name;
+    }
+
+    /**
+     * @brief Values of the parameter to be tried, from the cheapest to the most expensive. If empty, a power of two
+     * sweep is used for "nprobe", "ef" and "search_k".
+     */
+    const std::vector<int64_t>&
+    Candidates() const {
+        return candidates_;
+    }
+
+    void
+    SetCandidates(const std::vector<int64_t>& candidates) {
+        candidates_ = candidates;
+    }
+
+    /**
+     * @brief Recall@k to be reached, default is 0.95.
+     */
+    double
+    TargetRecall() const {
+        return target_recall_;
+    }
+
+    void
+    SetTargetRecall(double target_recall) {
+        target_recall_ = target_recall;
+    }
+
+    /**
+     * @brief Times each query is repeated for each value to measure the latency, default is 3.
+     */
+    uint32_t
+    Rounds() const {
+        return rounds_;
+    }
+
+    void
+    SetRounds(uint32_t rounds) {
+        rounds_ = rounds;
+    }
+
+    /**
+     * @brief Try all candidates instead of stopping at the first one meeting the target recall, default is false.
+     */
+    bool
+    SweepAll() const {
+        return sweep_all_;
+    }
+
+    void
+    SetSweepAll(bool sweep_all) {
+        sweep_all_ = sweep_all;
+    }
+
+    /**
+     * @brief Vectors the ground truth is computed from. If not set, all vectors matching the filter expression are
+     * fetched from the collection, see MaxBaseVectors(). A provided sample may be a part of the collection, the tuned
+     * search is then limited to the primary keys of the sample by its filter expression.
+     */
+    const IDArray&
+    BaseIds() const {
+        return base_ids_;
+    }
+
+    const FieldDataPtr&
+    BaseVectors() const {
+        return base_vectors_;
+    }
+
+    /**
+     * @brief Set the sample of base vectors, row i of vectors, a FloatVecFieldData or a BinaryVecFieldData, belongs
+     * to ids i.
+     */
+    void
+    SetBaseVectors(const IDArray& ids, const FieldDataPtr& vectors) {
+        base_ids_ = ids;
+        base_vectors_ = vectors;
+    }
+
+    /**
+     * @brief Max number of vectors fetched from the collection when no base sample is set, default is 100000. The
+     * ground truth costs one distance for each base vector and sample query, TuneSearchParams() fails if more
+     * entities match the search, set a sample by SetBaseVectors() for a larger collection.
+     */
+    int64_t
+    MaxBaseVectors() const {
+        return max_base_vectors_;
+    }
+
+    void
+    SetMaxBaseVectors(int64_t max_base_vectors) {
+        max_base_vectors_ = max_base_vectors;
+    }
+
+ private:
+    SearchArguments search_;
+    std::string param_name_;
+    std::vector<int64_t> candidates_;
+    double target_recall_ = 0.95;
+    uint32_t rounds_ = 3;
+    bool sweep_all_ = false;
+    IDArray base_ids_;
+    FieldDataPtr base_vectors_;
+    int64_t max_base_vectors_ = 100000;
+};
+
+}  // namespace milvus
@@ -0,0 +1,118 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Recall and latency of the search with one value of the tuned parameter.
+ */
+class SearchTunePoint {
+ public:
+    SearchTunePoint() = default;
+
+    SearchTunePoint(int64_t value, double recall, double mean_ms, double p50_ms, double p90_ms, double p99_ms)
+        : value_(value), recall_(recall), mean_ms_(mean_ms), p50_ms_(p50_ms), p90_ms_(p90_ms), p99_ms_(p99_ms) {
+    }
+
+    int64_t
+    Value() const {
+        return value_;
+    }
+
+    /**
+     * @brief Mean recall@k of the sample queries.
+     */
+    double
+    Recall() const {
+        return recall_;
+    }
+
+    /**
+     * @brief Client observed latency of a single query search, in milliseconds.
+     */
+    double
+    LatencyMeanMs() const {
+        return mean_ms_;
+    }
+
+    double
+    LatencyP50Ms() const {
+        return p50_ms_;
+    }
+
+    double
+    LatencyP90Ms() const {
+        return p90_ms_;
+    }
+
+    double
+    LatencyP99Ms() const {
+        return p99_ms_;
+    }
+
+ private:
+    int64_t value_ = 0;
+    double recall_ = 0;
+    double mean_ms_ = 0;
+    double p50_ms_ = 0;
+    double p90_ms_ = 0;
+    double p99_ms_ = 0;
+};
+
+/**
+ * @brief Results returned by TuneSearchParams().
+ */
+class SearchTuneResults {
+ public:
+    SearchTuneResults() = default;
+
+    SearchTuneResults(std::vector<SearchTunePoint>&& points, size_t recommended, bool target_met)
+        : points_(std::move(points)), recommended_(recommended), target_met_(target_met) {
+    }
+
+    /**
+     * @brief Measured values, in the order they were tried.
+     */
+    const std::vector<SearchTunePoint>&
+    Points() const {
+        return points_;
+    }
+
+    /**
+     * @brief The cheapest value meeting the target recall, or the value of the best recall if none meets it.
+     */
+    const SearchTunePoint&
+    Recommended() const {
+        return points_.at(recommended_);
+    }
+
+    bool
+    TargetMet() const {
+        return target_met_;
+    }
+
+ private:
+    std::vector<SearchTunePoint> points_;
+    size_t recommended_ = 0;
+    bool target_met_ = false;
+};
+
+}  // namespace milvus
@@ -0,0 +1,97 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Task queue of a query node.
+ */
+struct TaskQueueMetrics {
+    int64_t unsolved_ = 0;
+    int64_t ready_ = 0;
+    // average time a task waits in the queue
+    double avg_latency_ms_ = 0;
+};
+
+/**
+ * @brief Metrics of one server component, fields not reported by the component are left zero.
+ */
+struct NodeMetrics {
+    int64_t node_id_ = 0;
+    // proxy, querynode, datanode, indexnode, querycoord, ...
+    std::string type_;
+    std::string name_;
+    std::string ip_;
+    bool has_error_ = false;
+    std::string error_reason_;
+    int64_t cpu_core_count_ = 0;
+    // percent of all cores
+    double cpu_usage_ = 0;
+    int64_t memory_bytes_ = 0;
+    int64_t memory_usage_bytes_ = 0;
+    int64_t disk_bytes_ = 0;
+    int64_t disk_usage_bytes_ = 0;
+    TaskQueueMetrics search_queue_;
+    TaskQueueMetrics query_queue_;
+    // ids of the nodes this node talks to
+    std::vector<int64_t> connected_;
+};
+
+/**
+ * @brief System topology returned by GetServerMetrics().
+ */
+class ServerMetrics {
+ public:
+    ServerMetrics() = default;
+
+    ServerMetrics(int64_t timestamp_ms, const std::string& component_name, std::vector<NodeMetrics>&& nodes)
+        : timestamp_ms_(timestamp_ms), component_name_(component_name), nodes_(std::move(nodes)) {
+    }
+
+    /**
+     * @brief Local time the metrics were received, milliseconds since epoch.
+     */
+    int64_t
+    TimestampMs() const {
+        return timestamp_ms_;
+    }
+
+    /**
+     * @brief Component which answered the request, normally the proxy.
+     */
+    const std::string&
+    ComponentName() const {
+        return component_name_;
+    }
+
+    const std::vector<NodeMetrics>&
+    Nodes() const {
+        return nodes_;
+    }
+
+ private:
+    int64_t timestamp_ms_ = 0;
+    std::string component_name_;
+    std::vector<NodeMetrics> nodes_;
+};
+
+}  // namespace milvus
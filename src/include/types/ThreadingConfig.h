@@ -0,0 +1,132 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Threads created by the SDK for a client and the gRPC resources of its channel.
+ */
+class ThreadingConfig {
+ public:
+    /**
+     * @brief Completion queues driving async calls, calls are spread over the queues round-robin. Default is 1.
+     */
+    uint32_t
+    CompletionQueueCount() const {
+        return completion_queue_count_;
+    }
+
+    void
+    SetCompletionQueueCount(uint32_t completion_queue_count) {
+        completion_queue_count_ = completion_queue_count;
+    }
+
+    /**
+     * @brief Threads polling each completion queue, callbacks without executor run on them. Default is 1.
+     */
+    uint32_t
+    ThreadsPerQueue() const {
+        return threads_per_queue_;
+    }
+
+    void
+    SetThreadsPerQueue(uint32_t threads_per_queue) {
+        threads_per_queue_ = threads_per_queue;
+    }
+
+    /**
+     * @brief Threads of the pool for the work of the client such as transposing the rows of InsertRows() and sending
+     * the chunks of DeleteByIds() in parallel, 0 means one per hardware thread. The pool is created by the first call
+     * needing it. Default is 0.
+     */
+    uint32_t
+    WorkerThreads() const {
+        return worker_threads_;
+    }
+
+    void
+    SetWorkerThreads(uint32_t worker_threads) {
+        worker_threads_ = worker_threads;
+    }
+
+    /**
+     * @brief CPUs the SDK threads are pinned to, empty means no pinning. Pinning is supported on Linux only.
+     */
+    const std::vector<int>&
+    CpuAffinity() const {
+        return cpu_affinity_;
+    }
+
+    void
+    SetCpuAffinity(const std::vector<int>& cpu_affinity) {
+        cpu_affinity_ = cpu_affinity;
+    }
+
+    /**
+     * @brief Pin the SDK threads to the CPUs of a NUMA node in addition to CpuAffinity(), -1 means none.
+     */
+    int
+    NumaNode() const {
+        return numa_node_;
+    }
+
+    void
+    SetNumaNode(int numa_node) {
+        numa_node_ = numa_node;
+    }
+
+    /**
+     * @brief Max threads of the gRPC resource quota of the channel, 0 means no limit.
+     */
+    uint32_t
+    QuotaMaxThreads() const {
+        return quota_max_threads_;
+    }
+
+    void
+    SetQuotaMaxThreads(uint32_t quota_max_threads) {
+        quota_max_threads_ = quota_max_threads;
+    }
+
+    /**
+     * @brief Memory of the gRPC resource quota of the channel, 0 means no limit.
+     */
+    uint64_t
+    QuotaMemoryBytes() const {
+        return quota_memory_bytes_;
+    }
+
+    void
+    SetQuotaMemoryBytes(uint64_t quota_memory_bytes) {
+        quota_memory_bytes_ = quota_memory_bytes;
+    }
+
+ private:
+    uint32_t completion_queue_count_ = 1;
+    uint32_t threads_per_queue_ = 1;
+    uint32_t worker_threads_ = 0;
+    std::vector<int> cpu_affinity_;
+    int numa_node_ = -1;
+    uint32_t quota_max_threads_ = 0;
+    uint64_t quota_memory_bytes_ = 0;
+};
+
+}  // namespace milvus
@@ -0,0 +1,101 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief One problem found by pre-flight validation, for a whole column or for some of its rows.
+ */
+class ValidationIssue {
+ public:
+    ValidationIssue(const std::string& field_name, const std::string& reason, std::vector<uint32_t>&& rows)
+        : field_name_(field_name), reason_(reason), rows_(std::move(rows)) {
+    }
+
+    /**
+     * @brief Name of the field, empty if the problem is not about one field.
+     */
+    const std::string&
+    FieldName() const {
+        return field_name_;
+    }
+
+    const std::string&
+    Reason() const {
+        return reason_;
+    }
+
+    /**
+     * @brief Offending rows in ascending order, empty if the whole column is invalid.
+     */
+    const std::vector<uint32_t>&
+    Rows() const {
+        return rows_;
+    }
+
+ private:
+    std::string field_name_;
+    std::string reason_;
+    std::vector<uint32_t> rows_;
+};
+
+/**
+ * @brief Results returned by ValidateInsert() and ValidateSearch().
+ */
+class ValidationResults {
+ public:
+    bool
+    IsValid() const {
+        return issues_.empty();
+    }
+
+    const std::vector<ValidationIssue>&
+    Issues() const {
+        return issues_;
+    }
+
+    void
+    AddIssue(ValidationIssue&& issue) {
+        issues_.emplace_back(std::move(issue));
+    }
+
+    /**
+     * @brief Union of the offending rows of all issues in ascending order. For a search the rows are the indexes
+     * of the target vectors.
+     */
+    std::vector<uint32_t>
+    ErrorRows() const {
+        std::vector<uint32_t> rows;
+        for (const auto& issue : issues_) {
+            rows.insert(rows.end(), issue.Rows().begin(), issue.Rows().end());
+        }
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+        return rows;
+    }
+
+ private:
+    std::vector<ValidationIssue> issues_;
+};
+
+}  // namespace milvus
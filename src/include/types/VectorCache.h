@@ -0,0 +1,47 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace milvus {
+
+/**
+ * @brief Application-side store of entity vectors, used by refined search to re-rank candidates without
+ * fetching their vectors from the server. Implementations must be thread safe.
+ */
+class VectorCache {
+ public:
+    virtual ~VectorCache() = default;
+
+    /**
+     * @brief Copy the float vector of the entity into vector, return false if it is not cached.
+     */
+    virtual bool
+    Get(int64_t id, std::vector<float>& vector) = 0;
+
+    /**
+     * @brief Copy the binary vector of the entity into vector, return false if it is not cached.
+     */
+    virtual bool
+    Get(int64_t /*id*/, std::vector<uint8_t>& /*vector*/) {
+        return false;
+    }
+};
+
+}  // namespace milvus
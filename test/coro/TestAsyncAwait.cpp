@@ -0,0 +1,189 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "AsyncAwait.h"
+
+class AsyncAwaitTest : public ::testing::Test {};
+
+namespace {
+
+struct Task {
+    struct promise_type {
+        Task
+        get_return_object() {
+            return {};
+        }
+        std::suspend_never
+        initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_never
+        final_suspend() noexcept {
+            return {};
+        }
+        void
+        return_void() {
+        }
+        void
+        unhandled_exception() {
+            std::terminate();
+        }
+    };
+};
+
+class QueueExecutor : public milvus::Executor {
+ public:
+    void
+    Post(std::function<void()> task) override {
+        tasks_.push_back(std::move(task));
+    }
+
+    void
+    RunAll() {
+        while (!tasks_.empty()) {
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            task();
+        }
+    }
+
+    size_t
+    Pending() const {
+        return tasks_.size();
+    }
+
+ private:
+    std::deque<std::function<void()>> tasks_;
+};
+
+class FakeHandle : public milvus::AsyncHandle {
+ public:
+    void
+    Cancel() override {
+        if (callback_) {
+            auto callback = std::move(callback_);
+            callback_ = nullptr;
+            callback(milvus::Status(milvus::StatusCode::Cancelled, "cancelled"), std::string());
+        }
+    }
+
+    milvus::AsyncCallback<std::string> callback_;
+};
+
+Task
+AwaitInto(milvus::AsyncAwaitable<std::string>& awaitable, milvus::AsyncResult<std::string>& result, bool& done) {
+    result = co_await awaitable;
+    done = true;
+}
+
+}  // namespace
+
+TEST_F(AsyncAwaitTest, CompletedInline) {
+    // a call failing at once invokes the callback inside start, the coroutine must not resume in there
+    bool returned = false;
+    milvus::AsyncAwaitable<std::string> awaitable(nullptr, [&returned](milvus::AsyncCallback<std::string> callback) {
+        callback(milvus::Status(milvus::StatusCode::NotConnected, "down"), std::string());
+        EXPECT_FALSE(returned);
+        return std::shared_ptr<milvus::AsyncHandle>();
+    });
+    milvus::AsyncResult<std::string> result;
+    bool done = false;
+    AwaitInto(awaitable, result, done);
+    EXPECT_TRUE(done);
+    EXPECT_EQ(result.status_.Code(), milvus::StatusCode::NotConnected);
+}
+
+TEST_F(AsyncAwaitTest, ResumeThroughExecutor) {
+    auto executor = std::make_shared<QueueExecutor>();
+    milvus::AsyncCallback<std::string> pending;
+    milvus::AsyncAwaitable<std::string> awaitable(executor, [&pending](milvus::AsyncCallback<std::string> callback) {
+        pending = std::move(callback);
+        return std::make_shared<FakeHandle>();
+    });
+    milvus::AsyncResult<std::string> result;
+    bool done = false;
+    AwaitInto(awaitable, result, done);
+    EXPECT_FALSE(done);
+
+    std::thread completion([&pending] { pending(milvus::Status::OK(), std::string("hit")); });
+    completion.join();
+    EXPECT_FALSE(done);
+    EXPECT_EQ(executor->Pending(), 1);
+
+    executor->RunAll();
+    EXPECT_TRUE(done);
+    EXPECT_TRUE(result.status_.IsOk());
+    EXPECT_EQ(result.result_, "hit");
+}
+
+TEST_F(AsyncAwaitTest, Cancel) {
+    auto handle = std::make_shared<FakeHandle>();
+    milvus::AsyncAwaitable<std::string> awaitable(nullptr, [handle](milvus::AsyncCallback<std::string> callback) {
+        handle->callback_ = std::move(callback);
+        return handle;
+    });
+    milvus::AsyncResult<std::string> result;
+    bool done = false;
+    AwaitInto(awaitable, result, done);
+    EXPECT_FALSE(done);
+    awaitable.Handle()->Cancel();
+    EXPECT_TRUE(done);
+    EXPECT_EQ(result.status_.Code(), milvus::StatusCode::Cancelled);
+
+    // cancelled before the await, the operation is never started
+    bool started = false;
+    milvus::AsyncAwaitable<std::string> cancelled(nullptr, [&started](milvus::AsyncCallback<std::string> /*callback*/) {
+        started = true;
+        return std::shared_ptr<milvus::AsyncHandle>();
+    });
+    cancelled.Handle()->Cancel();
+    done = false;
+    AwaitInto(cancelled, result, done);
+    EXPECT_TRUE(done);
+    EXPECT_FALSE(started);
+    EXPECT_EQ(result.status_.Code(), milvus::StatusCode::Cancelled);
+}
+
+TEST_F(AsyncAwaitTest, NotConnectedClient) {
+    auto client = milvus::MilvusClient::Create();
+    auto executor = std::make_shared<QueueExecutor>();
+    bool done = false;
+    milvus::StatusCode code = milvus::StatusCode::OK;
+    auto search = [&]() -> Task {
+        milvus::SearchArguments arguments;
+        auto result = co_await milvus::AwaitSearch(*client, arguments, executor);
+        code = result.status_.Code();
+        done = true;
+    };
+    search();
+    // completed inline, the coroutine continues without suspending
+    EXPECT_TRUE(done);
+    EXPECT_EQ(code, milvus::StatusCode::NotConnected);
+}
+
+#endif  // __cpp_impl_coroutine
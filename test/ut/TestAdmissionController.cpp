@@ -0,0 +1,105 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "AdmissionController.h"
+
+using milvus::AdmissionConfig;
+using milvus::AdmissionController;
+using milvus::RequestClass;
+
+class AdmissionControllerTest : public ::testing::Test {};
+
+TEST_F(AdmissionControllerTest, ClassConcurrency) {
+    AdmissionConfig config;
+    config.SetQueueTimeoutMs(20);
+    config.SetLimit(RequestClass::INSERT, milvus::ClassLimit(1, 0, 1));
+    AdmissionController controller(config);
+
+    EXPECT_TRUE(controller.Acquire(RequestClass::INSERT).IsOk());
+    auto status = controller.Acquire(RequestClass::INSERT);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::Throttled);
+    EXPECT_TRUE(controller.Acquire(RequestClass::SEARCH).IsOk());
+    EXPECT_EQ(controller.InFlight(), 2);
+
+    controller.Release(RequestClass::INSERT, std::chrono::milliseconds(1), true);
+    EXPECT_TRUE(controller.Acquire(RequestClass::INSERT).IsOk());
+}
+
+TEST_F(AdmissionControllerTest, PriorityOrder) {
+    AdmissionConfig config;
+    config.SetMaxConcurrency(1);
+    AdmissionController controller(config);
+    ASSERT_TRUE(controller.Acquire(RequestClass::ADMIN).IsOk());
+
+    std::mutex mutex;
+    std::vector<RequestClass> order;
+    auto worker = [&](RequestClass request_class) {
+        EXPECT_TRUE(controller.Acquire(request_class).IsOk());
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(request_class);
+        }
+        controller.Release(request_class, std::chrono::milliseconds(1), true);
+    };
+    std::thread insert(worker, RequestClass::INSERT);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::thread search(worker, RequestClass::SEARCH);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    controller.Release(RequestClass::ADMIN, std::chrono::milliseconds(1), true);
+    insert.join();
+    search.join();
+    EXPECT_EQ(order, (std::vector<RequestClass>{RequestClass::SEARCH, RequestClass::INSERT}));
+}
+
+TEST_F(AdmissionControllerTest, RateLimit) {
+    AdmissionConfig config;
+    config.SetLimit(RequestClass::QUERY, milvus::ClassLimit(0, 20, 1));
+    AdmissionController controller(config);
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(controller.Acquire(RequestClass::QUERY).IsOk());
+    EXPECT_TRUE(controller.Acquire(RequestClass::QUERY).IsOk());
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed, std::chrono::milliseconds(40));
+}
+
+TEST_F(AdmissionControllerTest, AdaptiveConcurrency) {
+    AdmissionConfig config;
+    config.SetMaxConcurrency(8);
+    config.SetMinConcurrency(2);
+    config.SetAdaptiveConcurrency(true);
+    config.SetLatencyThresholdMs(100);
+    AdmissionController controller(config);
+    EXPECT_DOUBLE_EQ(controller.ConcurrencyLimit(), 8);
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(controller.Acquire(RequestClass::SEARCH).IsOk());
+    }
+    controller.Release(RequestClass::SEARCH, std::chrono::milliseconds(1), false);
+    EXPECT_DOUBLE_EQ(controller.ConcurrencyLimit(), 4);
+    // backoff once per threshold interval
+    controller.Release(RequestClass::SEARCH, std::chrono::milliseconds(500), true);
+    EXPECT_DOUBLE_EQ(controller.ConcurrencyLimit(), 4);
+    controller.Release(RequestClass::SEARCH, std::chrono::milliseconds(1), true);
+    EXPECT_DOUBLE_EQ(controller.ConcurrencyLimit(), 4.25);
+}
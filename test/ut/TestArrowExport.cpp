@@ -0,0 +1,146 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ArrowExport.h"
+
+class ArrowExportTest : public ::testing::Test {};
+
+TEST_F(ArrowExportTest, QueryResults) {
+    auto ids = std::make_shared<milvus::Int64FieldData>("id", std::vector<int64_t>{1, 2, 3});
+    auto flags = std::make_shared<milvus::BoolFieldData>("flag", std::vector<bool>{true, false, true});
+    auto names = std::make_shared<milvus::StringFieldData>("name", std::vector<std::string>{"a", "", "xyz"});
+    auto vectors = std::make_shared<milvus::FloatVecFieldData>("vec", 2);
+    vectors->Add({1, 2});
+    vectors->Add({3, 4});
+    vectors->Add({5, 6});
+    auto bits = std::make_shared<milvus::BinaryVecFieldData>("bits", 16);
+    bits->Add({1, 2});
+    bits->Add({3, 4});
+    bits->Add({5, 6});
+    const void* id_buffer = ids->Data().data();
+    const void* vector_buffer = vectors->Data().data();
+
+    ArrowSchema schema;
+    ArrowArray array;
+    {
+        milvus::QueryResults results({ids, flags, names, vectors, bits});
+        ids.reset();
+        vectors.reset();
+        ASSERT_TRUE(milvus::ExportArrow(results, &schema, &array).IsOk());
+    }
+
+    EXPECT_STREQ(schema.format, "+s");
+    ASSERT_EQ(schema.n_children, 5);
+    EXPECT_EQ(array.length, 3);
+    ASSERT_EQ(array.n_children, 5);
+
+    EXPECT_STREQ(schema.children[0]->format, "l");
+    EXPECT_STREQ(schema.children[0]->name, "id");
+    EXPECT_EQ(array.children[0]->buffers[1], id_buffer);
+    EXPECT_EQ(static_cast<const int64_t*>(array.children[0]->buffers[1])[2], 3);
+
+    EXPECT_STREQ(schema.children[1]->format, "b");
+    EXPECT_EQ(static_cast<const uint8_t*>(array.children[1]->buffers[1])[0], 0x05);
+
+    EXPECT_STREQ(schema.children[2]->format, "u");
+    ASSERT_EQ(array.children[2]->n_buffers, 3);
+    const auto offsets = static_cast<const int32_t*>(array.children[2]->buffers[1]);
+    EXPECT_EQ(offsets[0], 0);
+    EXPECT_EQ(offsets[2], 1);
+    EXPECT_EQ(offsets[3], 4);
+    EXPECT_EQ(std::memcmp(array.children[2]->buffers[2], "axyz", 4), 0);
+
+    EXPECT_STREQ(schema.children[3]->format, "+w:2");
+    ASSERT_EQ(array.children[3]->n_children, 1);
+    EXPECT_STREQ(schema.children[3]->children[0]->format, "f");
+    EXPECT_EQ(array.children[3]->children[0]->length, 6);
+    EXPECT_EQ(array.children[3]->children[0]->buffers[1], vector_buffer);
+    EXPECT_EQ(static_cast<const float*>(array.children[3]->children[0]->buffers[1])[5], 6);
+
+    EXPECT_STREQ(schema.children[4]->format, "w:2");
+    EXPECT_EQ(static_cast<const uint8_t*>(array.children[4]->buffers[1])[4], 5);
+
+    array.release(&array);
+    schema.release(&schema);
+    EXPECT_EQ(array.release, nullptr);
+    EXPECT_EQ(schema.release, nullptr);
+}
+
+TEST_F(ArrowExportTest, MovedChild) {
+    milvus::QueryResults results({std::make_shared<milvus::DoubleFieldData>("value", std::vector<double>{0.5, 1.5})});
+    ArrowSchema schema;
+    ArrowArray array;
+    ASSERT_TRUE(milvus::ExportArrow(results, &schema, &array).IsOk());
+
+    // a consumer moves the child out, releases it first and the parent later
+    ArrowArray child = *array.children[0];
+    array.children[0]->release = nullptr;
+    EXPECT_EQ(static_cast<const double*>(child.buffers[1])[1], 1.5);
+    child.release(&child);
+    array.release(&array);
+    schema.release(&schema);
+}
+
+TEST_F(ArrowExportTest, MovedVectorChild) {
+    ArrowSchema schema;
+    ArrowArray array;
+    {
+        auto vectors = std::make_shared<milvus::FloatVecFieldData>("vec", 2);
+        vectors->Add({1, 2});
+        vectors->Add({3, 4});
+        milvus::QueryResults results({vectors});
+        ASSERT_TRUE(milvus::ExportArrow(results, &schema, &array).IsOk());
+    }
+
+    // a consumer moves the items out of the vector column and releases the parents before the items
+    ArrowArray items = *array.children[0]->children[0];
+    array.children[0]->children[0]->release = nullptr;
+    array.release(&array);
+    schema.release(&schema);
+    EXPECT_EQ(items.length, 4);
+    EXPECT_EQ(static_cast<const float*>(items.buffers[1])[3], 4);
+    items.release(&items);
+    EXPECT_EQ(items.release, nullptr);
+}
+
+TEST_F(ArrowExportTest, SingleResult) {
+    std::vector<milvus::FieldDataPtr> output_fields{
+        std::make_shared<milvus::Int32FieldData>("age", std::vector<int32_t>{30, 40})};
+    milvus::SingleResult result(milvus::IDArray(std::vector<std::string>{"a", "b"}), {0.1f, 0.2f},
+                                std::move(output_fields));
+    ArrowSchema schema;
+    ArrowArray array;
+    ASSERT_TRUE(milvus::ExportArrow(result, &schema, &array).IsOk());
+    ASSERT_EQ(schema.n_children, 3);
+    EXPECT_STREQ(schema.children[0]->format, "u");
+    EXPECT_STREQ(schema.children[1]->format, "f");
+    EXPECT_STREQ(schema.children[1]->name, "score");
+    EXPECT_STREQ(schema.children[2]->format, "i");
+    EXPECT_EQ(array.length, 2);
+    array.release(&array);
+    schema.release(&schema);
+
+    milvus::SingleResult mismatched(milvus::IDArray(std::vector<int64_t>{1, 2}), {0.1f}, {});
+    EXPECT_FALSE(milvus::ExportArrow(mismatched, &schema, &array).IsOk());
+}
@@ -0,0 +1,203 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <arpa/inet.h>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "MilvusClient.h"
+
+namespace {
+
+/**
+ * @brief Executor queueing the tasks until the test runs them, like an event loop.
+ */
+class QueueExecutor : public milvus::Executor {
+ public:
+    void
+    Post(std::function<void()> task) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+        cond_.notify_all();
+    }
+
+    bool
+    RunOne(std::chrono::milliseconds timeout) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (!cond_.wait_for(lock, timeout, [this] { return !tasks_.empty(); })) {
+                return false;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+        return true;
+    }
+
+    size_t
+    Size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return tasks_.size();
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<std::function<void()>> tasks_;
+};
+
+/**
+ * @brief TCP port accepting connections but never speaking HTTP/2, calls to it stay in flight.
+ */
+class SilentListener {
+ public:
+    SilentListener() {
+        fd_ = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        bind(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        listen(fd_, 16);
+        socklen_t length = sizeof(addr);
+        getsockname(fd_, reinterpret_cast<sockaddr*>(&addr), &length);
+        port_ = ntohs(addr.sin_port);
+    }
+
+    ~SilentListener() {
+        close(fd_);
+    }
+
+    uint16_t
+    Port() const {
+        return port_;
+    }
+
+ private:
+    int fd_ = -1;
+    uint16_t port_ = 0;
+};
+
+milvus::QueryArguments
+TestQuery() {
+    milvus::QueryArguments arguments;
+    arguments.SetCollectionName("test");
+    arguments.SetExpression("id > 0");
+    return arguments;
+}
+
+}  // namespace
+
+class AsyncCallTest : public ::testing::Test {};
+
+TEST_F(AsyncCallTest, NotConnected) {
+    auto client = milvus::MilvusClient::Create();
+    auto executor = std::make_shared<QueueExecutor>();
+    milvus::Status result;
+    auto handle = client->QueryAsync(TestQuery(), executor,
+                                     [&result](const milvus::Status& status, milvus::QueryResults&&) {
+                                         result = status;
+                                     });
+    EXPECT_EQ(handle, nullptr);
+    ASSERT_TRUE(executor->RunOne(std::chrono::milliseconds(0)));
+    EXPECT_EQ(result.Code(), milvus::StatusCode::NotConnected);
+}
+
+TEST_F(AsyncCallTest, CancelResumesOnExecutor) {
+    SilentListener listener;
+    auto client = milvus::MilvusClient::Create();
+    milvus::ConnectParam connect_param("127.0.0.1", listener.Port());
+    connect_param.SetShareChannel(false);
+    ASSERT_TRUE(client->Connect(connect_param).IsOk());
+
+    auto executor = std::make_shared<QueueExecutor>();
+    milvus::Status result;
+    std::thread::id callback_thread;
+    auto handle = client->DescribeCollectionAsync(
+        "test", executor, [&result, &callback_thread](const milvus::Status& status, milvus::CollectionDesc&&) {
+            result = status;
+            callback_thread = std::this_thread::get_id();
+        });
+    ASSERT_NE(handle, nullptr);
+
+    // still in flight, nothing is posted
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(executor->Size(), 0);
+
+    handle->Cancel();
+    ASSERT_TRUE(executor->RunOne(std::chrono::seconds(5)));
+    EXPECT_EQ(result.Code(), milvus::StatusCode::Cancelled);
+    EXPECT_EQ(callback_thread, std::this_thread::get_id());
+
+    // cancelling a completed call does nothing
+    handle->Cancel();
+}
+
+TEST_F(AsyncCallTest, DisconnectCancelsInFlight) {
+    SilentListener listener;
+    auto client = milvus::MilvusClient::Create();
+    milvus::ConnectParam connect_param("127.0.0.1", listener.Port());
+    connect_param.SetShareChannel(false);
+    ASSERT_TRUE(client->Connect(connect_param).IsOk());
+
+    int cancelled = 0;
+    auto callback = [&cancelled](const milvus::Status& status, milvus::QueryResults&&) {
+        if (status.Code() == milvus::StatusCode::Cancelled) {
+            ++cancelled;
+        }
+    };
+    // without executor the callbacks run on the completion thread, Disconnect() waits for them
+    client->QueryAsync(TestQuery(), nullptr, callback);
+    client->QueryAsync(TestQuery(), nullptr, callback);
+    client->Disconnect();
+    EXPECT_EQ(cancelled, 2);
+}
+
+TEST_F(AsyncCallTest, ThrottledWithoutWaiting) {
+    SilentListener listener;
+    auto client = milvus::MilvusClient::Create();
+    milvus::ConnectParam connect_param("127.0.0.1", listener.Port());
+    connect_param.SetShareChannel(false);
+    milvus::AdmissionConfig admission;
+    admission.SetEnabled(true);
+    admission.SetLimit(milvus::RequestClass::QUERY, milvus::ClassLimit(1, 0, 0));
+    connect_param.SetAdmission(admission);
+    ASSERT_TRUE(client->Connect(connect_param).IsOk());
+
+    auto executor = std::make_shared<QueueExecutor>();
+    std::vector<milvus::StatusCode> codes;
+    auto callback = [&codes](const milvus::Status& status, milvus::QueryResults&&) { codes.push_back(status.Code()); };
+    auto first = client->QueryAsync(TestQuery(), executor, callback);
+    auto second = client->QueryAsync(TestQuery(), executor, callback);
+    EXPECT_NE(first, nullptr);
+    EXPECT_EQ(second, nullptr);
+
+    ASSERT_TRUE(executor->RunOne(std::chrono::seconds(5)));
+    first->Cancel();
+    ASSERT_TRUE(executor->RunOne(std::chrono::seconds(5)));
+    ASSERT_EQ(codes.size(), 2);
+    EXPECT_EQ(codes[0], milvus::StatusCode::Throttled);
+    EXPECT_EQ(codes[1], milvus::StatusCode::Cancelled);
+}
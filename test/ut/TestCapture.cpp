@@ -0,0 +1,195 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <thread>
+
+#include "CaptureLog.h"
+#include "MilvusClient.h"
+#include "milvus.pb.h"
+
+namespace {
+
+std::string
+TempLog(const std::string& name) {
+    auto path = ::testing::TempDir() + name;
+    std::remove(path.c_str());
+    return path;
+}
+
+std::vector<milvus::CaptureRecord>
+ReadAll(const std::string& path, milvus::Status& status) {
+    std::vector<milvus::CaptureRecord> records;
+    milvus::CaptureReader reader;
+    status = reader.Open(path);
+    while (status.IsOk()) {
+        milvus::CaptureRecord record;
+        bool end = false;
+        status = reader.Next(record, end);
+        if (!status.IsOk() || end) {
+            break;
+        }
+        records.push_back(record);
+    }
+    return records;
+}
+
+}  // namespace
+
+class CaptureTest : public ::testing::Test {};
+
+TEST_F(CaptureTest, WriteAndRead) {
+    milvus::CaptureConfig config;
+    config.SetPath(TempLog("capture_write_read.log"));
+    {
+        std::shared_ptr<milvus::CaptureWriter> writer;
+        ASSERT_TRUE(milvus::CaptureWriter::Open(config, writer).IsOk());
+
+        milvus::proto::milvus::QueryRequest query;
+        query.set_expr("id in [1,2]");
+        writer->Record("/svc/Query", query);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        grpc::Slice slice(std::string("raw request"));
+        grpc::ByteBuffer buffer(&slice, 1);
+        writer->Record("/svc/Search", buffer);
+        writer->Record("/svc/Query", query);
+        EXPECT_EQ(writer->RecordCount(), 3);
+    }
+
+    milvus::Status status;
+    auto records = ReadAll(config.Path(), status);
+    ASSERT_TRUE(status.IsOk());
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[0].Method(), "/svc/Query");
+    EXPECT_EQ(records[1].Method(), "/svc/Search");
+    EXPECT_EQ(records[2].Method(), "/svc/Query");
+    EXPECT_EQ(records[1].Payload(), "raw request");
+    EXPECT_GE(records[1].OffsetUs(), records[0].OffsetUs() + 5000);
+    EXPECT_GE(records[2].OffsetUs(), records[1].OffsetUs());
+
+    milvus::proto::milvus::QueryRequest query;
+    ASSERT_TRUE(query.ParseFromString(records[2].Payload()));
+    EXPECT_EQ(query.expr(), "id in [1,2]");
+}
+
+TEST_F(CaptureTest, SessionsAppend) {
+    milvus::CaptureConfig config;
+    config.SetPath(TempLog("capture_sessions.log"));
+    milvus::proto::milvus::QueryRequest query;
+    for (int session = 0; session < 2; ++session) {
+        std::shared_ptr<milvus::CaptureWriter> writer;
+        ASSERT_TRUE(milvus::CaptureWriter::Open(config, writer).IsOk());
+        // method ids restart in each session
+        writer->Record(session == 0 ? "/svc/A" : "/svc/B", query);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        writer->Record("/svc/C", query);
+    }
+
+    milvus::Status status;
+    auto records = ReadAll(config.Path(), status);
+    ASSERT_TRUE(status.IsOk());
+    ASSERT_EQ(records.size(), 4);
+    EXPECT_EQ(records[0].Method(), "/svc/A");
+    EXPECT_EQ(records[2].Method(), "/svc/B");
+    EXPECT_EQ(records[3].Method(), "/svc/C");
+    EXPECT_GE(records[3].OffsetUs(), 4000);
+}
+
+TEST_F(CaptureTest, SamplingAndLimit) {
+    milvus::proto::milvus::QueryRequest query;
+    query.set_expr(std::string(100, 'x'));
+
+    milvus::CaptureConfig config;
+    config.SetPath(TempLog("capture_sampling.log"));
+    config.SetSampleRatio(0.25);
+    {
+        std::shared_ptr<milvus::CaptureWriter> writer;
+        ASSERT_TRUE(milvus::CaptureWriter::Open(config, writer).IsOk());
+        for (int i = 0; i < 100; ++i) {
+            writer->Record("/svc/Query", query);
+        }
+        EXPECT_EQ(writer->RecordCount(), 25);
+    }
+
+    config.SetPath(TempLog("capture_limit.log"));
+    config.SetSampleRatio(1);
+    config.SetMaxFileBytes(1000);
+    {
+        std::shared_ptr<milvus::CaptureWriter> writer;
+        ASSERT_TRUE(milvus::CaptureWriter::Open(config, writer).IsOk());
+        for (int i = 0; i < 100; ++i) {
+            writer->Record("/svc/Query", query);
+        }
+        EXPECT_GT(writer->RecordCount(), 0);
+        EXPECT_LT(writer->RecordCount(), 10);
+    }
+    milvus::Status status;
+    ReadAll(config.Path(), status);
+    EXPECT_TRUE(status.IsOk());
+}
+
+TEST_F(CaptureTest, Corrupted) {
+    auto path = TempLog("capture_corrupted.log");
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    std::fputs("Rgarbage", file);
+    std::fclose(file);
+
+    milvus::Status status;
+    auto records = ReadAll(path, status);
+    EXPECT_TRUE(records.empty());
+    EXPECT_FALSE(status.IsOk());
+
+    ReadAll(TempLog("capture_missing.log"), status);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::InvalidAgument);
+}
+
+TEST_F(CaptureTest, ClientCaptureAndReplay) {
+    milvus::CaptureConfig capture;
+    capture.SetPath(TempLog("capture_client.log"));
+    {
+        // nothing listens on port 1, the requests fail but are recorded
+        auto client = milvus::MilvusClient::Create();
+        milvus::ConnectParam connect_param("127.0.0.1", 1);
+        connect_param.SetShareChannel(false);
+        connect_param.SetCapture(capture);
+        ASSERT_TRUE(client->Connect(connect_param).IsOk());
+
+        milvus::QueryArguments arguments;
+        arguments.SetCollectionName("test");
+        arguments.SetExpression("id > 0");
+        milvus::QueryResults results;
+        client->Query(arguments, results);
+        client->Query(arguments, results);
+    }
+
+    milvus::Status status;
+    auto records = ReadAll(capture.Path(), status);
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].Method(), "/milvus.proto.milvus.MilvusService/Query");
+    milvus::proto::milvus::QueryRequest query;
+    ASSERT_TRUE(query.ParseFromString(records[0].Payload()));
+    EXPECT_EQ(query.expr(), "id > 0");
+
+    milvus::ReplayOptions options;
+    options.SetSpeed(0);
+    milvus::ReplayStats stats;
+    EXPECT_TRUE(milvus::ReplayCapture(capture.Path(), "127.0.0.1", 1, options, stats).IsOk());
+    EXPECT_EQ(stats.Requests(), 2);
+    EXPECT_EQ(stats.Failures(), 2);
+}
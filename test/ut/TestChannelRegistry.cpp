@@ -0,0 +1,78 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "ChannelRegistry.h"
+
+class ChannelRegistryTest : public ::testing::Test {};
+
+TEST_F(ChannelRegistryTest, ShareByKey) {
+    milvus::ChannelRegistry registry(false);
+    milvus::ChannelArgs args;
+    args.SetInt("grpc.max_send_message_length", -1);
+    const auto timeout = std::chrono::milliseconds(0);
+
+    auto first = registry.Acquire("localhost:19530", args, timeout);
+    auto second = registry.Acquire("localhost:19530", args, timeout);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(registry.ChannelCount(), 1);
+
+    auto other_target = registry.Acquire("localhost:19531", args, timeout);
+    milvus::ChannelArgs other_args;
+    other_args.SetInt("grpc.max_send_message_length", 1024);
+    auto other_settings = registry.Acquire("localhost:19530", other_args, timeout);
+    EXPECT_NE(other_target.get(), first.get());
+    EXPECT_NE(other_settings.get(), first.get());
+    EXPECT_EQ(registry.ChannelCount(), 3);
+}
+
+TEST_F(ChannelRegistryTest, ResourceQuotaInKey) {
+    milvus::ChannelArgs args;
+    const auto key = args.Key("localhost:19530");
+    args.SetResourceQuota(4, 0);
+    EXPECT_NE(args.Key("localhost:19530"), key);
+
+    milvus::ChannelArgs memory_args;
+    memory_args.SetResourceQuota(0, 64 * 1024 * 1024);
+    EXPECT_NE(memory_args.Key("localhost:19530"), args.Key("localhost:19530"));
+    EXPECT_NE(milvus::CreateChannel("localhost:19530", memory_args), nullptr);
+}
+
+TEST_F(ChannelRegistryTest, CloseIdle) {
+    milvus::ChannelRegistry registry(false);
+    milvus::ChannelArgs args;
+
+    auto lease = registry.Acquire("localhost:19530", args, std::chrono::milliseconds(20));
+    auto copy = lease;
+    auto channel = lease.get();
+    lease.reset();
+    registry.CloseExpired();
+    EXPECT_EQ(registry.ChannelCount(), 1);
+
+    // idle but not expired, acquired again
+    copy.reset();
+    auto again = registry.Acquire("localhost:19530", args, std::chrono::milliseconds(20));
+    EXPECT_EQ(again.get(), channel);
+
+    again.reset();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    registry.CloseExpired();
+    EXPECT_EQ(registry.ChannelCount(), 0);
+}
@@ -0,0 +1,138 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CompactionScheduler.h"
+
+class CompactionSchedulerTest : public ::testing::Test {};
+
+namespace {
+
+std::vector<milvus::SegmentInfo>
+MakeSegments(const std::vector<int64_t>& row_counts) {
+    std::vector<milvus::SegmentInfo> segments;
+    for (size_t i = 0; i < row_counts.size(); ++i) {
+        segments.emplace_back(1, 2, static_cast<int64_t>(i), row_counts[i], milvus::SegmentState::FLUSHED);
+    }
+    return segments;
+}
+
+}  // namespace
+
+TEST_F(CompactionSchedulerTest, Advise) {
+    milvus::CompactionConfig config;
+    config.SetDeleteRatio(0.2);
+    config.SetSmallSegmentRows(100);
+    config.SetSmallSegmentCount(3);
+
+    auto segments = MakeSegments({1000, 1000, 50});
+    segments.emplace_back(1, 2, 9, 10, milvus::SegmentState::GROWING);
+    auto summary = milvus::SummarizeSegments(segments, config.SmallSegmentRows());
+    EXPECT_EQ(summary.segment_count_, 3);
+    EXPECT_EQ(summary.row_count_, 2050);
+    EXPECT_EQ(summary.small_segment_count_, 1);
+
+    EXPECT_TRUE(milvus::AdviseCompaction(config, summary, 100).empty());
+    EXPECT_EQ(milvus::AdviseCompaction(config, summary, 500), "deleted rows 24% of 2050");
+
+    summary = milvus::SummarizeSegments(MakeSegments({10, 20, 30, 1000}), config.SmallSegmentRows());
+    EXPECT_EQ(milvus::AdviseCompaction(config, summary, 0), "3 segments smaller than 100 rows");
+}
+
+TEST_F(CompactionSchedulerTest, MaintenanceWindow) {
+    milvus::CompactionConfig config;
+    EXPECT_EQ(milvus::MaintenanceWindow(config, 100, 0), 100);
+
+    config.SetMaintenanceWindow(60, 300);
+    EXPECT_EQ(milvus::MaintenanceWindow(config, 100, 59), -1);
+    EXPECT_EQ(milvus::MaintenanceWindow(config, 100, 60), 100);
+    EXPECT_EQ(milvus::MaintenanceWindow(config, 100, 300), -1);
+
+    // 22:00 to 02:00
+    config.SetMaintenanceWindow(22 * 60, 2 * 60);
+    EXPECT_EQ(milvus::MaintenanceWindow(config, 100, 23 * 60), 100);
+    EXPECT_EQ(milvus::MaintenanceWindow(config, 101, 60), 100);
+    EXPECT_EQ(milvus::MaintenanceWindow(config, 101, 12 * 60), -1);
+}
+
+TEST_F(CompactionSchedulerTest, CompactAndReport) {
+    milvus::CompactionConfig config;
+    config.AddCollection("a");
+    config.AddCollection("b");
+    config.SetBudget(1);
+
+    std::vector<int64_t> rows{1000, 1000};
+    int64_t next_id = 10;
+    std::vector<std::string> compacted;
+    milvus::CompactionState state = milvus::CompactionState::EXECUTING;
+    milvus::CompactionScheduler scheduler(
+        config,
+        [&rows](const std::string&, std::vector<milvus::SegmentInfo>& segments) {
+            segments = MakeSegments(rows);
+            return milvus::Status::OK();
+        },
+        [&](const std::string& collection_name, int64_t& compaction_id) {
+            compacted.push_back(collection_name);
+            compaction_id = next_id++;
+            return milvus::Status::OK();
+        },
+        [&state](int64_t, milvus::CompactionProgress& progress) {
+            progress = milvus::CompactionProgress(state, 1, 0, 0);
+            return milvus::Status::OK();
+        });
+
+    const auto now = milvus::CompactionScheduler::Clock::now();
+    scheduler.Check(now);
+    EXPECT_TRUE(compacted.empty());
+
+    scheduler.RecordMutation("a", 2000, 100);
+    scheduler.Check(now);
+    EXPECT_TRUE(compacted.empty());
+
+    scheduler.RecordMutation("a", 0, 400);
+    scheduler.RecordMutation("b", 0, 1000);
+    scheduler.Check(now);
+    // the budget of the window allows one compaction
+    ASSERT_EQ(compacted, (std::vector<std::string>{"a"}));
+
+    scheduler.Poll(now);
+    auto reports = scheduler.Reports();
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_EQ(reports[0].CollectionName(), "a");
+    EXPECT_EQ(reports[0].CompactionID(), 10);
+    EXPECT_EQ(reports[0].State(), milvus::CompactionState::EXECUTING);
+    EXPECT_EQ(reports[0].Before().segment_count_, 2);
+    EXPECT_EQ(reports[0].Before().row_count_, 2000);
+
+    rows = {1500};
+    state = milvus::CompactionState::COMPLETED;
+    scheduler.Poll(now);
+    reports = scheduler.Reports();
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_EQ(reports[0].State(), milvus::CompactionState::COMPLETED);
+    EXPECT_EQ(reports[0].After().segment_count_, 1);
+    EXPECT_EQ(reports[0].After().row_count_, 1500);
+    EXPECT_GT(reports[0].EndTimeMs(), 0);
+
+    // the deletes of "a" are compacted, "b" waits for the next window
+    scheduler.Check(now);
+    EXPECT_EQ(compacted.size(), 1);
+}
@@ -0,0 +1,191 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DuplicateFilter.h"
+
+class DuplicateFilterTest : public ::testing::Test {};
+
+namespace {
+
+std::string
+TempFilter(const std::string& name) {
+    auto path = ::testing::TempDir() + name;
+    std::remove(path.c_str());
+    return path;
+}
+
+std::vector<int64_t>
+KeyRange(int64_t begin, int64_t end) {
+    std::vector<int64_t> keys;
+    for (int64_t key = begin; key < end; ++key) {
+        keys.push_back(key);
+    }
+    return keys;
+}
+
+}  // namespace
+
+TEST_F(DuplicateFilterTest, NoFalseNegatives) {
+    // grows past the initial capacity several times
+    milvus::DuplicateFilter filter(1000, 0.01);
+    auto keys = KeyRange(0, 20000);
+    filter.Add(keys);
+    EXPECT_EQ(filter.FindDuplicates(keys).size(), keys.size());
+    EXPECT_LE(filter.Count(), keys.size());
+    EXPECT_GT(filter.Count(), keys.size() * 95 / 100);
+
+    // false positives stay under the configured rate
+    auto fresh = KeyRange(1000000, 1100000);
+    EXPECT_LT(filter.FindDuplicates(fresh).size(), fresh.size() / 100);
+}
+
+TEST_F(DuplicateFilterTest, MaxStages) {
+    // stages of 100, 200 and 400 keys, then each new stage of 400 keys drops the oldest one
+    milvus::DuplicateFilter filter(100, 0.001, 3);
+    filter.Add(KeyRange(0, 700));
+    const auto full_bytes = filter.MemoryBytes();
+    EXPECT_EQ(filter.FindDuplicates(KeyRange(0, 700)).size(), 700);
+
+    filter.Add(KeyRange(700, 1100));
+    EXPECT_EQ(filter.FindDuplicates(KeyRange(100, 1100)).size(), 1000);
+    // the first 100 keys aged out with the first stage, only false positives remain
+    EXPECT_LT(filter.FindDuplicates(KeyRange(0, 100)).size(), 5);
+    EXPECT_LE(filter.Count(), 1000);
+
+    filter.Add(KeyRange(1100, 5000));
+    EXPECT_EQ(filter.FindDuplicates(KeyRange(4200, 5000)).size(), 800);
+    EXPECT_LE(filter.Count(), 1200);
+    EXPECT_LE(filter.MemoryBytes(), full_bytes * 2);
+
+    // a filter saved with more stages is trimmed on load
+    auto path = TempFilter("dup_filter_stages");
+    ASSERT_TRUE(filter.Save(path).IsOk());
+    std::shared_ptr<milvus::DuplicateFilter> loaded;
+    ASSERT_TRUE(milvus::DuplicateFilter::Load(path, loaded, 1).IsOk());
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_LE(loaded->Count(), 400);
+    EXPECT_LT(loaded->MemoryBytes(), filter.MemoryBytes());
+}
+
+TEST_F(DuplicateFilterTest, DuplicatesWithinBatch) {
+    milvus::DuplicateFilter filter(100, 0.001);
+    filter.Add(std::vector<std::string>{"a", "b"});
+
+    auto duplicates = filter.FindDuplicates(std::vector<std::string>{"c", "a", "d", "c", "e"});
+    EXPECT_EQ(duplicates, (std::vector<uint32_t>{1, 3}));
+}
+
+TEST_F(DuplicateFilterTest, ReserveAndRelease) {
+    milvus::DuplicateFilter filter(100, 0.001);
+    const std::vector<int64_t> keys{1, 2, 3};
+    EXPECT_TRUE(filter.Reserve(keys).empty());
+    // a concurrent insert of the same keys finds them reserved
+    EXPECT_EQ(filter.Reserve(std::vector<int64_t>{3, 4}), (std::vector<uint32_t>{0}));
+    EXPECT_EQ(filter.FindDuplicates(keys).size(), 3);
+
+    // 1 and 2 are stored, 3 failed and may be retried
+    filter.Release(keys, {1, 2});
+    filter.Release(std::vector<int64_t>{4}, std::vector<int64_t>{});
+    EXPECT_EQ(filter.Reserve(keys), (std::vector<uint32_t>{0, 1}));
+    filter.Release(std::vector<int64_t>{3}, std::vector<int64_t>{3});
+    EXPECT_EQ(filter.FindDuplicates(keys).size(), 3);
+    EXPECT_TRUE(filter.Reserve(std::vector<int64_t>{4}).empty());
+}
+
+TEST_F(DuplicateFilterTest, ConcurrentReserve) {
+    milvus::DuplicateFilter filter(1000, 0.001);
+    auto keys = KeyRange(0, 1000);
+    std::atomic<size_t> reserved{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&filter, &keys, &reserved] {
+            auto duplicates = filter.Reserve(keys);
+            reserved += keys.size() - duplicates.size();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // each key is reserved by exactly one of the inserts
+    EXPECT_EQ(reserved.load(), keys.size());
+}
+
+TEST_F(DuplicateFilterTest, SaveAndLoad) {
+    auto path = TempFilter("dup_filter_save");
+    milvus::DuplicateFilter filter(100, 0.001);
+    filter.Add(KeyRange(0, 500));
+    ASSERT_TRUE(filter.Save(path).IsOk());
+
+    std::shared_ptr<milvus::DuplicateFilter> loaded;
+    ASSERT_TRUE(milvus::DuplicateFilter::Load(path, loaded).IsOk());
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->Count(), filter.Count());
+    EXPECT_EQ(loaded->MemoryBytes(), filter.MemoryBytes());
+    EXPECT_EQ(loaded->FindDuplicates(KeyRange(0, 500)).size(), 500);
+
+    // keeps growing after it is loaded
+    loaded->Add(KeyRange(500, 2000));
+    EXPECT_EQ(loaded->FindDuplicates(KeyRange(0, 2000)).size(), 2000);
+}
+
+TEST_F(DuplicateFilterTest, LoadMissingOrCorrupted) {
+    auto path = TempFilter("dup_filter_missing");
+    std::shared_ptr<milvus::DuplicateFilter> loaded;
+    EXPECT_TRUE(milvus::DuplicateFilter::Load(path, loaded).IsOk());
+    EXPECT_EQ(loaded, nullptr);
+
+    milvus::DuplicateFilter filter(100, 0.001);
+    ASSERT_TRUE(filter.Save(path).IsOk());
+    std::FILE* file = std::fopen(path.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    std::fputs("garbage", file);
+    std::fclose(file);
+    EXPECT_FALSE(milvus::DuplicateFilter::Load(path, loaded).IsOk());
+}
+
+TEST_F(DuplicateFilterTest, InsertedKeys) {
+    const std::vector<int64_t> keys{10, 11, 12, 13};
+    milvus::DmlResults results;
+    results.SetInsertCount(4);
+    EXPECT_EQ(milvus::InsertedKeys(keys, milvus::Status::OK(), results), keys);
+
+    // rows rejected by the server are not recorded, so their retry is not dropped
+    results.SetInsertCount(2);
+    results.SetErrorRows({3, 1});
+    const milvus::Status failed(milvus::StatusCode::ServerFailed, "2 of 4 rows failed");
+    EXPECT_EQ(milvus::InsertedKeys(keys, failed, results), (std::vector<int64_t>{10, 12}));
+    EXPECT_EQ(milvus::InsertedKeys(keys, milvus::Status::OK(), results), (std::vector<int64_t>{10, 12}));
+
+    // a failure without a partial outcome stored nothing
+    milvus::DmlResults empty_results;
+    EXPECT_TRUE(milvus::InsertedKeys(keys, failed, empty_results).empty());
+    results.SetInsertCount(0);
+    EXPECT_TRUE(milvus::InsertedKeys(keys, failed, results).empty());
+
+    const std::vector<std::string> names{"a", "b"};
+    milvus::DmlResults name_results;
+    name_results.SetInsertCount(1);
+    name_results.SetErrorRows({0});
+    EXPECT_EQ(milvus::InsertedKeys(names, failed, name_results), std::vector<std::string>{"b"});
+}
@@ -0,0 +1,64 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "Endpoint.h"
+
+class EndpointTest : public ::testing::Test {};
+
+TEST_F(EndpointTest, TcpTargets) {
+    milvus::Endpoint endpoint;
+    EXPECT_TRUE(milvus::ResolveEndpoint("localhost:19530", endpoint).IsOk());
+    EXPECT_EQ(endpoint.target_, "localhost:19530");
+    EXPECT_EQ(endpoint.transport_, milvus::Transport::TCP);
+
+    EXPECT_TRUE(milvus::ResolveEndpoint("tcp://10.0.0.1:19530", endpoint).IsOk());
+    EXPECT_EQ(endpoint.target_, "10.0.0.1:19530");
+    EXPECT_EQ(endpoint.transport_, milvus::Transport::TCP);
+
+    EXPECT_TRUE(milvus::ResolveEndpoint("http://milvus:19530/", endpoint).IsOk());
+    EXPECT_EQ(endpoint.target_, "milvus:19530");
+}
+
+TEST_F(EndpointTest, UnixTargets) {
+    milvus::Endpoint endpoint;
+    EXPECT_TRUE(milvus::ResolveEndpoint("unix:///var/run/milvus.sock", endpoint).IsOk());
+    EXPECT_EQ(endpoint.target_, "unix:///var/run/milvus.sock");
+    EXPECT_EQ(endpoint.transport_, milvus::Transport::UNIX);
+
+    EXPECT_TRUE(milvus::ResolveEndpoint("unix:milvus.sock", endpoint).IsOk());
+    EXPECT_EQ(endpoint.transport_, milvus::Transport::UNIX);
+
+    EXPECT_TRUE(milvus::ResolveEndpoint("unix-abstract:milvus", endpoint).IsOk());
+    EXPECT_EQ(endpoint.transport_, milvus::Transport::UNIX);
+
+    EXPECT_EQ(milvus::ResolveEndpoint("unix://", endpoint).Code(), milvus::StatusCode::InvalidAgument);
+    EXPECT_EQ(milvus::ResolveEndpoint("unix:", endpoint).Code(), milvus::StatusCode::InvalidAgument);
+}
+
+TEST_F(EndpointTest, OtherTargets) {
+    milvus::Endpoint endpoint;
+    EXPECT_TRUE(milvus::ResolveEndpoint("dns:///milvus:19530", endpoint).IsOk());
+    EXPECT_EQ(endpoint.target_, "dns:///milvus:19530");
+    EXPECT_EQ(endpoint.transport_, milvus::Transport::OTHER);
+
+    EXPECT_TRUE(milvus::ResolveEndpoint("ipv4:10.0.0.1:19530,10.0.0.2:19530", endpoint).IsOk());
+    EXPECT_EQ(endpoint.transport_, milvus::Transport::OTHER);
+
+    EXPECT_EQ(milvus::ResolveEndpoint("https://milvus:19530", endpoint).Code(), milvus::StatusCode::NotSupported);
+    EXPECT_EQ(milvus::ResolveEndpoint("", endpoint).Code(), milvus::StatusCode::InvalidAgument);
+}
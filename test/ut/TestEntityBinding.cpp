@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include "types/EntityBinding.h"
+
+namespace {
+struct Book {
+    int64_t id = 0;
+    int32_t word_count = 0;
+    std::string title;
+    std::array<float, 4> intro{};
+    std::vector<uint8_t> cover;
+};
+
+milvus::EntityBinding<Book>
+BookBinding(bool auto_id) {
+    milvus::EntityBinding<Book> binding("books", "book collection");
+    binding.AddPrimaryField<milvus::DataType::INT64>("id", &Book::id, auto_id)
+        .AddField<milvus::DataType::INT32>("word_count", &Book::word_count)
+        .AddField<milvus::DataType::STRING>("title", &Book::title)
+        .AddVectorField<milvus::DataType::FLOAT_VECTOR, 4>("intro", &Book::intro)
+        .AddVectorField<milvus::DataType::BINARY_VECTOR, 16>("cover", &Book::cover);
+    return binding;
+}
+}  // namespace
+
+class EntityBindingTest : public ::testing::Test {};
+
+TEST_F(EntityBindingTest, Schema) {
+    auto binding = BookBinding(false);
+    const auto& schema = binding.Schema();
+    EXPECT_EQ(schema.Name(), "books");
+    ASSERT_EQ(schema.Fields().size(), 5);
+    EXPECT_TRUE(schema.Fields()[0].IsPrimaryKey());
+    EXPECT_EQ(schema.Fields()[1].FieldDataType(), milvus::DataType::INT32);
+    EXPECT_EQ(schema.Fields()[3].TypeParams().at("dim"), "4");
+    EXPECT_EQ(schema.Fields()[4].TypeParams().at("dim"), "16");
+    EXPECT_EQ(binding.FieldNames().size(), 5);
+}
+
+TEST_F(EntityBindingTest, RoundTrip) {
+    auto binding = BookBinding(false);
+    std::vector<Book> books(3);
+    for (int i = 0; i < 3; ++i) {
+        books[i].id = i + 100;
+        books[i].word_count = i * 10;
+        books[i].title = "book" + std::to_string(i);
+        books[i].intro = {{i * 1.0f, i * 2.0f, i * 3.0f, i * 4.0f}};
+        books[i].cover = {static_cast<uint8_t>(i), 0xff};
+    }
+
+    std::vector<milvus::FieldDataPtr> fields;
+    ASSERT_TRUE(binding.ToFields(books, fields).IsOk());
+    ASSERT_EQ(fields.size(), 5);
+    auto intro = std::dynamic_pointer_cast<milvus::FloatVecFieldData>(fields[3]);
+    ASSERT_NE(intro, nullptr);
+    EXPECT_EQ(intro->Count(), 3);
+    EXPECT_EQ(intro->Data().size(), 12);
+    EXPECT_FLOAT_EQ(intro->Row(2)[3], 8.0f);
+
+    std::vector<Book> results;
+    ASSERT_TRUE(binding.FromFields(fields, results).IsOk());
+    ASSERT_EQ(results.size(), 3);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(results[i].id, books[i].id);
+        EXPECT_EQ(results[i].word_count, books[i].word_count);
+        EXPECT_EQ(results[i].title, books[i].title);
+        EXPECT_EQ(results[i].intro, books[i].intro);
+        EXPECT_EQ(results[i].cover, books[i].cover);
+    }
+}
+
+TEST_F(EntityBindingTest, SkipAutoID) {
+    auto binding = BookBinding(true);
+    std::vector<Book> books(2);
+    books[0].cover = books[1].cover = {0, 0};
+    std::vector<milvus::FieldDataPtr> fields;
+    ASSERT_TRUE(binding.ToFields(books, fields).IsOk());
+    ASSERT_EQ(fields.size(), 4);
+    EXPECT_EQ(fields[0]->Name(), "word_count");
+}
+
+TEST_F(EntityBindingTest, DimensionMismatch) {
+    auto binding = BookBinding(false);
+    std::vector<Book> books(1);
+    books[0].cover = {0, 0, 0};
+    std::vector<milvus::FieldDataPtr> fields;
+    auto status = binding.ToFields(books, fields);
+    EXPECT_FALSE(status.IsOk());
+    EXPECT_EQ(status.Code(), milvus::StatusCode::InvalidAgument);
+}
+
+TEST_F(EntityBindingTest, TypeMismatch) {
+    auto binding = BookBinding(false);
+    std::vector<milvus::FieldDataPtr> fields{std::make_shared<milvus::Int64FieldData>("word_count")};
+    std::vector<Book> results;
+    EXPECT_FALSE(binding.FromFields(fields, results).IsOk());
+}
@@ -0,0 +1,170 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "EntityCache.h"
+
+class EntityCacheTest : public ::testing::Test {};
+
+namespace {
+
+milvus::EntityRow
+MakeRow(size_t bytes) {
+    milvus::EntityField field;
+    field.name_ = "id";
+    field.type_ = milvus::DataType::INT64;
+    milvus::EntityRow row;
+    row.layout_ = std::make_shared<milvus::EntityLayout>(1, field);
+    row.data_.assign(bytes, 'x');
+    return row;
+}
+
+}  // namespace
+
+TEST_F(EntityCacheTest, FrequencySketch) {
+    milvus::FrequencySketch sketch(1024);
+    EXPECT_EQ(sketch.Frequency(42), 0);
+    for (int i = 0; i < 5; ++i) {
+        sketch.Increment(42);
+    }
+    EXPECT_EQ(sketch.Frequency(42), 5);
+    for (int i = 0; i < 100; ++i) {
+        sketch.Increment(7);
+    }
+    // counters saturate
+    EXPECT_EQ(sketch.Frequency(7), 15);
+    EXPECT_EQ(sketch.Frequency(42), 5);
+}
+
+TEST_F(EntityCacheTest, EncodeDecode) {
+    std::vector<milvus::FieldDataPtr> columns{
+        std::make_shared<milvus::Int64FieldData>("id", std::vector<int64_t>{1, 2}),
+        std::make_shared<milvus::BoolFieldData>("flag", std::vector<bool>{true, false}),
+        std::make_shared<milvus::StringFieldData>("name", std::vector<std::string>{"alice", "bob"}),
+        std::make_shared<milvus::DoubleFieldData>("score", std::vector<double>{0.5, 1.5}),
+        std::make_shared<milvus::FloatVecFieldData>("vec", 3, std::vector<float>{1, 2, 3, 4, 5, 6}),
+        std::make_shared<milvus::BinaryVecFieldData>("bin", 16, std::vector<uint8_t>{1, 2, 3, 4}),
+    };
+    auto layout = std::make_shared<milvus::EntityLayout>();
+    ASSERT_TRUE(milvus::MakeEntityLayout(columns, *layout).IsOk());
+    ASSERT_EQ(layout->size(), columns.size());
+    EXPECT_EQ((*layout)[4].dimension_, 3);
+
+    // decode row 1 only, skipping the flag column
+    milvus::EntityRow row;
+    row.layout_ = layout;
+    milvus::EncodeEntity(columns, 1, row.data_);
+    std::vector<milvus::FieldDataPtr> decoded;
+    for (const auto& field : *layout) {
+        decoded.push_back(field.name_ == "flag" ? nullptr : milvus::CreateEntityColumn(field));
+    }
+    milvus::DecodeEntity(row, decoded);
+
+    EXPECT_EQ(std::static_pointer_cast<milvus::Int64FieldData>(decoded[0])->Data(), (std::vector<int64_t>{2}));
+    EXPECT_EQ(std::static_pointer_cast<milvus::StringFieldData>(decoded[2])->Data(),
+              (std::vector<std::string>{"bob"}));
+    EXPECT_EQ(std::static_pointer_cast<milvus::DoubleFieldData>(decoded[3])->Data(), (std::vector<double>{1.5}));
+    EXPECT_EQ(std::static_pointer_cast<milvus::FloatVecFieldData>(decoded[4])->Data(),
+              (std::vector<float>{4, 5, 6}));
+    auto binary = std::static_pointer_cast<milvus::BinaryVecFieldData>(decoded[5]);
+    EXPECT_EQ(binary->Count(), 1);
+    EXPECT_EQ(binary->Data(), (std::vector<uint8_t>{3, 4}));
+}
+
+TEST_F(EntityCacheTest, GetRequiresAllFields) {
+    milvus::EntityCacheConfig config;
+    config.SetCapacityBytes(1 << 20);
+    milvus::EntityCache cache(config);
+
+    auto key = milvus::EntityCache::Key("books", int64_t{1});
+    cache.Put(key, MakeRow(16), cache.Epoch());
+
+    milvus::EntityRow row;
+    EXPECT_TRUE(cache.Get(key, {"id"}, row));
+    EXPECT_EQ(row.data_.size(), 16);
+    EXPECT_FALSE(cache.Get(key, {"id", "title"}, row));
+    EXPECT_FALSE(cache.Get(milvus::EntityCache::Key("books", "1"), {"id"}, row));
+
+    auto stat = cache.Stat();
+    EXPECT_EQ(stat.EntityCount(), 1);
+    EXPECT_EQ(stat.HitCount(), 1);
+    EXPECT_EQ(stat.MissCount(), 2);
+}
+
+TEST_F(EntityCacheTest, Invalidation) {
+    milvus::EntityCacheConfig config;
+    config.SetCapacityBytes(1 << 20);
+    milvus::EntityCache cache(config);
+
+    auto epoch = cache.Epoch();
+    cache.Put(milvus::EntityCache::Key("books", int64_t{1}), MakeRow(16), epoch);
+    cache.Put(milvus::EntityCache::Key("books", int64_t{2}), MakeRow(16), epoch);
+    cache.Put(milvus::EntityCache::Key("books2", int64_t{1}), MakeRow(16), epoch);
+
+    milvus::EntityRow row;
+    cache.Invalidate(milvus::EntityCache::Key("books", int64_t{1}));
+    EXPECT_FALSE(cache.Get(milvus::EntityCache::Key("books", int64_t{1}), {"id"}, row));
+    EXPECT_TRUE(cache.Get(milvus::EntityCache::Key("books", int64_t{2}), {"id"}, row));
+
+    // an entity fetched before the invalidation is not cached
+    cache.Put(milvus::EntityCache::Key("books", int64_t{1}), MakeRow(16), epoch);
+    EXPECT_FALSE(cache.Get(milvus::EntityCache::Key("books", int64_t{1}), {"id"}, row));
+
+    cache.InvalidateCollection("books");
+    EXPECT_FALSE(cache.Get(milvus::EntityCache::Key("books", int64_t{2}), {"id"}, row));
+    EXPECT_TRUE(cache.Get(milvus::EntityCache::Key("books2", int64_t{1}), {"id"}, row));
+    EXPECT_EQ(cache.Stat().EntityCount(), 1);
+}
+
+TEST_F(EntityCacheTest, Admission) {
+    milvus::EntityCacheConfig config;
+    // room for 2 entities of 100 bytes each, including the bookkeeping overhead
+    config.SetCapacityBytes(2 * 300);
+    milvus::EntityCache cache(config);
+    milvus::EntityRow row;
+
+    std::vector<std::string> keys;
+    for (int64_t id = 0; id < 4; ++id) {
+        keys.push_back(milvus::EntityCache::Key("c", id));
+    }
+    // 0 and 1 are hot
+    for (int i = 0; i < 5; ++i) {
+        cache.Get(keys[0], {"id"}, row);
+        cache.Get(keys[1], {"id"}, row);
+    }
+    cache.Put(keys[0], MakeRow(100), cache.Epoch());
+    cache.Put(keys[1], MakeRow(100), cache.Epoch());
+
+    // a one-off entity doesn't evict a hot one
+    cache.Get(keys[2], {"id"}, row);
+    cache.Put(keys[2], MakeRow(100), cache.Epoch());
+    EXPECT_EQ(cache.Stat().RejectCount(), 1);
+    EXPECT_TRUE(cache.Get(keys[0], {"id"}, row));
+    EXPECT_TRUE(cache.Get(keys[1], {"id"}, row));
+
+    // a hotter entity replaces the least recently used one
+    for (int i = 0; i < 10; ++i) {
+        cache.Get(keys[3], {"id"}, row);
+    }
+    cache.Put(keys[3], MakeRow(100), cache.Epoch());
+    EXPECT_FALSE(cache.Get(keys[0], {"id"}, row));
+    EXPECT_TRUE(cache.Get(keys[3], {"id"}, row));
+    EXPECT_EQ(cache.Stat().EntityCount(), 2);
+}
@@ -0,0 +1,170 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <clocale>
+#include <cmath>
+#include <limits>
+
+#include "Expr.h"
+
+using milvus::Expr;
+
+namespace {
+milvus::CollectionSchema
+UserSchema() {
+    milvus::CollectionSchema schema("users");
+    milvus::FieldSchema id("id", milvus::DataType::INT64, "", true);
+    milvus::FieldSchema age("age", milvus::DataType::INT32);
+    milvus::FieldSchema score("score", milvus::DataType::DOUBLE);
+    milvus::FieldSchema name("name", milvus::DataType::STRING);
+    milvus::FieldSchema active("active", milvus::DataType::BOOL);
+    milvus::FieldSchema face("face", milvus::DataType::FLOAT_VECTOR);
+    schema.AddField(id);
+    schema.AddField(age);
+    schema.AddField(score);
+    schema.AddField(name);
+    schema.AddField(active);
+    schema.AddField(face);
+    return schema;
+}
+}  // namespace
+
+class ExprTest : public ::testing::Test {};
+
+TEST_F(ExprTest, BindParams) {
+    auto expr = Expr::Field("age") >= Expr::Param("min_age") && Expr::Field("id").In(Expr::Param("ids"));
+    milvus::PreparedExpr prepared;
+    auto status = milvus::PreparedExpr::Prepare(expr, UserSchema(), prepared);
+    ASSERT_TRUE(status.IsOk());
+    EXPECT_EQ(prepared.ParamNames(), (std::vector<std::string>{"min_age", "ids"}));
+
+    auto params = prepared.NewParams();
+    EXPECT_TRUE(params.Set("min_age", 18));
+    EXPECT_TRUE(params.Set("ids", std::vector<int64_t>{1, 2, 3}));
+    EXPECT_FALSE(params.Set("unknown", 1));
+
+    std::string expression;
+    EXPECT_TRUE(prepared.Bind(params, expression).IsOk());
+    EXPECT_EQ(expression, "(age >= 18) && (id in [1,2,3])");
+
+    params.Set("min_age", 21);
+    params.Set("ids", std::vector<int64_t>{-5});
+    EXPECT_TRUE(prepared.Bind(params, expression).IsOk());
+    EXPECT_EQ(expression, "(age >= 21) && (id in [-5])");
+}
+
+TEST_F(ExprTest, Literals) {
+    auto expr = !(Expr::Field("name") == Expr::Value("a\"b")) ||
+                Expr::Field("score").Between(Expr::Value(1), Expr::Value(2.5), true) ||
+                Expr::Field("active") == Expr::Value(true);
+    milvus::PreparedExpr prepared;
+    ASSERT_TRUE(milvus::PreparedExpr::Prepare(expr, UserSchema(), prepared).IsOk());
+    EXPECT_TRUE(prepared.ParamNames().empty());
+
+    std::string expression;
+    EXPECT_TRUE(prepared.Bind(prepared.NewParams(), expression).IsOk());
+    EXPECT_EQ(expression, "((not (name == \"a\\\"b\")) || (1 <= score <= 2.5)) || (active == true)");
+}
+
+TEST_F(ExprTest, PrepareErrors) {
+    auto schema = UserSchema();
+    milvus::PreparedExpr prepared;
+    EXPECT_FALSE(milvus::PreparedExpr::Prepare(Expr::Field("unknown") > Expr::Value(1), schema, prepared).IsOk());
+    EXPECT_FALSE(milvus::PreparedExpr::Prepare(Expr::Field("face") > Expr::Value(1), schema, prepared).IsOk());
+    EXPECT_FALSE(milvus::PreparedExpr::Prepare(Expr::Field("age") > Expr::Value("x"), schema, prepared).IsOk());
+    EXPECT_FALSE(milvus::PreparedExpr::Prepare(Expr::Field("active") > Expr::Value(true), schema, prepared).IsOk());
+    EXPECT_FALSE(milvus::PreparedExpr::Prepare(Expr::Value(1) > Expr::Value(2), schema, prepared).IsOk());
+    EXPECT_FALSE(milvus::PreparedExpr::Prepare(Expr::Field("age"), schema, prepared).IsOk());
+    EXPECT_FALSE(milvus::PreparedExpr::Prepare(
+                     Expr::Field("age") > Expr::Param("p") && Expr::Field("name") == Expr::Param("p"), schema, prepared)
+                     .IsOk());
+}
+
+TEST_F(ExprTest, BindErrors) {
+    auto expr = Expr::Field("score") < Expr::Param("max") && Expr::Field("name").In(Expr::Param("names"));
+    milvus::PreparedExpr prepared;
+    ASSERT_TRUE(milvus::PreparedExpr::Prepare(expr, UserSchema(), prepared).IsOk());
+
+    std::string expression;
+    auto params = prepared.NewParams();
+    params.Set("max", 10);
+    EXPECT_FALSE(prepared.Bind(params, expression).IsOk());
+
+    params.Set("names", std::vector<int64_t>{1});
+    EXPECT_FALSE(prepared.Bind(params, expression).IsOk());
+
+    params.Set("names", std::vector<std::string>{"x", "y"});
+    EXPECT_TRUE(prepared.Bind(params, expression).IsOk());
+    EXPECT_EQ(expression, "(score < 10) && (name in [\"x\",\"y\"])");
+
+    milvus::PreparedExpr other;
+    ASSERT_TRUE(milvus::PreparedExpr::Prepare(expr, UserSchema(), other).IsOk());
+    EXPECT_FALSE(other.Bind(params, expression).IsOk());
+}
+
+TEST_F(ExprTest, BindStringLiteral) {
+    auto expr = Expr::Field("name") == Expr::Param("name");
+    milvus::PreparedExpr prepared;
+    ASSERT_TRUE(milvus::PreparedExpr::Prepare(expr, UserSchema(), prepared).IsOk());
+
+    auto params = prepared.NewParams();
+    EXPECT_TRUE(params.Set("name", "bob"));
+    std::string expression;
+    EXPECT_TRUE(prepared.Bind(params, expression).IsOk());
+    EXPECT_EQ(expression, "name == \"bob\"");
+}
+
+TEST_F(ExprTest, NonFiniteDoubles) {
+    auto expr = Expr::Field("score") < Expr::Param("max") && Expr::Field("score").In(Expr::Param("scores"));
+    milvus::PreparedExpr prepared;
+    ASSERT_TRUE(milvus::PreparedExpr::Prepare(expr, UserSchema(), prepared).IsOk());
+
+    auto params = prepared.NewParams();
+    params.Set("scores", std::vector<double>{1.0});
+    params.Set("max", std::nan(""));
+    std::string expression;
+    EXPECT_FALSE(prepared.Bind(params, expression).IsOk());
+    params.Set("max", std::numeric_limits<double>::infinity());
+    EXPECT_FALSE(prepared.Bind(params, expression).IsOk());
+    params.Set("max", 1.5);
+    EXPECT_TRUE(prepared.Bind(params, expression).IsOk());
+    params.Set("scores", std::vector<double>{1.0, -std::numeric_limits<double>::infinity()});
+    EXPECT_FALSE(prepared.Bind(params, expression).IsOk());
+
+    milvus::PreparedExpr literal;
+    EXPECT_FALSE(
+        milvus::PreparedExpr::Prepare(Expr::Field("score") < Expr::Value(std::nan("")), UserSchema(), literal).IsOk());
+}
+
+TEST_F(ExprTest, DoubleIgnoresLocale) {
+    auto expr = Expr::Field("score") < Expr::Value(2.5);
+    milvus::PreparedExpr prepared;
+    ASSERT_TRUE(milvus::PreparedExpr::Prepare(expr, UserSchema(), prepared).IsOk());
+
+    // the decimal point of de_DE is ',', skip the locale part if it isn't installed
+    const char* locales[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE"};
+    for (auto name : locales) {
+        if (std::setlocale(LC_NUMERIC, name) != nullptr) {
+            break;
+        }
+    }
+    std::string expression;
+    EXPECT_TRUE(prepared.Bind(prepared.NewParams(), expression).IsOk());
+    std::setlocale(LC_NUMERIC, "C");
+    EXPECT_EQ(expression, "score < 2.5");
+}
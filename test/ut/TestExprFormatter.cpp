@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+
+#include "ExprFormatter.h"
+
+class ExprFormatterTest : public ::testing::Test {};
+
+TEST_F(ExprFormatterTest, Int64) {
+    const int64_t values[] = {0,
+                              7,
+                              -7,
+                              10,
+                              99,
+                              100,
+                              12345,
+                              -987654321,
+                              std::numeric_limits<int64_t>::max(),
+                              std::numeric_limits<int64_t>::min()};
+    for (auto value : values) {
+        std::string out = "x";
+        milvus::AppendInt64(out, value);
+        EXPECT_EQ(out, "x" + std::to_string(value));
+        EXPECT_EQ(milvus::Int64Length(value), std::to_string(value).size());
+    }
+}
+
+TEST_F(ExprFormatterTest, Quoted) {
+    std::string value = "a\"b\\c";
+    std::string out;
+    milvus::AppendQuoted(out, value);
+    EXPECT_EQ(out, "\"a\\\"b\\\\c\"");
+    EXPECT_EQ(milvus::QuotedLength(value), out.size());
+}
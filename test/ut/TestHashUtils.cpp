@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "HashUtils.h"
+
+namespace {
+// byte-wise reference of murmur3 32-bit
+uint32_t
+Murmur3(const uint8_t* data, size_t len, uint32_t seed) {
+    auto rotl = [](uint32_t x, int r) { return (x << r) | (x >> (32 - r)); };
+    const uint32_t c1 = 0xcc9e2d51, c2 = 0x1b873593;
+    uint32_t h = seed;
+    size_t blocks = len / 4;
+    for (size_t i = 0; i < blocks; ++i) {
+        uint32_t k = data[i * 4] | (data[i * 4 + 1] << 8) | (data[i * 4 + 2] << 16) | (data[i * 4 + 3] << 24);
+        k *= c1;
+        k = rotl(k, 15);
+        k *= c2;
+        h ^= k;
+        h = rotl(h, 13);
+        h = h * 5 + 0xe6546b64;
+    }
+    const uint8_t* tail = data + blocks * 4;
+    uint32_t k = 0;
+    switch (len & 3) {
+        case 3:
+            k ^= tail[2] << 16;
+            // fallthrough
+        case 2:
+            k ^= tail[1] << 8;
+            // fallthrough
+        case 1:
+            k ^= tail[0];
+            k *= c1;
+            k = rotl(k, 15);
+            k *= c2;
+            h ^= k;
+    }
+    h ^= static_cast<uint32_t>(len);
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+}
+}  // namespace
+
+class HashUtilsTest : public ::testing::Test {};
+
+TEST_F(HashUtilsTest, ReferenceVectors) {
+    std::string hello = "hello";
+    EXPECT_EQ(Murmur3(reinterpret_cast<const uint8_t*>(hello.data()), hello.size(), 0), 0x248bfa47u);
+    std::string hello_world = "Hello, world!";
+    EXPECT_EQ(Murmur3(reinterpret_cast<const uint8_t*>(hello_world.data()), hello_world.size(), 1234), 0xfaf6cdb3u);
+}
+
+TEST_F(HashUtilsTest, Int64Key) {
+    const int64_t keys[] = {0, 1, -1, 42, 1LL << 40, INT64_MAX, INT64_MIN, 434848878802251176LL};
+    uint32_t hashes[8];
+    milvus::HashInt64Keys(keys, 8, hashes);
+    for (int i = 0; i < 8; ++i) {
+        uint8_t bytes[8];
+        for (int b = 0; b < 8; ++b) {
+            bytes[b] = static_cast<uint8_t>(static_cast<uint64_t>(keys[i]) >> (b * 8));
+        }
+        uint32_t expected = Murmur3(bytes, 8, 0) & 0x7fffffff;
+        EXPECT_EQ(milvus::HashInt64Key(keys[i]), expected);
+        EXPECT_EQ(hashes[i], expected);
+    }
+}
+
+TEST_F(HashUtilsTest, ServerGoldenValues) {
+    // typeutil.Hash32Int64() of the milvus server, which the shard of a row is chosen by
+    const std::pair<int64_t, uint32_t> golden[] = {
+        {0, 1669671676u},
+        {1, 1392991556u},
+        {-1, 1651860712u},
+        {42, 1871679806u},
+        {100, 1177227376u},
+        {1LL << 40, 703999778u},
+        {INT64_MAX, 40977599u},
+        {INT64_MIN, 1366273829u},
+        {434848878802251176LL, 1795032012u},
+    };
+    for (const auto& pair : golden) {
+        EXPECT_EQ(milvus::HashInt64Key(pair.first), pair.second) << pair.first;
+    }
+}
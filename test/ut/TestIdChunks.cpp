@@ -0,0 +1,124 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IdChunks.h"
+
+class IdChunksTest : public ::testing::Test {};
+
+TEST_F(IdChunksTest, SplitAndFormat) {
+    std::vector<int64_t> ids{1, 22, 333, -4};
+    // "id in [" + "]" is 8 bytes, each id adds its length and a separator
+    auto bounds = milvus::SplitIdChunks(ids, 8, 16);
+    EXPECT_EQ(bounds, (std::vector<size_t>{0, 2, 4}));
+
+    std::string expression;
+    milvus::FormatIdChunk(ids, "id", bounds[0], bounds[1], expression);
+    EXPECT_EQ(expression, "id in [1,22]");
+    milvus::FormatIdChunk(ids, "id", bounds[1], bounds[2], expression);
+    EXPECT_EQ(expression, "id in [333,-4]");
+
+    std::vector<std::string> names{"a\"b", "c"};
+    milvus::FormatIdChunk(names, "name", 0, names.size(), expression);
+    EXPECT_EQ(expression, R"(name in ["a\"b","c"])");
+
+    // an id longer than the limit still makes a chunk
+    EXPECT_EQ(milvus::SplitIdChunks(std::vector<std::string>{std::string(64, 'x')}, 8, 16),
+              (std::vector<size_t>{0, 1}));
+    EXPECT_EQ(milvus::SplitIdChunks(std::vector<int64_t>{}, 8), (std::vector<size_t>{0, 0}));
+}
+
+TEST_F(IdChunksTest, FormatRange) {
+    std::vector<int64_t> ids{-4, 1, 22, 333};
+    std::string expression;
+    milvus::FormatIdRange(ids, "id", 0, 2, expression);
+    EXPECT_EQ(expression, "id >= -4 && id <= 1");
+    milvus::FormatIdRange(ids, "id", 3, 4, expression);
+    EXPECT_EQ(expression, "id >= 333 && id <= 333");
+
+    std::vector<std::string> names{"a\"b", "c"};
+    milvus::FormatIdRange(names, "name", 0, names.size(), expression);
+    EXPECT_EQ(expression, R"(name >= "a\"b" && name <= "c")");
+}
+
+TEST_F(IdChunksTest, ExpressionLimit) {
+    std::vector<int64_t> ids;
+    for (int64_t i = 0; i < 100000; ++i) {
+        ids.push_back(1000000000 + i);
+    }
+    auto bounds = milvus::SplitIdChunks(ids, 8);
+    ASSERT_GT(bounds.size(), 2);
+    EXPECT_EQ(bounds.back(), ids.size());
+
+    std::string expression;
+    for (size_t chunk = 0; chunk + 1 < bounds.size(); ++chunk) {
+        milvus::FormatIdChunk(ids, "id", bounds[chunk], bounds[chunk + 1], expression);
+        EXPECT_LE(expression.size(), milvus::kIdExpressionBytes);
+    }
+}
+
+TEST_F(IdChunksTest, DeleteInChunks) {
+    std::mutex mutex;
+    std::set<std::string> sent;
+    std::atomic<int> in_flight{0};
+    std::atomic<int> max_in_flight{0};
+    auto send = [&](const std::string& expression, milvus::DmlResults& results) {
+        const int current = ++in_flight;
+        int expected = max_in_flight.load();
+        while (current > expected && !max_in_flight.compare_exchange_weak(expected, current)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        --in_flight;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        sent.insert(expression);
+        if (expression == "3" || expression == "5") {
+            return milvus::Status(milvus::StatusCode::ServerFailed, "chunk " + expression);
+        }
+        results.SetDeleteCount(10);
+        results.SetTimestamp(std::stoull(expression));
+        return milvus::Status::OK();
+    };
+    auto format = [](size_t chunk, std::string& expression) { expression = std::to_string(chunk); };
+
+    milvus::ThreadPool pool(3);
+    milvus::DmlResults results;
+    auto status = milvus::DeleteInChunks(pool, 8, 4, format, send, results);
+    // every chunk is sent, the failed ones are not counted
+    EXPECT_EQ(sent.size(), 8);
+    EXPECT_GT(max_in_flight.load(), 1);
+    EXPECT_LE(max_in_flight.load(), 4);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::ServerFailed);
+    EXPECT_TRUE(status.Message() == "chunk 3" || status.Message() == "chunk 5");
+    EXPECT_EQ(results.DeleteCount(), 60);
+    EXPECT_EQ(results.Timestamp(), 7);
+
+    sent.clear();
+    status = milvus::DeleteInChunks(pool, 0, 4, format, send, results);
+    EXPECT_TRUE(status.IsOk());
+    EXPECT_TRUE(sent.empty());
+    EXPECT_EQ(results.DeleteCount(), 0);
+}
@@ -0,0 +1,145 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "InsertCoalescer.h"
+
+class InsertCoalescerTest : public ::testing::Test {};
+
+namespace {
+
+std::vector<milvus::FieldDataPtr>
+MakeRows(int64_t first_id, size_t count) {
+    auto ids = std::make_shared<milvus::Int64FieldData>("id");
+    auto vectors = std::make_shared<milvus::FloatVecFieldData>("vec", 2);
+    for (size_t i = 0; i < count; ++i) {
+        ids->Add(first_id + static_cast<int64_t>(i));
+        vectors->Add({static_cast<float>(i), 0});
+    }
+    return {ids, vectors};
+}
+
+// echoes the primary keys of the batch as the returned ids, fails the rows listed in error_rows
+milvus::InsertCoalescer::Send
+EchoSend(std::atomic<int>& calls, std::vector<uint32_t> error_rows = {}) {
+    return [&calls, error_rows](const std::string&, const std::string&, const std::vector<milvus::FieldDataPtr>& fields,
+                                milvus::proto::milvus::MutationResult& response) {
+        ++calls;
+        for (auto id : std::static_pointer_cast<milvus::Int64FieldData>(fields[0])->Data()) {
+            response.mutable_ids()->mutable_int_id()->add_data(id);
+        }
+        for (auto row : error_rows) {
+            response.add_err_index(row);
+        }
+        response.set_timestamp(100);
+        return milvus::Status::OK();
+    };
+}
+
+}  // namespace
+
+TEST_F(InsertCoalescerTest, CombinesConcurrentInserts) {
+    const size_t thread_count = 8;
+    milvus::InsertCoalesceConfig config;
+    config.SetMaxBatchRows(thread_count * 2);
+    config.SetMaxDelayUs(10 * 1000 * 1000);
+    std::atomic<int> calls{0};
+    milvus::InsertCoalescer coalescer(config, EchoSend(calls));
+
+    std::vector<milvus::Status> statuses(thread_count);
+    std::vector<milvus::DmlResults> results(thread_count);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&, i] {
+            statuses[i] = coalescer.Insert("c", "", MakeRows(static_cast<int64_t>(i) * 10, 2), results[i]);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // the batch is sent once it is full, long before the delay expires
+    EXPECT_EQ(calls, 1);
+    for (size_t i = 0; i < thread_count; ++i) {
+        EXPECT_TRUE(statuses[i].IsOk());
+        const int64_t first_id = static_cast<int64_t>(i) * 10;
+        EXPECT_EQ(results[i].IdArray().IntIDArray(), (std::vector<int64_t>{first_id, first_id + 1}));
+        EXPECT_EQ(results[i].InsertCount(), 2);
+        EXPECT_EQ(results[i].Timestamp(), 100);
+    }
+}
+
+TEST_F(InsertCoalescerTest, FlushesAfterDelay) {
+    milvus::InsertCoalesceConfig config;
+    config.SetMaxDelayUs(1000);
+    std::atomic<int> calls{0};
+    milvus::InsertCoalescer coalescer(config, EchoSend(calls));
+
+    milvus::DmlResults results;
+    EXPECT_TRUE(coalescer.Insert("c", "", MakeRows(5, 3), results).IsOk());
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(results.IdArray().IntIDArray(), (std::vector<int64_t>{5, 6, 7}));
+
+    // different partitions or fields are never combined
+    EXPECT_TRUE(coalescer.Insert("c", "p1", MakeRows(1, 1), results).IsOk());
+    std::vector<milvus::FieldDataPtr> ids_only{MakeRows(1, 1).front()};
+    EXPECT_TRUE(coalescer.Insert("c", "", ids_only, results).IsOk());
+    EXPECT_EQ(calls, 3);
+}
+
+TEST_F(InsertCoalescerTest, SplitsErrorRows) {
+    milvus::InsertCoalesceConfig config;
+    config.SetMaxBatchRows(4);
+    config.SetMaxDelayUs(10 * 1000 * 1000);
+    std::atomic<int> calls{0};
+    // row 3 of the batch is the second row of the second caller
+    milvus::InsertCoalescer coalescer(config, EchoSend(calls, {3}));
+
+    milvus::Status first_status;
+    milvus::DmlResults first_results;
+    std::thread first([&] { first_status = coalescer.Insert("c", "", MakeRows(0, 2), first_results); });
+    // let the first call open the batch
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    milvus::DmlResults second_results;
+    auto second_status = coalescer.Insert("c", "", MakeRows(10, 2), second_results);
+    first.join();
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(first_status.IsOk());
+    EXPECT_TRUE(first_results.ErrorRows().empty());
+    EXPECT_EQ(second_status.Code(), milvus::StatusCode::ServerFailed);
+    EXPECT_EQ(second_results.ErrorRows(), (std::vector<uint32_t>{1}));
+    EXPECT_EQ(second_results.InsertCount(), 1);
+}
+
+TEST_F(InsertCoalescerTest, RpcFailureFailsAllCallers) {
+    milvus::InsertCoalesceConfig config;
+    config.SetMaxDelayUs(1000);
+    auto send = [](const std::string&, const std::string&, const std::vector<milvus::FieldDataPtr>&,
+                   milvus::proto::milvus::MutationResult&) {
+        return milvus::Status(milvus::StatusCode::RPCFailed, "");
+    };
+    milvus::InsertCoalescer coalescer(config, send);
+
+    milvus::DmlResults results;
+    EXPECT_EQ(coalescer.Insert("c", "", MakeRows(0, 1), results).Code(), milvus::StatusCode::RPCFailed);
+    EXPECT_FALSE(coalescer.Insert("c", "", {}, results).IsOk());
+}
@@ -0,0 +1,110 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "LazyResponse.h"
+#include "milvus.pb.h"
+
+namespace {
+::grpc::ByteBuffer
+ToBuffer(const std::string& bytes, size_t split) {
+    ::grpc::Slice slices[2] = {::grpc::Slice(bytes.data(), split),
+                               ::grpc::Slice(bytes.data() + split, bytes.size() - split)};
+    return ::grpc::ByteBuffer(slices, 2);
+}
+
+void
+AddInt32Field(google::protobuf::RepeatedPtrField<milvus::proto::schema::FieldData>* fields, const std::string& name,
+              const std::vector<int32_t>& values) {
+    auto field = fields->Add();
+    field->set_field_name(name);
+    field->set_type(milvus::proto::schema::DataType::Int32);
+    for (auto value : values) {
+        field->mutable_scalars()->mutable_int_data()->add_data(value);
+    }
+}
+}  // namespace
+
+class LazyResponseTest : public ::testing::Test {};
+
+TEST_F(LazyResponseTest, SearchResults) {
+    milvus::proto::milvus::SearchResults response;
+    auto data = response.mutable_results();
+    data->set_num_queries(2);
+    data->set_top_k(2);
+    data->add_topks(2);
+    data->add_topks(1);
+    for (int64_t id : {10, 11, 20}) {
+        data->mutable_ids()->mutable_int_id()->add_data(id);
+    }
+    for (float score : {0.5f, 1.5f, 2.5f}) {
+        data->add_scores(score);
+    }
+    AddInt32Field(data->mutable_fields_data(), "age", {1, 2, 3});
+    AddInt32Field(data->mutable_fields_data(), "year", {4, 5, 6});
+
+    const auto bytes = response.SerializeAsString();
+    for (size_t split : {bytes.size(), size_t{7}}) {
+        std::shared_ptr<milvus::LazyResponse> lazy_response;
+        ASSERT_TRUE(milvus::LazyResponse::ParseSearchResults(ToBuffer(bytes, split), lazy_response).IsOk());
+        milvus::LazySearchResults results(lazy_response);
+
+        EXPECT_EQ(results.NumQueries(), 2);
+        EXPECT_EQ(results.TopKs(), (std::vector<int64_t>{2, 1}));
+        EXPECT_EQ(results.HitOffset(1), 2);
+        ASSERT_EQ(results.ScoreCount(), 3);
+        EXPECT_FLOAT_EQ(results.Score(2), 2.5f);
+        EXPECT_EQ(results.Ids().IntIDArray(), (std::vector<int64_t>{10, 11, 20}));
+        EXPECT_EQ(results.FieldNames(), (std::vector<std::string>{"age", "year"}));
+
+        auto year = std::dynamic_pointer_cast<milvus::Int32FieldData>(results.GetFieldByName("year"));
+        ASSERT_NE(year, nullptr);
+        EXPECT_EQ(year->Data(), (std::vector<int32_t>{4, 5, 6}));
+        EXPECT_EQ(results.GetFieldByName("year"), year);
+        EXPECT_EQ(results.GetFieldByName("unknown"), nullptr);
+    }
+}
+
+TEST_F(LazyResponseTest, QueryResults) {
+    milvus::proto::milvus::QueryResults response;
+    AddInt32Field(response.mutable_fields_data(), "age", {7, 8});
+
+    std::shared_ptr<milvus::LazyResponse> lazy_response;
+    const auto bytes = response.SerializeAsString();
+    ASSERT_TRUE(milvus::LazyResponse::ParseQueryResults(ToBuffer(bytes, bytes.size()), lazy_response).IsOk());
+    milvus::LazyQueryResults results(lazy_response);
+    EXPECT_EQ(results.FieldNames(), std::vector<std::string>{"age"});
+    auto age = std::dynamic_pointer_cast<milvus::Int32FieldData>(results.GetFieldByName("age"));
+    ASSERT_NE(age, nullptr);
+    EXPECT_EQ(age->Data(), (std::vector<int32_t>{7, 8}));
+}
+
+TEST_F(LazyResponseTest, Errors) {
+    milvus::proto::milvus::SearchResults response;
+    response.mutable_status()->set_error_code(milvus::proto::common::ErrorCode::UnexpectedError);
+    response.mutable_status()->set_reason("collection not loaded");
+    auto bytes = response.SerializeAsString();
+
+    std::shared_ptr<milvus::LazyResponse> lazy_response;
+    auto status = milvus::LazyResponse::ParseSearchResults(ToBuffer(bytes, bytes.size()), lazy_response);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::ServerFailed);
+    EXPECT_EQ(status.Message(), "collection not loaded");
+
+    bytes = std::string("\x12\x10\x01", 3);
+    status = milvus::LazyResponse::ParseSearchResults(ToBuffer(bytes, bytes.size()), lazy_response);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::RPCFailed);
+}
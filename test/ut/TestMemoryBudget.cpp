@@ -0,0 +1,82 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+
+#include "MemoryBudget.h"
+
+class MemoryBudgetTest : public ::testing::Test {};
+
+TEST_F(MemoryBudgetTest, FailFast) {
+    milvus::MemoryBudgetConfig config;
+    config.SetBudgetBytes(100);
+    config.SetFailFast(true);
+    milvus::MemoryBudget budget(config);
+
+    {
+        milvus::MemoryReservation first(&budget, 60);
+        EXPECT_TRUE(first.Result().IsOk());
+        milvus::MemoryReservation second(&budget, 60);
+        EXPECT_EQ(second.Result().Code(), milvus::StatusCode::Throttled);
+        milvus::MemoryReservation third(&budget, 40);
+        EXPECT_TRUE(third.Result().IsOk());
+        EXPECT_EQ(budget.Stat().UsedBytes(), 100);
+    }
+
+    auto stat = budget.Stat();
+    EXPECT_EQ(stat.UsedBytes(), 0);
+    EXPECT_EQ(stat.PeakBytes(), 100);
+    EXPECT_EQ(stat.RejectCount(), 1);
+
+    // an oversized request is admitted when nothing is in flight
+    milvus::MemoryReservation oversized(&budget, 500);
+    EXPECT_TRUE(oversized.Result().IsOk());
+}
+
+TEST_F(MemoryBudgetTest, BlockUntilReleased) {
+    milvus::MemoryBudgetConfig config;
+    config.SetBudgetBytes(100);
+    milvus::MemoryBudget budget(config);
+
+    auto first = std::unique_ptr<milvus::MemoryReservation>(new milvus::MemoryReservation(&budget, 80));
+    std::thread releaser([&first] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        first.reset();
+    });
+    milvus::MemoryReservation second(&budget, 80);
+    releaser.join();
+    EXPECT_TRUE(second.Result().IsOk());
+    EXPECT_EQ(budget.Stat().WaitCount(), 1);
+    EXPECT_EQ(budget.Stat().UsedBytes(), 80);
+}
+
+TEST_F(MemoryBudgetTest, Resize) {
+    milvus::MemoryBudgetConfig config;
+    config.SetBudgetBytes(100);
+    config.SetWaitTimeoutMs(10);
+    milvus::MemoryBudget budget(config);
+
+    milvus::MemoryReservation reservation(&budget, 50);
+    reservation.Resize(120);
+    EXPECT_EQ(budget.Stat().UsedBytes(), 120);
+    EXPECT_FALSE(budget.Reserve(1).IsOk());
+    reservation.Resize(10);
+    EXPECT_EQ(budget.Stat().UsedBytes(), 10);
+    EXPECT_TRUE(budget.Reserve(90).IsOk());
+}
@@ -0,0 +1,133 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MetricsCollector.h"
+
+class MetricsCollectorTest : public ::testing::Test {};
+
+namespace {
+
+const char* const kSystemInfo = R"({
+  "nodes_info": [
+    {
+      "identifier": 1,
+      "connected": [{"connected_identifier": 7, "type": "forward", "target_type": "querynode"}],
+      "infos": {
+        "has_error": false,
+        "error_reason": "",
+        "name": "proxy1",
+        "type": "proxy",
+        "id": 1,
+        "hardware_infos": {"ip": "10.0.0.1:19530", "cpu_core_count": 8, "cpu_core_usage": 12.5,
+                           "memory": 16000000000, "memory_usage": 4000000000, "disk": 100, "disk_usage": 10}
+      }
+    },
+    {
+      "identifier": 7,
+      "infos": {
+        "has_error": true,
+        "error_reason": "slow",
+        "name": "querynode7",
+        "type": "querynode",
+        "quota_metrics": {
+          "SearchQueue": {"UnsolvedQueue": 3, "ReadyQueue": 2, "AvgQueueDuration": 2500000},
+          "QueryQueue": {"UnsolvedQueue": 1, "ReadyQueue": 0, "AvgQueueDuration": 0}
+        }
+      }
+    }
+  ]
+})";
+
+}  // namespace
+
+TEST_F(MetricsCollectorTest, ParseSystemInfo) {
+    milvus::ServerMetrics metrics;
+    auto status = milvus::ParseSystemInfo(kSystemInfo, "proxy1", 1000, metrics);
+    ASSERT_TRUE(status.IsOk()) << status.Message();
+    EXPECT_EQ(metrics.TimestampMs(), 1000);
+    EXPECT_EQ(metrics.ComponentName(), "proxy1");
+    ASSERT_EQ(metrics.Nodes().size(), 2);
+
+    const auto& proxy = metrics.Nodes()[0];
+    EXPECT_EQ(proxy.node_id_, 1);
+    EXPECT_EQ(proxy.type_, "proxy");
+    EXPECT_EQ(proxy.ip_, "10.0.0.1:19530");
+    EXPECT_EQ(proxy.cpu_core_count_, 8);
+    EXPECT_DOUBLE_EQ(proxy.cpu_usage_, 12.5);
+    EXPECT_EQ(proxy.memory_bytes_, 16000000000);
+    EXPECT_EQ(proxy.memory_usage_bytes_, 4000000000);
+    EXPECT_EQ(proxy.connected_, std::vector<int64_t>{7});
+    EXPECT_FALSE(proxy.has_error_);
+
+    // the id falls back to the identifier, missing hardware infos read as zero
+    const auto& query_node = metrics.Nodes()[1];
+    EXPECT_EQ(query_node.node_id_, 7);
+    EXPECT_TRUE(query_node.has_error_);
+    EXPECT_EQ(query_node.error_reason_, "slow");
+    EXPECT_EQ(query_node.cpu_core_count_, 0);
+    EXPECT_EQ(query_node.search_queue_.unsolved_, 3);
+    EXPECT_EQ(query_node.search_queue_.ready_, 2);
+    EXPECT_DOUBLE_EQ(query_node.search_queue_.avg_latency_ms_, 2.5);
+    EXPECT_EQ(query_node.query_queue_.unsolved_, 1);
+
+    EXPECT_FALSE(milvus::ParseSystemInfo("not json", "", 0, metrics).IsOk());
+    EXPECT_FALSE(milvus::ParseSystemInfo("{}", "", 0, metrics).IsOk());
+}
+
+TEST_F(MetricsCollectorTest, Ring) {
+    milvus::MetricsConfig config;
+    config.SetCapacity(3);
+    int64_t polls = 0;
+    milvus::MetricsCollector collector(config, [&polls](milvus::ServerMetrics& metrics) {
+        ++polls;
+        if (polls == 2) {
+            return milvus::Status(milvus::StatusCode::ServerFailed, "down");
+        }
+        metrics = milvus::ServerMetrics(polls, "proxy", {});
+        return milvus::Status::OK();
+    });
+
+    for (int i = 0; i < 5; ++i) {
+        collector.Collect();
+    }
+    auto history = collector.History();
+    ASSERT_EQ(history.size(), 3);
+    EXPECT_EQ(history[0].TimestampMs(), 3);
+    EXPECT_EQ(history[2].TimestampMs(), 5);
+}
+
+TEST_F(MetricsCollectorTest, Poll) {
+    milvus::MetricsConfig config;
+    config.SetIntervalMs(1);
+    std::atomic<int64_t> polls{0};
+    milvus::MetricsCollector collector(config, [&polls](milvus::ServerMetrics& metrics) {
+        metrics = milvus::ServerMetrics(++polls, "proxy", {});
+        return milvus::Status::OK();
+    });
+    collector.Start();
+    while (polls < 3) {
+        std::this_thread::yield();
+    }
+    collector.Stop();
+    EXPECT_FALSE(collector.History().empty());
+}
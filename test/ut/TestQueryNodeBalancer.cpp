@@ -0,0 +1,84 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "QueryNodeBalancer.h"
+
+class QueryNodeBalancerTest : public ::testing::Test {};
+
+namespace {
+
+milvus::QuerySegmentInfo
+MakeSegment(int64_t segment_id, int64_t node_id, int64_t mem_size, int64_t row_count,
+            milvus::SegmentState state = milvus::SegmentState::SEALED) {
+    return milvus::QuerySegmentInfo(1, 2, segment_id, node_id, mem_size, row_count, "idx", 3, state);
+}
+
+}  // namespace
+
+TEST_F(QueryNodeBalancerTest, Balanced) {
+    std::vector<milvus::QuerySegmentInfo> segments{MakeSegment(1, 1, 100, 10), MakeSegment(2, 2, 110, 10)};
+    auto plan = milvus::PlanBalance(segments, {}, 1.2, 4);
+    ASSERT_EQ(plan.node_loads_.size(), 2);
+    EXPECT_EQ(plan.node_loads_[0].node_id_, 1);
+    EXPECT_EQ(plan.node_loads_[0].mem_size_, 100);
+    EXPECT_EQ(plan.node_loads_[1].node_id_, 2);
+    EXPECT_NEAR(plan.skew_, 110.0 / 105.0, 1e-9);
+    EXPECT_TRUE(plan.moves_.empty());
+    EXPECT_DOUBLE_EQ(plan.projected_skew_, plan.skew_);
+}
+
+TEST_F(QueryNodeBalancerTest, MovesToLightestNode) {
+    std::vector<milvus::QuerySegmentInfo> segments{MakeSegment(1, 1, 400, 40), MakeSegment(2, 1, 300, 30),
+                                                   MakeSegment(3, 1, 200, 20), MakeSegment(4, 1, 100, 10),
+                                                   MakeSegment(5, 2, 100, 10)};
+    // node 3 holds nothing yet
+    auto plan = milvus::PlanBalance(segments, {3}, 1.2, 4);
+    ASSERT_EQ(plan.node_loads_.size(), 3);
+    EXPECT_EQ(plan.node_loads_[0].segment_count_, 4);
+    EXPECT_EQ(plan.node_loads_[0].row_count_, 100);
+    EXPECT_EQ(plan.node_loads_[2].segment_count_, 0);
+    EXPECT_NEAR(plan.skew_, 1000.0 / (1100.0 / 3), 1e-9);
+
+    ASSERT_EQ(plan.moves_.size(), 2);
+    EXPECT_EQ(plan.moves_[0].source_node_, 1);
+    EXPECT_EQ(plan.moves_[0].target_node_, 3);
+    EXPECT_EQ(plan.moves_[0].segment_ids_, std::vector<int64_t>{1});
+    EXPECT_EQ(plan.moves_[1].target_node_, 2);
+    EXPECT_EQ(plan.moves_[1].segment_ids_, std::vector<int64_t>{2});
+    EXPECT_EQ(plan.moves_[1].load_, 300);
+    EXPECT_NEAR(plan.projected_skew_, 400.0 / (1100.0 / 3), 1e-9);
+
+    plan = milvus::PlanBalance(segments, {3}, 1.2, 1);
+    ASSERT_EQ(plan.moves_.size(), 1);
+    EXPECT_NEAR(plan.projected_skew_, 600.0 / (1100.0 / 3), 1e-9);
+}
+
+TEST_F(QueryNodeBalancerTest, GrowingAndRows) {
+    // no memory reported, rows are the load; the growing segment stays on its node
+    std::vector<milvus::QuerySegmentInfo> segments{MakeSegment(1, 1, 0, 900, milvus::SegmentState::GROWING),
+                                                   MakeSegment(2, 1, 0, 100), MakeSegment(3, 2, 0, 0)};
+    auto plan = milvus::PlanBalance(segments, {}, 1.2, 4);
+    EXPECT_NEAR(plan.skew_, 2.0, 1e-9);
+    ASSERT_EQ(plan.moves_.size(), 1);
+    EXPECT_EQ(plan.moves_[0].segment_ids_, std::vector<int64_t>{2});
+    EXPECT_EQ(plan.moves_[0].load_, 100);
+    EXPECT_NEAR(plan.projected_skew_, 1.8, 1e-9);
+}
@@ -0,0 +1,115 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "Refine.h"
+
+class RefineTest : public ::testing::Test {};
+
+TEST_F(RefineTest, FloatKernels) {
+    // odd dimensions cover the 8-wide, 4-wide and scalar tails
+    for (size_t dimension : {1, 3, 4, 7, 8, 13, 33}) {
+        std::vector<float> a(dimension);
+        std::vector<float> b(dimension);
+        float l2 = 0;
+        float ip = 0;
+        for (size_t i = 0; i < dimension; ++i) {
+            a[i] = static_cast<float>(i) * 0.5f - 1.0f;
+            b[i] = 2.0f - static_cast<float>(i) * 0.25f;
+            l2 += (a[i] - b[i]) * (a[i] - b[i]);
+            ip += a[i] * b[i];
+        }
+        EXPECT_NEAR(milvus::L2Sqr(a.data(), b.data(), dimension), l2, 1e-3);
+        EXPECT_NEAR(milvus::InnerProduct(a.data(), b.data(), dimension), ip, 1e-3);
+    }
+}
+
+TEST_F(RefineTest, BinaryKernels) {
+    std::vector<uint8_t> a{0xFF, 0x00, 0x0F, 0x01, 0, 0, 0, 0, 0x80};
+    std::vector<uint8_t> b{0x0F, 0x00, 0x0F, 0x00, 0, 0, 0, 0, 0x81};
+    // differing bits: 4 + 1 + 1, intersection: 4 + 4 + 1, union: 8 + 4 + 1 + 2
+    EXPECT_FLOAT_EQ(milvus::Hamming(a.data(), b.data(), a.size()), 6.0f);
+    EXPECT_FLOAT_EQ(milvus::Jaccard(a.data(), b.data(), a.size()), 1.0f - 9.0f / 15.0f);
+
+    std::vector<uint8_t> zero(4, 0);
+    EXPECT_FLOAT_EQ(milvus::Jaccard(zero.data(), zero.data(), zero.size()), 0.0f);
+}
+
+TEST_F(RefineTest, MetricLookup) {
+    milvus::DistanceMetric metric;
+    EXPECT_TRUE(milvus::GetDistanceMetric("L2", milvus::DataType::FLOAT_VECTOR, metric).IsOk());
+    EXPECT_TRUE(metric.Closer(1.0f, 2.0f));
+    EXPECT_TRUE(milvus::GetDistanceMetric("IP", milvus::DataType::FLOAT_VECTOR, metric).IsOk());
+    EXPECT_TRUE(metric.Closer(2.0f, 1.0f));
+    EXPECT_TRUE(milvus::GetDistanceMetric("JACCARD", milvus::DataType::BINARY_VECTOR, metric).IsOk());
+
+    auto status = milvus::GetDistanceMetric("HAMMING", milvus::DataType::FLOAT_VECTOR, metric);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::NotSupported);
+    status = milvus::GetDistanceMetric("TANIMOTO", milvus::DataType::BINARY_VECTOR, metric);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::NotSupported);
+}
+
+TEST_F(RefineTest, RerankKeepsExactTopK) {
+    milvus::FloatVecFieldData vectors("vec", 2, std::vector<float>{3, 0, 1, 0, 0, 0, 2, 0, 1, 0});
+    auto tags = std::make_shared<milvus::Int64FieldData>("tag", std::vector<int64_t>{30, 10, 0, 20, 11});
+    auto vector_column = std::make_shared<milvus::FloatVecFieldData>(vectors);
+    milvus::SingleResult candidates(milvus::IDArray(std::vector<int64_t>{100, 101, 102, 103, 104}),
+                                    std::vector<float>{0, 0, 0, 0, 0}, {tags, vector_column});
+
+    std::vector<const void*> rows;
+    for (size_t i = 0; i < vectors.Count(); ++i) {
+        rows.push_back(vectors.Row(i));
+    }
+    // the vector of 102 is unknown
+    rows[2] = nullptr;
+
+    milvus::DistanceMetric metric;
+    ASSERT_TRUE(milvus::GetDistanceMetric("L2", milvus::DataType::FLOAT_VECTOR, metric).IsOk());
+    std::vector<float> target{0, 0};
+    milvus::SingleResult refined;
+    milvus::RerankResult(candidates, rows, target.data(), 2, metric, 3, -1, "vec", refined);
+
+    // 101 and 104 tie, the index order is kept
+    EXPECT_EQ(refined.Ids().IntIDArray(), (std::vector<int64_t>{101, 104, 103}));
+    EXPECT_EQ(refined.Scores(), (std::vector<float>{1, 1, 4}));
+    ASSERT_EQ(refined.OutputFields().size(), 1);
+    auto refined_tags = std::dynamic_pointer_cast<milvus::Int64FieldData>(refined.GetFieldByName("tag"));
+    ASSERT_NE(refined_tags, nullptr);
+    EXPECT_EQ(refined_tags->Data(), (std::vector<int64_t>{10, 11, 20}));
+}
+
+TEST_F(RefineTest, RerankInnerProduct) {
+    std::vector<float> vectors{1, 0, 0, 1, 2, 2};
+    milvus::SingleResult candidates(milvus::IDArray(std::vector<std::string>{"a", "b", "c"}),
+                                    std::vector<float>{0, 0, 0}, {});
+    std::vector<const void*> rows{vectors.data(), vectors.data() + 2, vectors.data() + 4};
+
+    milvus::DistanceMetric metric;
+    ASSERT_TRUE(milvus::GetDistanceMetric("IP", milvus::DataType::FLOAT_VECTOR, metric).IsOk());
+    std::vector<float> target{0.3f, 0.7f};
+    milvus::SingleResult refined;
+    milvus::RerankResult(candidates, rows, target.data(), 2, metric, 10, 1, "", refined);
+
+    EXPECT_EQ(refined.Ids().StrIDArray(), (std::vector<std::string>{"c", "b", "a"}));
+    ASSERT_EQ(refined.Scores().size(), 3);
+    EXPECT_FLOAT_EQ(refined.Scores()[0], 2.0f);
+    EXPECT_FLOAT_EQ(refined.Scores()[1], 0.7f);
+    EXPECT_FLOAT_EQ(refined.Scores()[2], 0.3f);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+
+#include "RowTransposer.h"
+
+namespace {
+struct Row {
+    int64_t id;
+    int8_t age;
+    bool flag;
+    double score;
+    std::string name;
+    float embedding[8];
+    uint8_t code[2];
+};
+}  // namespace
+
+class RowTransposerTest : public ::testing::Test {};
+
+TEST_F(RowTransposerTest, Transpose) {
+    const size_t row_count = 1000;
+    std::vector<Row> rows(row_count);
+    for (size_t i = 0; i < row_count; ++i) {
+        rows[i].id = static_cast<int64_t>(i);
+        rows[i].age = static_cast<int8_t>(i % 100);
+        rows[i].flag = (i % 2 == 0);
+        rows[i].score = i * 0.5;
+        rows[i].name = std::to_string(i);
+        for (int k = 0; k < 8; ++k) {
+            rows[i].embedding[k] = static_cast<float>(i * 8 + k);
+        }
+        rows[i].code[0] = static_cast<uint8_t>(i);
+        rows[i].code[1] = static_cast<uint8_t>(i >> 8);
+    }
+
+    milvus::RowLayout layout(sizeof(Row));
+    layout.AddField("id", milvus::DataType::INT64, offsetof(Row, id));
+    layout.AddField("age", milvus::DataType::INT8, offsetof(Row, age));
+    layout.AddField("flag", milvus::DataType::BOOL, offsetof(Row, flag));
+    layout.AddField("score", milvus::DataType::DOUBLE, offsetof(Row, score));
+    layout.AddField("name", milvus::DataType::STRING, offsetof(Row, name));
+    layout.AddField("embedding", milvus::DataType::FLOAT_VECTOR, offsetof(Row, embedding), 8);
+    layout.AddField("code", milvus::DataType::BINARY_VECTOR, offsetof(Row, code), 16);
+
+    // small blocks to exercise multiple blocks and tasks
+    milvus::ThreadPool pool(4);
+    milvus::RowTransposer transposer(pool, sizeof(Row) * 7);
+    milvus::proto::milvus::InsertRequest request;
+    ASSERT_TRUE(transposer.Transpose(layout, rows.data(), row_count, request).IsOk());
+
+    ASSERT_EQ(request.num_rows(), row_count);
+    ASSERT_EQ(request.fields_data_size(), 7);
+    const auto& ids = request.fields_data(0).scalars().long_data().data();
+    const auto& ages = request.fields_data(1).scalars().int_data().data();
+    const auto& flags = request.fields_data(2).scalars().bool_data().data();
+    const auto& scores = request.fields_data(3).scalars().double_data().data();
+    const auto& names = request.fields_data(4).scalars().string_data().data();
+    const auto& embeddings = request.fields_data(5).vectors().float_vector().data();
+    const auto& codes = request.fields_data(6).vectors().binary_vector();
+    ASSERT_EQ(embeddings.size(), row_count * 8);
+    ASSERT_EQ(codes.size(), row_count * 2);
+    for (size_t i = 0; i < row_count; ++i) {
+        EXPECT_EQ(ids.Get(i), rows[i].id);
+        EXPECT_EQ(ages.Get(i), rows[i].age);
+        EXPECT_EQ(flags.Get(i), rows[i].flag);
+        EXPECT_DOUBLE_EQ(scores.Get(i), rows[i].score);
+        EXPECT_EQ(names.Get(i), rows[i].name);
+        EXPECT_FLOAT_EQ(embeddings.Get(i * 8 + 7), rows[i].embedding[7]);
+        EXPECT_EQ(static_cast<uint8_t>(codes[i * 2 + 1]), rows[i].code[1]);
+    }
+}
+
+TEST_F(RowTransposerTest, InvalidLayout) {
+    Row row{};
+    milvus::proto::milvus::InsertRequest request;
+    milvus::ThreadPool pool(2);
+    milvus::RowTransposer transposer(pool);
+
+    milvus::RowLayout overflow(sizeof(Row));
+    overflow.AddField("embedding", milvus::DataType::FLOAT_VECTOR, offsetof(Row, embedding), 1024);
+    EXPECT_FALSE(transposer.Transpose(overflow, &row, 1, request).IsOk());
+
+    milvus::RowLayout binary(sizeof(Row));
+    binary.AddField("code", milvus::DataType::BINARY_VECTOR, offsetof(Row, code), 12);
+    EXPECT_FALSE(transposer.Transpose(binary, &row, 1, request).IsOk());
+}
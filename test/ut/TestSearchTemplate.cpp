@@ -0,0 +1,145 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "SearchTemplate.h"
+
+namespace {
+milvus::CollectionSchema
+FaceSchema() {
+    milvus::CollectionSchema schema("faces");
+    milvus::FieldSchema id("id", milvus::DataType::INT64, "", true);
+    milvus::FieldSchema age("age", milvus::DataType::INT32);
+    milvus::FieldSchema face("face", milvus::DataType::FLOAT_VECTOR);
+    face.SetDimension(2);
+    schema.AddField(id);
+    schema.AddField(age);
+    schema.AddField(face);
+    return schema;
+}
+
+milvus::SearchArguments
+FaceArguments() {
+    milvus::SearchArguments arguments;
+    arguments.SetCollectionName("faces");
+    arguments.AddPartitionName("p1");
+    arguments.AddOutputField("age");
+    arguments.SetExpression("age > 10");
+    arguments.SetAnnsField("face");
+    arguments.SetTopK(5);
+    arguments.SetMetricType("IP");
+    arguments.AddExtraParam("nprobe", 16);
+    arguments.SetTravelTimestamp(100);
+    return arguments;
+}
+
+std::string
+ToString(const ::grpc::ByteBuffer& buffer) {
+    std::vector<::grpc::Slice> slices;
+    buffer.Dump(&slices);
+    std::string bytes;
+    for (const auto& slice : slices) {
+        bytes.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+    }
+    return bytes;
+}
+}  // namespace
+
+class SearchTemplateTest : public ::testing::Test {};
+
+TEST_F(SearchTemplateTest, SerializeMatchesMessage) {
+    auto arguments = FaceArguments();
+    std::shared_ptr<const milvus::SearchTemplate> search_template;
+    ASSERT_TRUE(milvus::SearchTemplate::Create(arguments, FaceSchema(), search_template).IsOk());
+
+    milvus::FloatVecFieldData vectors("face", 2, std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+    ::grpc::ByteBuffer buffer;
+    ASSERT_TRUE(search_template->Serialize(vectors, 12345, buffer).IsOk());
+    milvus::proto::milvus::SearchRequest parsed;
+    ASSERT_TRUE(parsed.ParseFromString(ToString(buffer)));
+
+    milvus::proto::milvus::SearchRequest expected;
+    milvus::BuildSearchRequest(arguments, expected);
+    milvus::proto::milvus::PlaceholderGroup group;
+    auto placeholder = group.add_placeholders();
+    placeholder->set_tag("$0");
+    placeholder->set_type(milvus::proto::milvus::PlaceholderType::FloatVector);
+    placeholder->add_values(std::string(reinterpret_cast<const char*>(vectors.Row(0)), 2 * sizeof(float)));
+    placeholder->add_values(std::string(reinterpret_cast<const char*>(vectors.Row(1)), 2 * sizeof(float)));
+    expected.set_placeholder_group(group.SerializeAsString());
+    expected.set_guarantee_timestamp(12345);
+    EXPECT_EQ(parsed.SerializeAsString(), expected.SerializeAsString());
+
+    EXPECT_EQ(parsed.collection_name(), "faces");
+    EXPECT_EQ(parsed.dsl_type(), milvus::proto::common::DslType::BoolExprV1);
+    EXPECT_EQ(parsed.travel_timestamp(), 100);
+    ASSERT_EQ(parsed.search_params_size(), 5);
+    EXPECT_EQ(parsed.search_params(3).key(), "params");
+    EXPECT_EQ(parsed.search_params(3).value(), "{\"nprobe\":16}");
+}
+
+TEST_F(SearchTemplateTest, Validate) {
+    auto schema = FaceSchema();
+    std::shared_ptr<const milvus::SearchTemplate> search_template;
+
+    auto arguments = FaceArguments();
+    arguments.SetAnnsField("age");
+    EXPECT_FALSE(milvus::SearchTemplate::Create(arguments, schema, search_template).IsOk());
+    arguments.SetAnnsField("unknown");
+    EXPECT_FALSE(milvus::SearchTemplate::Create(arguments, schema, search_template).IsOk());
+
+    arguments = FaceArguments();
+    arguments.AddOutputField("unknown");
+    EXPECT_FALSE(milvus::SearchTemplate::Create(arguments, schema, search_template).IsOk());
+
+    ASSERT_TRUE(milvus::SearchTemplate::Create(FaceArguments(), schema, search_template).IsOk());
+    ::grpc::ByteBuffer buffer;
+    milvus::FloatVecFieldData wrong_dim("face", 3, std::vector<float>{1.0f, 2.0f, 3.0f});
+    EXPECT_FALSE(search_template->Serialize(wrong_dim, 0, buffer).IsOk());
+    milvus::BinaryVecFieldData wrong_type("face", 16, std::vector<uint8_t>{1, 2});
+    EXPECT_FALSE(search_template->Serialize(wrong_type, 0, buffer).IsOk());
+}
+
+TEST_F(SearchTemplateTest, ConvertResults) {
+    milvus::proto::schema::SearchResultData data;
+    data.set_num_queries(2);
+    data.set_top_k(2);
+    data.add_topks(2);
+    data.add_topks(1);
+    for (int64_t id : {10, 11, 20}) {
+        data.mutable_ids()->mutable_int_id()->add_data(id);
+    }
+    for (float score : {0.1f, 0.2f, 0.3f}) {
+        data.add_scores(score);
+    }
+    auto field = data.add_fields_data();
+    field->set_field_name("age");
+    field->set_type(milvus::proto::schema::DataType::Int32);
+    for (int32_t age : {1, 2, 3}) {
+        field->mutable_scalars()->mutable_int_data()->add_data(age);
+    }
+
+    auto results = milvus::ConvertSearchResults(data);
+    ASSERT_EQ(results.Results().size(), 2);
+    const auto& second = results.Results()[1];
+    EXPECT_EQ(second.Ids().IntIDArray(), std::vector<int64_t>{20});
+    EXPECT_EQ(second.Scores(), std::vector<float>{0.3f});
+    auto ages = std::dynamic_pointer_cast<milvus::Int32FieldData>(second.GetFieldByName("age"));
+    ASSERT_NE(ages, nullptr);
+    EXPECT_EQ(ages->Data(), std::vector<int32_t>{3});
+    EXPECT_EQ(results.Results()[0].Ids().IntIDArray(), (std::vector<int64_t>{10, 11}));
+}
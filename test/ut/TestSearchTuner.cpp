@@ -0,0 +1,153 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "SearchTuner.h"
+
+class SearchTunerTest : public ::testing::Test {};
+
+TEST_F(SearchTunerTest, DefaultCandidates) {
+    std::vector<int64_t> candidates;
+    EXPECT_TRUE(milvus::DefaultTuneCandidates("nprobe", 10, candidates).IsOk());
+    EXPECT_EQ(candidates.front(), 1);
+    EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+
+    EXPECT_TRUE(milvus::DefaultTuneCandidates("ef", 50, candidates).IsOk());
+    EXPECT_EQ(candidates.front(), 50);
+    EXPECT_EQ(candidates[1], 64);
+
+    EXPECT_EQ(milvus::DefaultTuneCandidates("unknown", 10, candidates).Code(), milvus::StatusCode::NotSupported);
+}
+
+TEST_F(SearchTunerTest, GroundTruthAndRecall) {
+    milvus::FloatVecFieldData base("vec", 2);
+    for (int i = 0; i < 10; ++i) {
+        base.Add({static_cast<float>(i), 0.0f});
+    }
+    milvus::FloatVecFieldData targets("vec", 2);
+    targets.Add({2.1f, 0.0f});
+    targets.Add({8.9f, 0.0f});
+
+    std::vector<const void*> base_rows;
+    std::vector<const void*> target_rows;
+    uint32_t dimension = 0;
+    EXPECT_TRUE(milvus::VectorRows(base, base_rows, dimension).IsOk());
+    EXPECT_TRUE(milvus::VectorRows(targets, target_rows, dimension).IsOk());
+    EXPECT_EQ(dimension, 2);
+
+    milvus::DistanceMetric metric;
+    EXPECT_TRUE(milvus::GetDistanceMetric("L2", milvus::DataType::FLOAT_VECTOR, metric).IsOk());
+    std::vector<std::vector<size_t>> truth;
+    milvus::ComputeGroundTruth(base_rows, target_rows, dimension, metric, 3, truth);
+    ASSERT_EQ(truth.size(), 2);
+    EXPECT_EQ(truth[0], (std::vector<size_t>{2, 3, 1}));
+    EXPECT_EQ(truth[1], (std::vector<size_t>{9, 8, 7}));
+
+    milvus::IDArray base_ids(std::vector<int64_t>{100, 101, 102, 103, 104, 105, 106, 107, 108, 109});
+    milvus::SingleResult exact(milvus::IDArray(std::vector<int64_t>{102, 103, 101}), {0.01f, 0.81f, 1.21f}, {});
+    EXPECT_DOUBLE_EQ(milvus::RecallAtK(base_ids, truth[0], exact), 1.0);
+    milvus::SingleResult partial(milvus::IDArray(std::vector<int64_t>{109, 105, 104}), {0.01f, 15.21f, 24.01f}, {});
+    EXPECT_DOUBLE_EQ(milvus::RecallAtK(base_ids, truth[1], partial), 1.0 / 3);
+}
+
+TEST_F(SearchTunerTest, PartialSample) {
+    // the collection holds ids 100..109 with vector (i, 0), the sample only the even ones
+    milvus::FloatVecFieldData sample("vec", 2);
+    std::vector<int64_t> sample_ids;
+    for (int i = 0; i < 10; i += 2) {
+        sample.Add({static_cast<float>(i), 0.0f});
+        sample_ids.push_back(100 + i);
+    }
+    milvus::IDArray base_ids(sample_ids);
+    milvus::FloatVecFieldData targets("vec", 2);
+    targets.Add({3.9f, 0.0f});
+
+    std::vector<const void*> base_rows;
+    std::vector<const void*> target_rows;
+    uint32_t dimension = 0;
+    EXPECT_TRUE(milvus::VectorRows(sample, base_rows, dimension).IsOk());
+    EXPECT_TRUE(milvus::VectorRows(targets, target_rows, dimension).IsOk());
+    milvus::DistanceMetric metric;
+    EXPECT_TRUE(milvus::GetDistanceMetric("L2", milvus::DataType::FLOAT_VECTOR, metric).IsOk());
+    std::vector<std::vector<size_t>> truth;
+    milvus::ComputeGroundTruth(base_rows, target_rows, dimension, metric, 2, truth);
+    ASSERT_EQ(truth.size(), 1);
+    EXPECT_EQ(truth[0], (std::vector<size_t>{2, 1}));
+
+    // an exact search of the whole collection returns 103, outside of the sample
+    milvus::SingleResult unlimited(milvus::IDArray(std::vector<int64_t>{104, 103}), {0.01f, 0.81f}, {});
+    EXPECT_DOUBLE_EQ(milvus::RecallAtK(base_ids, truth[0], unlimited), 0.5);
+    // limited to the sample by the expression, the exact search reaches full recall
+    std::string expression;
+    EXPECT_TRUE(milvus::SampleExpression("age > 1", "id", milvus::DataType::INT64, base_ids, expression).IsOk());
+    EXPECT_EQ(expression, "(age > 1) && (id in [100,102,104,106,108])");
+    milvus::SingleResult limited(milvus::IDArray(std::vector<int64_t>{104, 102}), {0.01f, 3.61f}, {});
+    EXPECT_DOUBLE_EQ(milvus::RecallAtK(base_ids, truth[0], limited), 1.0);
+
+    EXPECT_TRUE(milvus::SampleExpression("", "id", milvus::DataType::INT64, base_ids, expression).IsOk());
+    EXPECT_EQ(expression, "id in [100,102,104,106,108]");
+    milvus::IDArray names(std::vector<std::string>{"a", "b"});
+    EXPECT_TRUE(milvus::SampleExpression("", "name", milvus::DataType::STRING, names, expression).IsOk());
+    EXPECT_EQ(expression, R"(name in ["a","b"])");
+    EXPECT_FALSE(milvus::SampleExpression("", "id", milvus::DataType::INT64, names, expression).IsOk());
+}
+
+TEST_F(SearchTunerTest, SplitVectors) {
+    milvus::BinaryVecFieldData vectors("vec", 16);
+    vectors.Add({1, 2});
+    vectors.Add({3, 4});
+    std::vector<milvus::FieldDataPtr> singles;
+    EXPECT_TRUE(milvus::SplitVectors(vectors, singles).IsOk());
+    ASSERT_EQ(singles.size(), 2);
+    auto second = std::dynamic_pointer_cast<milvus::BinaryVecFieldData>(singles[1]);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(second->Dimension(), 16);
+    EXPECT_EQ(second->Data(), (std::vector<uint8_t>{3, 4}));
+
+    milvus::Int64FieldData scalars("id");
+    EXPECT_FALSE(milvus::SplitVectors(scalars, singles).IsOk());
+}
+
+TEST_F(SearchTunerTest, AppendVectors) {
+    milvus::FloatVecFieldData vectors("vec", 2);
+    vectors.Add({1, 2});
+    milvus::FloatVecFieldData more("vec", 2);
+    more.Add({3, 4});
+    more.Add({5, 6});
+    EXPECT_TRUE(milvus::AppendVectors(vectors, more).IsOk());
+    EXPECT_EQ(vectors.Count(), 3);
+    EXPECT_EQ(vectors.Data(), (std::vector<float>{1, 2, 3, 4, 5, 6}));
+
+    milvus::FloatVecFieldData wider("vec", 4);
+    wider.Add({1, 2, 3, 4});
+    EXPECT_FALSE(milvus::AppendVectors(vectors, wider).IsOk());
+    milvus::BinaryVecFieldData binary("vec", 16);
+    EXPECT_FALSE(milvus::AppendVectors(vectors, binary).IsOk());
+    EXPECT_EQ(vectors.Count(), 3);
+}
+
+TEST_F(SearchTunerTest, Percentile) {
+    std::vector<double> sorted{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    EXPECT_DOUBLE_EQ(milvus::Percentile(sorted, 50), 5);
+    EXPECT_DOUBLE_EQ(milvus::Percentile(sorted, 90), 9);
+    EXPECT_DOUBLE_EQ(milvus::Percentile(sorted, 99), 10);
+    EXPECT_DOUBLE_EQ(milvus::Percentile({}, 50), 0);
+}
@@ -0,0 +1,111 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <thread>
+
+#include "MilvusClient.h"
+#include "ThreadAffinity.h"
+#include "ThreadPool.h"
+
+class ThreadAffinityTest : public ::testing::Test {};
+
+TEST_F(ThreadAffinityTest, ParseCpuList) {
+    std::vector<int> cpus;
+    EXPECT_TRUE(milvus::ParseCpuList("0-3,8, 10-11\n", cpus));
+    EXPECT_EQ(cpus, (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+
+    cpus.clear();
+    EXPECT_TRUE(milvus::ParseCpuList("", cpus));
+    EXPECT_TRUE(cpus.empty());
+
+    EXPECT_FALSE(milvus::ParseCpuList("3-1", cpus));
+    EXPECT_FALSE(milvus::ParseCpuList("a", cpus));
+    EXPECT_FALSE(milvus::ParseCpuList("-1", cpus));
+}
+
+TEST_F(ThreadAffinityTest, ResolveCpuAffinity) {
+    milvus::ThreadingConfig config;
+    std::vector<int> cpus;
+    EXPECT_TRUE(milvus::ResolveCpuAffinity(config, cpus).IsOk());
+    EXPECT_TRUE(cpus.empty());
+
+    config.SetCpuAffinity({3, 1, 3});
+    EXPECT_TRUE(milvus::ResolveCpuAffinity(config, cpus).IsOk());
+    EXPECT_EQ(cpus, (std::vector<int>{1, 3}));
+
+    config.SetCpuAffinity({-1});
+    EXPECT_EQ(milvus::ResolveCpuAffinity(config, cpus).Code(), milvus::StatusCode::InvalidAgument);
+
+    config.SetCpuAffinity({});
+    config.SetNumaNode(100000);
+    EXPECT_EQ(milvus::ResolveCpuAffinity(config, cpus).Code(), milvus::StatusCode::InvalidAgument);
+}
+
+TEST_F(ThreadAffinityTest, PinCurrentThread) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set), 0);
+    int allowed = 0;
+    while (!CPU_ISSET(allowed, &cpu_set)) {
+        ++allowed;
+    }
+
+    bool pinned = false;
+    std::thread thread([allowed, &pinned] {
+        ASSERT_TRUE(milvus::PinCurrentThread({allowed}).IsOk());
+        cpu_set_t current;
+        CPU_ZERO(&current);
+        pthread_getaffinity_np(pthread_self(), sizeof(current), &current);
+        pinned = CPU_COUNT(&current) == 1 && CPU_ISSET(allowed, &current);
+    });
+    thread.join();
+    EXPECT_TRUE(pinned);
+}
+
+TEST_F(ThreadAffinityTest, PinnedThreadPool) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set), 0);
+    int allowed = 0;
+    while (!CPU_ISSET(allowed, &cpu_set)) {
+        ++allowed;
+    }
+
+    milvus::ThreadPool pool(2, {allowed});
+    EXPECT_EQ(pool.Size(), 2);
+    bool pinned = false;
+    auto future = pool.Enqueue([allowed, &pinned] {
+        cpu_set_t current;
+        CPU_ZERO(&current);
+        pthread_getaffinity_np(pthread_self(), sizeof(current), &current);
+        pinned = CPU_COUNT(&current) == 1 && CPU_ISSET(allowed, &current);
+    });
+    future.wait();
+    EXPECT_TRUE(pinned);
+}
+
+TEST_F(ThreadAffinityTest, InvalidThreadingConfig) {
+    auto client = milvus::MilvusClient::Create();
+    milvus::ConnectParam connect_param("localhost", 19530);
+    milvus::ThreadingConfig threading;
+    threading.SetCompletionQueueCount(0);
+    connect_param.SetThreading(threading);
+    EXPECT_EQ(client->Connect(connect_param).Code(), milvus::StatusCode::InvalidAgument);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include "TypeUtils.h"
+
+class TypeUtilsTest : public ::testing::Test {};
+
+TEST_F(TypeUtilsTest, ScalarRoundTrip) {
+    milvus::Int8FieldData int8_field("age", std::vector<int8_t>{1, -2, 3});
+    milvus::proto::schema::FieldData proto_field;
+    milvus::ConvertFieldData(int8_field, proto_field);
+    EXPECT_EQ(proto_field.field_name(), "age");
+    EXPECT_EQ(proto_field.type(), milvus::proto::schema::DataType::Int8);
+    EXPECT_EQ(proto_field.scalars().int_data().data_size(), 3);
+
+    auto field = milvus::CreateFieldData(proto_field);
+    auto column = std::dynamic_pointer_cast<milvus::Int8FieldData>(field);
+    ASSERT_NE(column, nullptr);
+    EXPECT_EQ(column->Data(), int8_field.Data());
+}
+
+TEST_F(TypeUtilsTest, StringRoundTrip) {
+    milvus::StringFieldData string_field("name", std::vector<std::string>{"a", "bc"});
+    milvus::proto::schema::FieldData proto_field;
+    milvus::ConvertFieldData(string_field, proto_field);
+
+    auto column = std::dynamic_pointer_cast<milvus::StringFieldData>(milvus::CreateFieldData(proto_field));
+    ASSERT_NE(column, nullptr);
+    EXPECT_EQ(column->Data(), string_field.Data());
+}
+
+TEST_F(TypeUtilsTest, VectorRoundTrip) {
+    milvus::FloatVecFieldData float_field("vec", 2, std::vector<float>{0.1f, 0.2f, 0.3f, 0.4f});
+    milvus::proto::schema::FieldData proto_field;
+    milvus::ConvertFieldData(float_field, proto_field);
+    EXPECT_EQ(proto_field.vectors().dim(), 2);
+
+    auto column = std::dynamic_pointer_cast<milvus::FloatVecFieldData>(milvus::CreateFieldData(proto_field));
+    ASSERT_NE(column, nullptr);
+    EXPECT_EQ(column->Count(), 2);
+    EXPECT_EQ(column->Data(), float_field.Data());
+
+    milvus::BinaryVecFieldData binary_field("bin", 16, std::vector<uint8_t>{1, 2, 3, 4});
+    milvus::ConvertFieldData(binary_field, proto_field);
+    auto binary = std::dynamic_pointer_cast<milvus::BinaryVecFieldData>(milvus::CreateFieldData(proto_field));
+    ASSERT_NE(binary, nullptr);
+    EXPECT_EQ(binary->Count(), 2);
+    EXPECT_EQ(binary->Data(), binary_field.Data());
+}
+
+TEST_F(TypeUtilsTest, GatherRows) {
+    milvus::Int64FieldData ids("id", std::vector<int64_t>{10, 11, 12, 13});
+    milvus::FloatVecFieldData vectors("vec", 2, std::vector<float>{0, 1, 2, 3, 4, 5, 6, 7});
+    std::vector<uint32_t> rows{3, 1};
+
+    auto gathered_ids = std::dynamic_pointer_cast<milvus::Int64FieldData>(milvus::GatherRows(ids, rows));
+    ASSERT_NE(gathered_ids, nullptr);
+    EXPECT_EQ(gathered_ids->Data(), (std::vector<int64_t>{13, 11}));
+
+    auto gathered_vectors = std::dynamic_pointer_cast<milvus::FloatVecFieldData>(milvus::GatherRows(vectors, rows));
+    ASSERT_NE(gathered_vectors, nullptr);
+    EXPECT_EQ(gathered_vectors->Dimension(), 2);
+    EXPECT_EQ(gathered_vectors->Data(), (std::vector<float>{6, 7, 2, 3}));
+}
+
+TEST_F(TypeUtilsTest, AppendRows) {
+    milvus::StringFieldData names("name", std::vector<std::string>{"a"});
+    milvus::StringFieldData more_names("name", std::vector<std::string>{"bc", "def"});
+    EXPECT_TRUE(milvus::AppendRows(more_names, names));
+    EXPECT_EQ(names.Data(), (std::vector<std::string>{"a", "bc", "def"}));
+    EXPECT_EQ(milvus::FieldDataBytes(names), 6);
+
+    milvus::FloatVecFieldData vectors("vec", 2, std::vector<float>{0, 1});
+    milvus::FloatVecFieldData more_vectors("vec", 2, std::vector<float>{2, 3, 4, 5});
+    EXPECT_TRUE(milvus::AppendRows(more_vectors, vectors));
+    EXPECT_EQ(vectors.Count(), 3);
+    EXPECT_EQ(milvus::FieldDataBytes(vectors), 6 * sizeof(float));
+
+    milvus::FloatVecFieldData other_dimension("vec", 3, std::vector<float>{0, 1, 2});
+    EXPECT_FALSE(milvus::AppendRows(other_dimension, vectors));
+    EXPECT_FALSE(milvus::AppendRows(names, vectors));
+}
@@ -0,0 +1,132 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "Validator.h"
+
+class ValidatorTest : public ::testing::Test {};
+
+namespace {
+
+milvus::CollectionSchema
+TestSchema() {
+    milvus::CollectionSchema schema("test");
+    milvus::FieldSchema id_field("id", milvus::DataType::INT64, "", true, false);
+    schema.AddField(id_field);
+    milvus::FieldSchema score_field("score", milvus::DataType::FLOAT);
+    schema.AddField(score_field);
+    milvus::FieldSchema vector_field("vec", milvus::DataType::FLOAT_VECTOR);
+    vector_field.SetDimension(4);
+    schema.AddField(vector_field);
+    return schema;
+}
+
+}  // namespace
+
+TEST_F(ValidatorTest, FindNonFiniteRows) {
+    std::vector<float> data(4 * 37, 1.0f);
+    data[4 * 3 + 1] = std::numeric_limits<float>::quiet_NaN();
+    data[4 * 3 + 2] = std::numeric_limits<float>::infinity();
+    data[4 * 20] = -std::numeric_limits<float>::infinity();
+    data[4 * 36 + 3] = std::numeric_limits<float>::quiet_NaN();
+    std::vector<uint32_t> rows;
+    milvus::FindNonFiniteRows(data.data(), 37, 4, rows);
+    EXPECT_EQ(rows, (std::vector<uint32_t>{3, 20, 36}));
+
+    std::vector<double> values(19, 0.5);
+    values[7] = std::numeric_limits<double>::quiet_NaN();
+    values[18] = std::numeric_limits<double>::infinity();
+    rows.clear();
+    milvus::FindNonFiniteRows(values.data(), values.size(), 1, rows);
+    EXPECT_EQ(rows, (std::vector<uint32_t>{7, 18}));
+
+    values.assign(16, std::numeric_limits<double>::max());
+    rows.clear();
+    milvus::FindNonFiniteRows(values.data(), values.size(), 1, rows);
+    EXPECT_TRUE(rows.empty());
+}
+
+TEST_F(ValidatorTest, ValidInsert) {
+    auto vectors = std::make_shared<milvus::FloatVecFieldData>("vec", 4);
+    vectors->Add({1, 2, 3, 4});
+    vectors->Add({5, 6, 7, 8});
+    std::vector<milvus::FieldDataPtr> fields{
+        std::make_shared<milvus::Int64FieldData>("id", std::vector<int64_t>{1, 2}),
+        std::make_shared<milvus::FloatFieldData>("score", std::vector<float>{0.1f, 0.2f}), vectors};
+
+    milvus::ValidationResults results;
+    EXPECT_TRUE(milvus::ValidateInsertFields(TestSchema(), fields, results).IsOk());
+    EXPECT_TRUE(results.IsValid());
+}
+
+TEST_F(ValidatorTest, InvalidInsert) {
+    auto vectors = std::make_shared<milvus::FloatVecFieldData>("vec", 4);
+    vectors->Add({1, 2, 3, 4});
+    vectors->Add({5, std::numeric_limits<float>::quiet_NaN(), 7, 8});
+    vectors->Add({1, 2, 3, 4});
+    const float inf = std::numeric_limits<float>::infinity();
+    std::vector<milvus::FieldDataPtr> fields{
+        std::make_shared<milvus::FloatFieldData>("score", std::vector<float>{inf, 0.2f, 0.3f}), vectors,
+        std::make_shared<milvus::Int32FieldData>("extra", std::vector<int32_t>{1, 2, 3})};
+
+    milvus::ValidationResults results;
+    auto status = milvus::ValidateInsertFields(TestSchema(), fields, results);
+    EXPECT_EQ(status.Code(), milvus::StatusCode::InvalidAgument);
+    ASSERT_EQ(results.Issues().size(), 4);
+    EXPECT_EQ(results.Issues()[0].FieldName(), "score");
+    EXPECT_EQ(results.Issues()[0].Rows(), (std::vector<uint32_t>{0}));
+    EXPECT_EQ(results.Issues()[1].FieldName(), "vec");
+    EXPECT_EQ(results.Issues()[1].Rows(), (std::vector<uint32_t>{1}));
+    EXPECT_EQ(results.Issues()[2].FieldName(), "extra");
+    EXPECT_EQ(results.Issues()[3].FieldName(), "id");
+    EXPECT_EQ(results.ErrorRows(), (std::vector<uint32_t>{0, 1}));
+}
+
+TEST_F(ValidatorTest, MismatchedColumns) {
+    auto vectors = std::make_shared<milvus::FloatVecFieldData>("vec", 3);
+    vectors->Add({1, 2, 3});
+    std::vector<milvus::FieldDataPtr> fields{
+        std::make_shared<milvus::Int64FieldData>("id", std::vector<int64_t>{1}),
+        std::make_shared<milvus::DoubleFieldData>("score", std::vector<double>{0.1}), vectors};
+
+    milvus::ValidationResults results;
+    EXPECT_FALSE(milvus::ValidateInsertFields(TestSchema(), fields, results).IsOk());
+    ASSERT_EQ(results.Issues().size(), 2);
+    EXPECT_EQ(results.Issues()[0].Reason(), "Data type doesn't match the schema");
+    EXPECT_EQ(results.Issues()[1].Reason(), "Dimension doesn't match the schema");
+    EXPECT_TRUE(results.ErrorRows().empty());
+}
+
+TEST_F(ValidatorTest, Search) {
+    milvus::SearchArguments arguments;
+    arguments.SetAnnsField("vec");
+    arguments.AddTargetVector(std::vector<float>{1, 2, 3, 4});
+    milvus::ValidationResults results;
+    EXPECT_TRUE(milvus::ValidateSearchArguments(TestSchema(), arguments, results).IsOk());
+
+    arguments.AddTargetVector(std::vector<float>{1, 2, std::numeric_limits<float>::quiet_NaN(), 4});
+    EXPECT_FALSE(milvus::ValidateSearchArguments(TestSchema(), arguments, results).IsOk());
+    EXPECT_EQ(results.ErrorRows(), (std::vector<uint32_t>{1}));
+
+    arguments.SetAnnsField("unknown");
+    EXPECT_FALSE(milvus::ValidateSearchArguments(TestSchema(), arguments, results).IsOk());
+}